@@ -35,6 +35,247 @@
   *
   */
 
+/**
+  * @brief  Driver private data linked to the interface, if any.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @retval       pointer to private data, NULL if not available
+  *
+  */
+static ism330dhcx_priv_t *ism330dhcx_priv_get(const stmdev_ctx_t *ctx)
+{
+  ism330dhcx_priv_t *priv = NULL;
+
+  if (ctx != NULL)
+  {
+    priv = (ism330dhcx_priv_t *)ctx->priv_data;
+  }
+
+  return priv;
+}
+
+/*
+ * Configuration registers that can be served by the shadow copy: one bit
+ * per register address (0x00 - 0x7F). Status, output, OIS (writable from
+ * the auxiliary SPI), page address and self-clearing request registers
+ * are never cached. FUNC_CFG_ACCESS is tracked by the bank cache.
+ */
+static const uint8_t ism330dhcx_shadow_map[2][ISM330DHCX_SHADOW_LEN / 8U] =
+{
+  /* user bank: PIN_CTRL, FIFO_CTRL1 - CTRL10_C, TAP_CFG0 - MD2_CFG,
+   * INTERNAL_FREQ_FINE, X/Y/Z_OFS_USR
+   */
+  {
+    0x84U, 0xFFU, 0xFFU, 0x03U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0x00U, 0x00U, 0xC0U, 0xFFU, 0x08U, 0x00U, 0x38U, 0x00U,
+  },
+  /* embedded functions bank: EMB_FUNC_EN_A/B, EMB_FUNC_INT1 - MLC_INT2,
+   * PAGE_RW, EMB_FUNC_FIFO_CFG, FSM_ENABLE_A/B, EMB_FUNC_ODR_CFG_B/C
+   */
+  {
+    0x30U, 0xFCU, 0x83U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+    0xD0U, 0x00U, 0x00U, 0x80U, 0x01U, 0x00U, 0x00U, 0x00U,
+  },
+};
+
+/**
+  * @brief  Shadow copy usable for the bank currently selected.
+  *
+  * @param  priv  driver private data(ptr)
+  * @param  idx   ISM330DHCX_SHADOW_USER / ISM330DHCX_SHADOW_EMB(ptr)
+  * @retval       shadow copy, NULL if registers must be accessed on the bus
+  *
+  */
+static ism330dhcx_shadow_t *ism330dhcx_shadow_get(const ism330dhcx_priv_t *priv,
+                                                  uint8_t *idx)
+{
+  ism330dhcx_shadow_t *shadow = NULL;
+
+  if ((priv != NULL) && (priv->shadow != NULL) &&
+      (priv->bank_cache_en == PROPERTY_ENABLE) &&
+      (priv->bank_valid == PROPERTY_ENABLE))
+  {
+    if (priv->bank == (uint8_t)ISM330DHCX_USER_BANK)
+    {
+      *idx = ISM330DHCX_SHADOW_USER;
+      shadow = priv->shadow;
+    }
+
+    else if (priv->bank == (uint8_t)ISM330DHCX_EMBEDDED_FUNC_BANK)
+    {
+      *idx = ISM330DHCX_SHADOW_EMB;
+      shadow = priv->shadow;
+    }
+
+    else
+    {
+      /* sensor hub registers are not cached */
+    }
+  }
+
+  return shadow;
+}
+
+/**
+  * @brief  Check if a register is cached in the shadow copy.
+  *
+  * @param  idx   ISM330DHCX_SHADOW_USER / ISM330DHCX_SHADOW_EMB
+  * @param  reg   register address
+  * @retval       1 if cached, 0 otherwise
+  *
+  */
+static uint8_t ism330dhcx_shadow_is_cached(uint8_t idx, uint16_t reg)
+{
+  uint8_t ret = 0;
+
+  if (reg < ISM330DHCX_SHADOW_LEN)
+  {
+    ret = (ism330dhcx_shadow_map[idx][reg / 8U] >> (reg % 8U)) & 0x01U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Update the shadow copy after a successful bus access.
+  *
+  * @param  priv  driver private data(ptr)
+  * @param  reg   first register accessed
+  * @param  data  register values(ptr)
+  * @param  len   number of consecutive registers
+  *
+  */
+static void ism330dhcx_shadow_update(ism330dhcx_priv_t *priv, uint8_t reg,
+                                     const uint8_t *data, uint16_t len)
+{
+  ism330dhcx_shadow_t *shadow;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+  uint16_t add;
+  uint16_t i;
+  uint8_t idx = 0;
+
+  shadow = ism330dhcx_shadow_get(priv, &idx);
+
+  if (shadow == NULL)
+  {
+    return;
+  }
+
+  for (i = 0; i < len; i++)
+  {
+    add = (uint16_t)reg + i;
+
+    if (ism330dhcx_shadow_is_cached(idx, add) == 1U)
+    {
+      shadow->reg[idx][add] = data[i];
+      shadow->valid[idx][add / 8U] |= (uint8_t)(1U << (add % 8U));
+
+      if ((idx == ISM330DHCX_SHADOW_USER) &&
+          (add == ISM330DHCX_COUNTER_BDR_REG1))
+      {
+        /* rst_counter_bdr is automatically cleared by the device */
+        counter_bdr_reg1 =
+          *(ism330dhcx_counter_bdr_reg1_t *)&shadow->reg[idx][add];
+        counter_bdr_reg1.rst_counter_bdr = PROPERTY_DISABLE;
+        shadow->reg[idx][add] = *(uint8_t *)&counter_bdr_reg1;
+      }
+
+      if ((idx == ISM330DHCX_SHADOW_USER) && (add == ISM330DHCX_CTRL3_C))
+      {
+        /* sw_reset and boot are automatically cleared by the device */
+        ctrl3_c = *(ism330dhcx_ctrl3_c_t *)&shadow->reg[idx][add];
+        ctrl3_c.sw_reset = PROPERTY_DISABLE;
+        ctrl3_c.boot = PROPERTY_DISABLE;
+        shadow->reg[idx][add] = *(uint8_t *)&ctrl3_c;
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Invalidate the whole shadow copy.
+  *
+  * @param  shadow  shadow copy(ptr)
+  *
+  */
+static void ism330dhcx_shadow_invalidate(ism330dhcx_shadow_t *shadow)
+{
+  uint8_t i;
+
+  for (i = 0; i < (ISM330DHCX_SHADOW_LEN / 8U); i++)
+  {
+    shadow->valid[ISM330DHCX_SHADOW_USER][i] = 0;
+    shadow->valid[ISM330DHCX_SHADOW_EMB][i] = 0;
+  }
+}
+
+/**
+  * @brief  Charge a bus access to the statistics entry in use.
+  *
+  * @param  priv  driver private data(ptr)
+  * @param  rd    1 for a read access, 0 for a write access
+  * @param  len   number of bytes transferred
+  * @param  ret   interface status of the access
+  *
+  */
+static void ism330dhcx_stats_record(const ism330dhcx_priv_t *priv, uint8_t rd,
+                                    uint16_t len, int32_t ret)
+{
+  ism330dhcx_stats_entry_t *entry;
+
+  if ((priv == NULL) || (priv->stats == NULL))
+  {
+    return;
+  }
+
+  entry = &priv->stats->entry[priv->stats->cur];
+
+  if (rd == 1U)
+  {
+    entry->rd_count++;
+    entry->rd_bytes += len;
+  }
+
+  else
+  {
+    entry->wr_count++;
+    entry->wr_bytes += len;
+  }
+
+  if (ret != 0)
+  {
+    entry->errors++;
+  }
+}
+
+/**
+  * @brief  A bus access failed in the middle of a bank sequence: the
+  *         sequence is aborted by the caller, so restore the user bank
+  *         and release the level of the interface lock held for the bank
+  *         sequence here. Called with the interface lock taken.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  priv  driver private data(ptr)
+  *
+  */
+static void ism330dhcx_bank_abort(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_priv_t *priv)
+{
+  uint8_t func_cfg_access = 0;
+
+  if ((priv == NULL) || (priv->lock_held == PROPERTY_DISABLE))
+  {
+    return;
+  }
+
+  (void)ctx->write_reg(ctx->handle, ISM330DHCX_FUNC_CFG_ACCESS,
+                       &func_cfg_access, 1);
+  priv->bank_valid = PROPERTY_DISABLE;
+  priv->lock_held = PROPERTY_DISABLE;
+  ism330dhcx_unlock(ctx);
+}
+
 /**
   * @brief  Read generic device register
   *
@@ -51,12 +292,70 @@ int32_t __weak ism330dhcx_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
 {
   int32_t ret;
 
+  ism330dhcx_priv_t *priv;
+  ism330dhcx_shadow_t *shadow;
+  uint16_t add;
+  uint16_t i;
+  uint8_t idx = 0;
+  uint8_t hit;
+
   if (ctx == NULL)
   {
     return -1;
   }
 
-  ret = ctx->read_reg(ctx->handle, reg, data, len);
+  priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_lock(ctx);
+  shadow = ism330dhcx_shadow_get(priv, &idx);
+  hit = 0;
+
+  if (shadow != NULL)
+  {
+    /* serve the read from the shadow copy only if every byte is cached */
+    hit = 1;
+
+    for (i = 0; (i < len) && (hit == 1U); i++)
+    {
+      add = (uint16_t)reg + i;
+
+      if ((ism330dhcx_shadow_is_cached(idx, add) == 0U) ||
+          (((shadow->valid[idx][add / 8U] >> (add % 8U)) & 0x01U) == 0U))
+      {
+        hit = 0;
+      }
+    }
+
+    if (hit == 1U)
+    {
+      for (i = 0; i < len; i++)
+      {
+        data[i] = shadow->reg[idx][(uint16_t)reg + i];
+      }
+    }
+  }
+
+  if (hit == 1U)
+  {
+    ret = 0;
+  }
+
+  else
+  {
+    ret = ctx->read_reg(ctx->handle, reg, data, len);
+    ism330dhcx_stats_record(priv, 1, len, ret);
+
+    if (ret == 0)
+    {
+      ism330dhcx_shadow_update(priv, reg, data, len);
+    }
+
+    else
+    {
+      ism330dhcx_bank_abort(ctx, priv);
+    }
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
@@ -77,12 +376,142 @@ int32_t __weak ism330dhcx_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
 {
   int32_t ret;
 
+  ism330dhcx_priv_t *priv;
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_func_cfg_access_t func_cfg_access;
+
   if (ctx == NULL)
   {
     return -1;
   }
 
+  priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_lock(ctx);
   ret = ctx->write_reg(ctx->handle, reg, data, len);
+  ism330dhcx_stats_record(priv, 0, len, ret);
+
+  if (ret != 0)
+  {
+    ism330dhcx_bank_abort(ctx, priv);
+  }
+
+  if ((ret == 0) && (priv != NULL))
+  {
+    ism330dhcx_shadow_update(priv, reg, data, len);
+
+    if ((priv->bank_cache_en == PROPERTY_ENABLE) &&
+        (reg <= ISM330DHCX_FUNC_CFG_ACCESS) &&
+        (((uint16_t)reg + len) > ISM330DHCX_FUNC_CFG_ACCESS))
+    {
+      /* FUNC_CFG_ACCESS is mapped in every bank */
+      func_cfg_access = *(ism330dhcx_func_cfg_access_t *)
+                        &data[ISM330DHCX_FUNC_CFG_ACCESS - reg];
+      priv->bank = func_cfg_access.reg_access;
+      priv->bank_valid = PROPERTY_ENABLE;
+    }
+
+    if ((priv->shadow != NULL) && (priv->bank_valid == PROPERTY_ENABLE) &&
+        (priv->bank == (uint8_t)ISM330DHCX_USER_BANK) &&
+        (reg <= ISM330DHCX_CTRL3_C) &&
+        (((uint16_t)reg + len) > ISM330DHCX_CTRL3_C))
+    {
+      ctrl3_c = *(ism330dhcx_ctrl3_c_t *)&data[ISM330DHCX_CTRL3_C - reg];
+
+      if ((ctrl3_c.sw_reset | ctrl3_c.boot) != PROPERTY_DISABLE)
+      {
+        /* registers are restored by the device */
+        ism330dhcx_shadow_invalidate(priv->shadow);
+        priv->bank_valid = PROPERTY_DISABLE;
+      }
+    }
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Initialize an empty register write transaction
+  *
+  * @param  tx    transaction(ptr)
+  *
+  */
+void ism330dhcx_tx_init(ism330dhcx_tx_t *tx)
+{
+  tx->len = 0;
+}
+
+/**
+  * @brief  Queue a register write in a transaction
+  *
+  * @param  tx    transaction(ptr)
+  * @param  reg   first register to write
+  * @param  data  pointer to data to write(ptr)
+  * @param  len   number of consecutive register to write
+  * @retval       0 -> queued, -1 -> not enough room in the transaction
+  *
+  */
+int32_t ism330dhcx_tx_write(ism330dhcx_tx_t *tx, uint8_t reg,
+                            const uint8_t *data, uint16_t len)
+{
+  uint16_t i;
+
+  if (((uint16_t)tx->len + len) > ISM330DHCX_TX_MAX)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < len; i++)
+  {
+    tx->reg[tx->len] = (uint8_t)(reg + i);
+    tx->val[tx->len] = data[i];
+    tx->len++;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Issue the queued register writes, merging adjacent addresses
+  *         in burst writes. The transaction is emptied.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  tx    transaction(ptr)
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t ism330dhcx_tx_commit(const stmdev_ctx_t *ctx, ism330dhcx_tx_t *tx)
+{
+  uint8_t start;
+  uint8_t end;
+  int32_t ret = 0;
+
+  ism330dhcx_lock(ctx);
+  start = 0;
+
+  while ((ret == 0) && (start < tx->len))
+  {
+    end = start + 1U;
+
+    if (tx->reg[start] != ISM330DHCX_FUNC_CFG_ACCESS)
+    {
+      while ((end < tx->len) &&
+             (tx->reg[end] == (uint8_t)(tx->reg[end - 1U] + 1U)) &&
+             (tx->reg[end] != ISM330DHCX_FUNC_CFG_ACCESS))
+      {
+        end++;
+      }
+    }
+
+    ret = ism330dhcx_write_reg(ctx, tx->reg[start], &tx->val[start],
+                               (uint16_t)end - start);
+    start = end;
+  }
+
+  tx->len = 0;
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
@@ -159,59 +588,380 @@ uint64_t ism330dhcx_from_lsb_to_nsec(uint32_t lsb)
   return ((uint64_t)lsb * 25000ULL);
 }
 
+/*
+ * Sensitivities, exact in micro units, shared by the float and the
+ * fixed-point conversions.
+ */
+/* indexed by the FS_XL code [ug/LSB] */
+static const uint32_t ism330dhcx_xl_sens[4] =
+{
+  ISM330DHCX_XL_SENS_UG(0U), ISM330DHCX_XL_SENS_UG(1U),
+  ISM330DHCX_XL_SENS_UG(2U), ISM330DHCX_XL_SENS_UG(3U),
+};
+
+/* indexed by the fs_4000 + fs_125 + FS_G code [udps/LSB] */
+static const uint32_t ism330dhcx_gy_sens[16] =
+{
+  ISM330DHCX_GY_SENS_UDPS(0U),  ISM330DHCX_GY_SENS_UDPS(1U),
+  ISM330DHCX_GY_SENS_UDPS(2U),  ISM330DHCX_GY_SENS_UDPS(3U),
+  ISM330DHCX_GY_SENS_UDPS(4U),  ISM330DHCX_GY_SENS_UDPS(5U),
+  ISM330DHCX_GY_SENS_UDPS(6U),  ISM330DHCX_GY_SENS_UDPS(7U),
+  ISM330DHCX_GY_SENS_UDPS(8U),  ISM330DHCX_GY_SENS_UDPS(9U),
+  ISM330DHCX_GY_SENS_UDPS(10U), ISM330DHCX_GY_SENS_UDPS(11U),
+  ISM330DHCX_GY_SENS_UDPS(12U), ISM330DHCX_GY_SENS_UDPS(13U),
+  ISM330DHCX_GY_SENS_UDPS(14U), ISM330DHCX_GY_SENS_UDPS(15U),
+};
+
 /**
-  * @}
+  * @brief  Accelerometer sensitivity of a full scale.[get]
+  *
+  * @param  fs     Full scale
+  * @retval        Sensitivity [mg/LSB]
   *
   */
+float_t ism330dhcx_xl_sensitivity_get(ism330dhcx_fs_xl_t fs)
+{
+  return (float_t)ism330dhcx_xl_sens[(uint8_t)fs & 0x03U] / 1000.0f;
+}
 
 /**
-  * @defgroup   LSM9DS1_Data_generation
-  * @brief      This section groups all the functions concerning data
-  *             generation
-  * @{
+  * @brief  Gyroscope sensitivity of a full scale.[get]
+  *
+  * @param  fs     Full scale
+  * @retval        Sensitivity [mdps/LSB]
   *
   */
+float_t ism330dhcx_gy_sensitivity_get(ism330dhcx_fs_g_t fs)
+{
+  return (float_t)ism330dhcx_gy_sens[(uint8_t)fs & 0x0FU] / 1000.0f;
+}
 
 /**
-  * @brief  Accelerometer full-scale selection[set]
+  * @brief  Build the conversion factors of a pair of full scales, to be
+  *         called once whenever a full scale changes rather than
+  *         selecting a converter for every sample.
+  *
+  * @param  conv   Conversion factors.(ptr)
+  * @param  xl_fs  Accelerometer full scale
+  * @param  gy_fs  Gyroscope full scale
+  *
+  */
+void ism330dhcx_conv_set(ism330dhcx_conv_t *conv, ism330dhcx_fs_xl_t xl_fs,
+                         ism330dhcx_fs_g_t gy_fs)
+{
+  conv->xl_fs = xl_fs;
+  conv->gy_fs = gy_fs;
+  conv->xl_ug = ism330dhcx_xl_sens[(uint8_t)xl_fs & 0x03U];
+  conv->gy_udps = ism330dhcx_gy_sens[(uint8_t)gy_fs & 0x0FU];
+  conv->xl = (float_t)conv->xl_ug / 1000.0f;
+  conv->gy = (float_t)conv->gy_udps / 1000.0f;
+}
+
+/**
+  * @brief  Build the conversion factors of the full scales set in the
+  *         device, CTRL1_XL and CTRL2_G read together.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fs_xl in reg CTRL1_XL
+  * @param  conv   Conversion factors.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_full_scale_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_fs_xl_t val)
+int32_t ism330dhcx_conv_get(const stmdev_ctx_t *ctx, ism330dhcx_conv_t *conv)
 {
-  ism330dhcx_ctrl1_xl_t ctrl1_xl;
+  ism330dhcx_ctrl1_xl_t *ctrl1_xl;
+  ism330dhcx_ctrl2_g_t *ctrl2_g;
+  uint8_t buff[2];
   int32_t ret;
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
-                            (uint8_t *)&ctrl1_xl, 1);
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL, buff, 2);
 
   if (ret == 0)
   {
-    ctrl1_xl.fs_xl = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_XL,
-                               (uint8_t *)&ctrl1_xl, 1);
+    ctrl1_xl = (ism330dhcx_ctrl1_xl_t *)&buff[0];
+    ctrl2_g = (ism330dhcx_ctrl2_g_t *)&buff[1];
+    ism330dhcx_conv_set(conv, (ism330dhcx_fs_xl_t)ctrl1_xl->fs_xl,
+                        (ism330dhcx_fs_g_t)ctrl2_g->fs_g);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer full-scale selection.[get]
+  * @brief  Convert an array of raw values with a sensitivity. A plain
+  *         loop over contiguous buffers, left to the compiler to
+  *         vectorize for the target.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fs_xl in reg CTRL1_XL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Converted values, may not overlap lsb.(ptr)
+  * @param  len    Number of values
+  * @param  sens   Sensitivity [unit/LSB]
   *
   */
-int32_t ism330dhcx_xl_full_scale_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_fs_xl_t *val)
+void ism330dhcx_from_lsb_to_unit_array(const int16_t *lsb, float_t *val,
+                                       uint32_t len, float_t sens)
 {
-  ism330dhcx_ctrl1_xl_t ctrl1_xl;
-  int32_t ret;
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    val[i] = (float_t)lsb[i] * sens;
+  }
+}
+
+/**
+  * @brief  Convert an array of raw accelerations.
+  *
+  * @param  fs     Full scale of the raw values
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Accelerations [mg].(ptr)
+  * @param  len    Number of values
+  *
+  */
+void ism330dhcx_from_fs_xl_to_mg_array(ism330dhcx_fs_xl_t fs,
+                                       const int16_t *lsb, float_t *val,
+                                       uint32_t len)
+{
+  ism330dhcx_from_lsb_to_unit_array(lsb, val, len,
+                                    ism330dhcx_xl_sensitivity_get(fs));
+}
+
+/**
+  * @brief  Convert an array of raw angular rates.
+  *
+  * @param  fs     Full scale of the raw values
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Angular rates [mdps].(ptr)
+  * @param  len    Number of values
+  *
+  */
+void ism330dhcx_from_fs_g_to_mdps_array(ism330dhcx_fs_g_t fs,
+                                        const int16_t *lsb, float_t *val,
+                                        uint32_t len)
+{
+  ism330dhcx_from_lsb_to_unit_array(lsb, val, len,
+                                    ism330dhcx_gy_sensitivity_get(fs));
+}
+
+/**
+  * @brief  Convert an array of raw temperatures.
+  *
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Temperatures [degC].(ptr)
+  * @param  len    Number of values
+  *
+  */
+void ism330dhcx_from_lsb_to_celsius_array(const int16_t *lsb, float_t *val,
+                                          uint32_t len)
+{
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    val[i] = ((float_t)lsb[i] / 256.0f) + 25.0f;
+  }
+}
+
+/**
+  * @brief  Signed division rounded to nearest, half away from zero.
+  *
+  * @param  num    Dividend
+  * @param  den    Divisor, positive
+  * @retval        Rounded quotient
+  *
+  */
+static int32_t ism330dhcx_div_round(int64_t num, int64_t den)
+{
+  int64_t half = den / 2;
+  int64_t quot;
+
+  if (num >= 0)
+  {
+    quot = (num + half) / den;
+  }
+
+  else
+  {
+    quot = (num - half) / den;
+  }
+
+  return (int32_t)quot;
+}
+
+/**
+  * @brief  Raw value to Q16.16 unit: lsb * sens * 2^16 / 10^6, computed
+  *         in 64 bit and rounded to nearest, i.e. exactly
+  *         round(lsb * sens * 65536 / 1e6).
+  *
+  * @param  lsb    Raw value
+  * @param  sens   Sensitivity [ug/LSB or udps/LSB]
+  * @retval        Rounded value [Q16.16]
+  *
+  */
+static int32_t ism330dhcx_to_q16(int16_t lsb, uint32_t sens)
+{
+  return ism330dhcx_div_round((int64_t)lsb * (int64_t)sens * 65536,
+                              1000000);
+}
+
+/**
+  * @brief  Raw acceleration to Q16.16 g, for targets without FPU.
+  *
+  * @param  fs     Full scale of the raw value
+  * @param  lsb    Raw value
+  * @retval        Acceleration [g, Q16.16], rounded to nearest
+  *
+  */
+int32_t ism330dhcx_from_fs_xl_to_g_q16(ism330dhcx_fs_xl_t fs, int16_t lsb)
+{
+  return ism330dhcx_to_q16(lsb, ism330dhcx_xl_sens[(uint8_t)fs & 0x03U]);
+}
+
+/**
+  * @brief  Raw angular rate to Q16.16 dps, for targets without FPU.
+  *
+  * @param  fs     Full scale of the raw value
+  * @param  lsb    Raw value
+  * @retval        Angular rate [dps, Q16.16], rounded to nearest
+  *
+  */
+int32_t ism330dhcx_from_fs_g_to_dps_q16(ism330dhcx_fs_g_t fs, int16_t lsb)
+{
+  return ism330dhcx_to_q16(lsb, ism330dhcx_gy_sens[(uint8_t)fs & 0x0FU]);
+}
+
+/**
+  * @brief  Raw temperature to hundredths of degC, for targets without
+  *         FPU.
+  *
+  * @param  lsb    Raw value
+  * @retval        Temperature [cdegC], rounded to nearest
+  *
+  */
+int32_t ism330dhcx_from_lsb_to_cdegc(int16_t lsb)
+{
+  return ism330dhcx_div_round((int64_t)lsb * 100, 256) + 2500;
+}
+
+/**
+  * @brief  Convert an array of raw accelerations to Q16.16 g.
+  *
+  * @param  fs     Full scale of the raw values
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Accelerations [g, Q16.16].(ptr)
+  * @param  len    Number of values
+  *
+  */
+void ism330dhcx_from_fs_xl_to_g_q16_array(ism330dhcx_fs_xl_t fs,
+                                          const int16_t *lsb, int32_t *val,
+                                          uint32_t len)
+{
+  uint32_t sens = ism330dhcx_xl_sens[(uint8_t)fs & 0x03U];
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    val[i] = ism330dhcx_to_q16(lsb[i], sens);
+  }
+}
+
+/**
+  * @brief  Convert an array of raw angular rates to Q16.16 dps.
+  *
+  * @param  fs     Full scale of the raw values
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Angular rates [dps, Q16.16].(ptr)
+  * @param  len    Number of values
+  *
+  */
+void ism330dhcx_from_fs_g_to_dps_q16_array(ism330dhcx_fs_g_t fs,
+                                           const int16_t *lsb, int32_t *val,
+                                           uint32_t len)
+{
+  uint32_t sens = ism330dhcx_gy_sens[(uint8_t)fs & 0x0FU];
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    val[i] = ism330dhcx_to_q16(lsb[i], sens);
+  }
+}
+
+/**
+  * @brief  Convert an array of raw temperatures to hundredths of degC.
+  *
+  * @param  lsb    Raw values.(ptr)
+  * @param  val    Temperatures [cdegC].(ptr)
+  * @param  len    Number of values
+  *
+  */
+void ism330dhcx_from_lsb_to_cdegc_array(const int16_t *lsb, int32_t *val,
+                                        uint32_t len)
+{
+  uint32_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    val[i] = ism330dhcx_div_round((int64_t)lsb[i] * 100, 256) + 2500;
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   LSM9DS1_Data_generation
+  * @brief      This section groups all the functions concerning data
+  *             generation
+  * @{
+  *
+  */
+
+/**
+  * @brief  Accelerometer full-scale selection[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fs_xl in reg CTRL1_XL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_xl_full_scale_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_fs_xl_t val)
+{
+  ism330dhcx_ctrl1_xl_t ctrl1_xl;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
+                            (uint8_t *)&ctrl1_xl, 1);
+
+  if (ret == 0)
+  {
+    ctrl1_xl.fs_xl = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_XL,
+                               (uint8_t *)&ctrl1_xl, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Accelerometer full-scale selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fs_xl in reg CTRL1_XL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_xl_full_scale_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_fs_xl_t *val)
+{
+  ism330dhcx_ctrl1_xl_t ctrl1_xl;
+  int32_t ret;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
                             (uint8_t *)&ctrl1_xl, 1);
 
   switch (ctrl1_xl.fs_xl)
@@ -259,6 +1009,7 @@ int32_t ism330dhcx_xl_data_rate_set(const stmdev_ctx_t *ctx,
   ism330dhcx_ctrl1_xl_t ctrl1_xl;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   /* Check the Finite State Machine data rate constraints */
   ret =  ism330dhcx_fsm_enable_get(ctx, &fsm_enable);
 
@@ -495,6 +1246,8 @@ int32_t ism330dhcx_xl_data_rate_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl1_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -585,6 +1338,8 @@ int32_t ism330dhcx_gy_full_scale_set(const stmdev_ctx_t *ctx,
 {
   ism330dhcx_ctrl2_g_t ctrl2_g;
   int32_t ret;
+
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_G,
                             (uint8_t *)&ctrl2_g, 1);
 
@@ -595,6 +1350,8 @@ int32_t ism330dhcx_gy_full_scale_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl2_g, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -667,6 +1424,7 @@ int32_t ism330dhcx_gy_data_rate_set(const stmdev_ctx_t *ctx,
   ism330dhcx_ctrl2_g_t ctrl2_g;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   /* Check the Finite State Machine data rate constraints */
   ret =  ism330dhcx_fsm_enable_get(ctx, &fsm_enable);
 
@@ -903,6 +1661,8 @@ int32_t ism330dhcx_gy_data_rate_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl2_g, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -989,6 +1749,8 @@ int32_t ism330dhcx_block_data_update_set(const stmdev_ctx_t *ctx,
 {
   ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
+
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
                             (uint8_t *)&ctrl3_c, 1);
 
@@ -999,6 +1761,8 @@ int32_t ism330dhcx_block_data_update_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl3_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1036,6 +1800,8 @@ int32_t ism330dhcx_xl_offset_weight_set(const stmdev_ctx_t *ctx,
 {
   ism330dhcx_ctrl6_c_t ctrl6_c;
   int32_t ret;
+
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
                             (uint8_t *)&ctrl6_c, 1);
 
@@ -1046,6 +1812,8 @@ int32_t ism330dhcx_xl_offset_weight_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl6_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1097,6 +1865,8 @@ int32_t ism330dhcx_xl_power_mode_set(const stmdev_ctx_t *ctx,
 {
   ism330dhcx_ctrl6_c_t ctrl6_c;
   int32_t ret;
+
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
                             (uint8_t *)&ctrl6_c, 1);
 
@@ -1107,6 +1877,8 @@ int32_t ism330dhcx_xl_power_mode_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl6_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1157,6 +1929,8 @@ int32_t ism330dhcx_gy_power_mode_set(const stmdev_ctx_t *ctx,
 {
   ism330dhcx_ctrl7_g_t ctrl7_g;
   int32_t ret;
+
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
                             (uint8_t *)&ctrl7_g, 1);
 
@@ -1167,6 +1941,8 @@ int32_t ism330dhcx_gy_power_mode_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl7_g, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1219,6 +1995,7 @@ int32_t ism330dhcx_all_sources_get(const stmdev_ctx_t *ctx,
 {
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_ALL_INT_SRC,
                             (uint8_t *)&val->all_int_src, 1);
 
@@ -1274,6 +2051,8 @@ int32_t ism330dhcx_all_sources_get(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1491,6 +2270,7 @@ int32_t ism330dhcx_xl_usr_offset_set(const stmdev_ctx_t *ctx, uint8_t val)
   ism330dhcx_ctrl7_g_t ctrl7_g;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
                             (uint8_t *)&ctrl7_g, 1);
 
@@ -1501,6 +2281,8 @@ int32_t ism330dhcx_xl_usr_offset_set(const stmdev_ctx_t *ctx, uint8_t val)
                                (uint8_t *)&ctrl7_g, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1563,6 +2345,7 @@ int32_t ism330dhcx_timestamp_set(const stmdev_ctx_t *ctx, uint8_t val)
   ism330dhcx_ctrl10_c_t ctrl10_c;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL10_C,
                             (uint8_t *)&ctrl10_c, 1);
 
@@ -1573,6 +2356,8 @@ int32_t ism330dhcx_timestamp_set(const stmdev_ctx_t *ctx, uint8_t val)
                                (uint8_t *)&ctrl10_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1646,6 +2431,7 @@ int32_t ism330dhcx_rounding_mode_set(const stmdev_ctx_t *ctx,
   ism330dhcx_ctrl5_c_t ctrl5_c;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
                             (uint8_t *)&ctrl5_c, 1);
 
@@ -1656,6 +2442,8 @@ int32_t ism330dhcx_rounding_mode_set(const stmdev_ctx_t *ctx,
                                (uint8_t *)&ctrl5_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1805,21 +2593,47 @@ int32_t ism330dhcx_fifo_out_raw_get(const stmdev_ctx_t *ctx, uint8_t *buff)
 int32_t ism330dhcx_number_of_steps_get(const stmdev_ctx_t *ctx,
                                        uint16_t *val)
 {
-  uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_emb_session_start(ctx);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STEP_COUNTER_L, buff, 2);
-    *val = buff[1];
-    *val = (*val * 256U) +  buff[0];
+    ret = ism330dhcx_number_of_steps_emb_get(ctx, val);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ret = ism330dhcx_emb_session_stop(ctx);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Step counter output register, to be used inside an embedded
+  *         functions bank session.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Step counter value.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_number_of_steps_emb_get(const stmdev_ctx_t *ctx,
+                                           uint16_t *val)
+{
+  uint8_t buff[2];
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STEP_COUNTER_L, buff, 2);
+
+  if (ret == 0)
+  {
+    *val = buff[1];
+    *val = (*val * 256U) +  buff[0];
   }
 
   return ret;
@@ -1837,6 +2651,7 @@ int32_t ism330dhcx_steps_reset(const stmdev_ctx_t *ctx)
   ism330dhcx_emb_func_src_t emb_func_src;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
@@ -1857,6 +2672,8 @@ int32_t ism330dhcx_steps_reset(const stmdev_ctx_t *ctx)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1885,6 +2702,7 @@ int32_t ism330dhcx_device_conf_set(const stmdev_ctx_t *ctx, uint8_t val)
   ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
                             (uint8_t *)&ctrl9_xl, 1);
 
@@ -1895,6 +2713,8 @@ int32_t ism330dhcx_device_conf_set(const stmdev_ctx_t *ctx, uint8_t val)
                                (uint8_t *)&ctrl9_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -1952,19 +2772,68 @@ int32_t ism330dhcx_odr_cal_reg_get(const stmdev_ctx_t *ctx, int8_t *val)
 int32_t ism330dhcx_mem_bank_set(const stmdev_ctx_t *ctx,
                                 ism330dhcx_reg_access_t val)
 {
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
   ism330dhcx_func_cfg_access_t func_cfg_access;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
-                            (uint8_t *)&func_cfg_access, 1);
+  /* lock_held is only accessed with the lock taken, i.e. by its owner */
+  ism330dhcx_lock(ctx);
 
-  if (ret == 0)
+  if ((priv != NULL) && (priv->bank_cache_en == PROPERTY_ENABLE) &&
+      (priv->bank_valid == PROPERTY_ENABLE) && (priv->bank == (uint8_t)val))
+  {
+    ret = 0;
+  }
+
+  else if ((priv != NULL) && (priv->bank_cache_en == PROPERTY_ENABLE) &&
+           (priv->bank_valid == PROPERTY_ENABLE))
   {
+    /* other bits of FUNC_CFG_ACCESS must be kept to 0: no read needed */
+    func_cfg_access.not_used_01 = 0;
     func_cfg_access.reg_access = (uint8_t)val;
     ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
                                (uint8_t *)&func_cfg_access, 1);
   }
 
+  else
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
+                              (uint8_t *)&func_cfg_access, 1);
+
+    if (ret == 0)
+    {
+      func_cfg_access.reg_access = (uint8_t)val;
+      ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
+                                 (uint8_t *)&func_cfg_access, 1);
+    }
+  }
+
+  if ((priv != NULL) && (priv->bank_cache_en == PROPERTY_ENABLE))
+  {
+    priv->bank = (uint8_t)val;
+    priv->bank_valid = (ret == 0) ? PROPERTY_ENABLE : PROPERTY_DISABLE;
+  }
+
+  if ((priv != NULL) && (ret == 0) && (val != ISM330DHCX_USER_BANK) &&
+      (priv->lock_held == PROPERTY_DISABLE))
+  {
+    /* keep this level until the user bank is selected back */
+    priv->lock_held = PROPERTY_ENABLE;
+  }
+
+  else
+  {
+    if ((priv != NULL) && (priv->lock_held == PROPERTY_ENABLE) &&
+        (val == ISM330DHCX_USER_BANK))
+    {
+      /* end of the bank sequence of the lock owner */
+      priv->lock_held = PROPERTY_DISABLE;
+      ism330dhcx_unlock(ctx);
+    }
+
+    ism330dhcx_unlock(ctx);
+  }
+
   return ret;
 }
 
@@ -1980,11 +2849,22 @@ int32_t ism330dhcx_mem_bank_set(const stmdev_ctx_t *ctx,
 int32_t ism330dhcx_mem_bank_get(const stmdev_ctx_t *ctx,
                                 ism330dhcx_reg_access_t *val)
 {
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
   ism330dhcx_func_cfg_access_t func_cfg_access;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
-                            (uint8_t *)&func_cfg_access, 1);
+  if ((priv != NULL) && (priv->bank_cache_en == PROPERTY_ENABLE) &&
+      (priv->bank_valid == PROPERTY_ENABLE))
+  {
+    func_cfg_access.reg_access = priv->bank;
+    ret = 0;
+  }
+
+  else
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
+                              (uint8_t *)&func_cfg_access, 1);
+  }
 
   switch (func_cfg_access.reg_access)
   {
@@ -2009,191 +2889,264 @@ int32_t ism330dhcx_mem_bank_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Write a line(byte) in a page.[set]
+  * @brief  Take the interface lock, if any, to run several driver calls
+  *         atomically with respect to other users of the device. Every
+  *         driver call doing more than one bus access takes it as well:
+  *         the lock must be recursive.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  add    Page line address
-  * @param  val    Value to write
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_ln_pg_write_byte(const stmdev_ctx_t *ctx, uint16_t add,
-                                    uint8_t *val)
+void ism330dhcx_lock(const stmdev_ctx_t *ctx)
 {
-  ism330dhcx_page_rw_t page_rw;
-  ism330dhcx_page_sel_t page_sel;
-  ism330dhcx_page_address_t page_address;
-  int32_t ret;
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-
-  if (ret == 0)
+  if ((priv != NULL) && (priv->lock != NULL))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
+    priv->lock(priv->lock_handle);
   }
+}
 
-  if (ret == 0)
-  {
-    page_rw.page_rw = 0x02U; /* page_write enable */
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
-  }
+/**
+  * @brief  Release the interface lock taken by ism330dhcx_lock(), once
+  *         per ism330dhcx_lock() call of the same thread.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  *
+  */
+void ism330dhcx_unlock(const stmdev_ctx_t *ctx)
+{
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
 
-  if (ret == 0)
+  if ((priv != NULL) && (priv->lock != NULL))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
-                              (uint8_t *)&page_sel, 1);
+    priv->unlock(priv->lock_handle);
   }
+}
 
-  if (ret == 0)
+/**
+  * @brief  Start an embedded functions bank session: select the embedded
+  *         functions bank once for a batch of *_emb_get calls.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_emb_session_start(const stmdev_ctx_t *ctx)
+{
+  return ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+}
+
+/**
+  * @brief  Stop an embedded functions bank session: restore the user bank.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_emb_session_stop(const stmdev_ctx_t *ctx)
+{
+  return ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+}
+
+/**
+  * @brief  Keep track of the selected memory bank in the driver private
+  *         data, so that redundant FUNC_CFG_ACCESS accesses are skipped.
+  *         ctx->priv_data must point to an ism330dhcx_priv_t.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    PROPERTY_ENABLE / PROPERTY_DISABLE
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_bank_cache_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_func_cfg_access_t func_cfg_access;
+  int32_t ret = 0;
+
+  if (priv == NULL)
   {
-    page_sel.page_sel = (uint8_t)((add / 256U) & 0x0FU);
-    page_sel.not_used_01 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
-                               (uint8_t *)&page_sel, 1);
+    return -1;
   }
 
-  if (ret == 0)
+  ism330dhcx_lock(ctx);
+  priv->bank_cache_en = PROPERTY_DISABLE;
+  priv->bank_valid = PROPERTY_DISABLE;
+
+  if (val != PROPERTY_DISABLE)
   {
-    page_address.page_addr = (uint8_t)(add - (page_sel.page_sel * 256U));
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_ADDRESS,
-                               (uint8_t *)&page_address, 1);
+    /* seed the cache with the bank currently selected on the device */
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS,
+                              (uint8_t *)&func_cfg_access, 1);
+
+    if (ret == 0)
+    {
+      priv->bank = func_cfg_access.reg_access;
+      priv->bank_valid = PROPERTY_ENABLE;
+    }
+
+    priv->bank_cache_en = PROPERTY_ENABLE;
   }
 
-  if (ret == 0)
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Keep track of the selected memory bank in the driver private
+  *         data.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    PROPERTY_ENABLE / PROPERTY_DISABLE
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_bank_cache_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+
+  if (priv == NULL)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_VALUE, val, 1);
+    *val = PROPERTY_DISABLE;
   }
 
-  if (ret == 0)
+  else
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
+    *val = priv->bank_cache_en;
   }
 
-  if (ret == 0)
+  return 0;
+}
+
+/**
+  * @brief  Attach a write-through shadow copy of the configuration
+  *         registers: read-modify-write sequences on cached registers
+  *         then access the bus only for the write. The memory bank cache
+  *         is enabled as well. ctx->priv_data must point to an
+  *         ism330dhcx_priv_t. Pass NULL to detach it.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Shadow copy storage, owned by the application.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_shadow_set(const stmdev_ctx_t *ctx,
+                              ism330dhcx_shadow_t *val)
+{
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  int32_t ret = 0;
+
+  if (priv == NULL)
   {
-    page_rw.page_rw = 0x00; /* page_write disable */
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
+    return -1;
   }
 
-  if (ret == 0)
+  ism330dhcx_lock(ctx);
+  priv->shadow = NULL;
+
+  if (val != NULL)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ism330dhcx_shadow_invalidate(val);
+
+    if (priv->bank_cache_en == PROPERTY_DISABLE)
+    {
+      ret = ism330dhcx_bank_cache_set(ctx, PROPERTY_ENABLE);
+    }
+
+    if (ret == 0)
+    {
+      priv->shadow = val;
+    }
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Write buffer in a page.[set]
+  * @brief  Refill the whole shadow copy from the device, e.g. after
+  *         ism330dhcx_reset_set().
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buf    Page line address.(ptr)
-  * @param  val    Value to write.
-  * @param  len    buffer length.
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t add,
-                               uint8_t *buf, uint8_t len)
+int32_t ism330dhcx_shadow_sync(const stmdev_ctx_t *ctx)
 {
-  ism330dhcx_page_rw_t page_rw;
-  ism330dhcx_page_sel_t page_sel;
-  ism330dhcx_page_address_t page_address;
-  uint8_t msb;
-  uint8_t lsb;
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  uint8_t buff[ISM330DHCX_CTRL10_C - ISM330DHCX_FIFO_CTRL1 + 1U];
   int32_t ret;
-  uint8_t i ;
 
-  msb = (uint8_t)((add / 256U) & 0x0FU);
-  lsb = (uint8_t)(add - (msb * 256U));
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  if ((priv == NULL) || (priv->shadow == NULL))
+  {
+    return -1;
+  }
+
+  ism330dhcx_lock(ctx);
+  ism330dhcx_shadow_invalidate(priv->shadow);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL, buff, 1);
   }
 
   if (ret == 0)
   {
-    page_rw.page_rw = 0x02U; /* page_write enable*/
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL1, buff,
+                              ISM330DHCX_CTRL10_C - ISM330DHCX_FIFO_CTRL1 + 1U);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
-                              (uint8_t *)&page_sel, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0, buff,
+                              ISM330DHCX_MD2_CFG - ISM330DHCX_TAP_CFG0 + 1U);
   }
 
   if (ret == 0)
   {
-    page_sel.page_sel = msb;
-    page_sel.not_used_01 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
-                               (uint8_t *)&page_sel, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INTERNAL_FREQ_FINE, buff, 1);
   }
 
   if (ret == 0)
   {
-    page_address.page_addr = lsb;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_ADDRESS,
-                               (uint8_t *)&page_address, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_X_OFS_USR, buff, 3);
   }
 
-  for (i = 0; i < len; i++)
+  if (ret == 0)
   {
-    if (ret == 0)
-    {
-      ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_VALUE, &buf[i], 1);
-
-      if (ret == 0)
-      {
-        /* Check if page wrap */
-        if (lsb == 0x00U)
-        {
-          msb++;
-          ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
-                                    (uint8_t *)&page_sel, 1);
-        }
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  }
 
-        lsb++;
-      }
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A, buff, 2);
+  }
 
-      if (ret == 0)
-      {
-        page_sel.page_sel = msb;
-        page_sel.not_used_01 = 1;
-        ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
-                                   (uint8_t *)&page_sel, 1);
-      }
-    }
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INT1, buff,
+                              ISM330DHCX_MLC_INT2 - ISM330DHCX_EMB_FUNC_INT1 + 1U);
   }
 
   if (ret == 0)
   {
-    page_sel.page_sel = 0;
-    page_sel.not_used_01 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
-                               (uint8_t *)&page_sel, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW, buff, 1);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG, buff,
+                              ISM330DHCX_FSM_ENABLE_B -
+                              ISM330DHCX_EMB_FUNC_FIFO_CFG + 1U);
   }
 
   if (ret == 0)
   {
-    page_rw.page_rw = 0x00U; /* page_write disable */
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B, buff, 2);
   }
 
   if (ret == 0)
@@ -2201,437 +3154,575 @@ int32_t ism330dhcx_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t add,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Read a line(byte) in a page.[get]
+  * @brief  Attach bus usage statistics. Counters are cleared.
+  *         ctx->priv_data must point to an ism330dhcx_priv_t.
+  *         Pass NULL to detach them.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  add    Page line address.
-  * @param  val    Read value.(ptr)
+  * @param  val    Statistics storage, owned by the application.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_ln_pg_read_byte(const stmdev_ctx_t *ctx, uint16_t add,
-                                   uint8_t *val)
+int32_t ism330dhcx_stats_set(const stmdev_ctx_t *ctx,
+                             ism330dhcx_stats_t *val)
 {
-  ism330dhcx_page_rw_t page_rw;
-  ism330dhcx_page_sel_t page_sel;
-  ism330dhcx_page_address_t page_address;
-  int32_t ret;
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  uint8_t *p;
+  uint32_t i;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  if (priv == NULL)
+  {
+    return -1;
+  }
 
-  if (ret == 0)
+  if (val != NULL)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
+    p = (uint8_t *)val->entry;
+
+    for (i = 0; i < sizeof(val->entry); i++)
+    {
+      p[i] = 0;
+    }
+
+    val->entry[0].name = "other";
+    val->len = 1;
+    val->cur = 0;
+    val->depth = 0;
+    val->start = 0;
   }
 
-  if (ret == 0)
+  priv->stats = val;
+
+  return 0;
+}
+
+/**
+  * @brief  Start charging bus accesses to the named API call. Nested
+  *         calls are charged to the outermost one. Not serialized
+  *         against other bus users: see ism330dhcx_stats_t.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  name   API name, must stay valid while statistics are in use.(ptr)
+  *
+  */
+void ism330dhcx_stats_begin(const stmdev_ctx_t *ctx, const char *name)
+{
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_stats_t *stats;
+  const char *a;
+  const char *b;
+  uint8_t i;
+
+  if ((priv == NULL) || (priv->stats == NULL))
   {
-    page_rw.page_rw = 0x01U; /* page_read enable*/
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
+    return;
   }
 
-  if (ret == 0)
+  stats = priv->stats;
+  stats->depth++;
+
+  if (stats->depth > 1U)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
-                              (uint8_t *)&page_sel, 1);
+    return;
   }
 
-  if (ret == 0)
+  /* look for the entry, allocate it if missing; fall back on "other" */
+  stats->cur = 0;
+
+  for (i = 1; (i < stats->len) && (stats->cur == 0U); i++)
   {
-    page_sel.page_sel = (uint8_t)((add / 256U) & 0x0FU);
-    page_sel.not_used_01 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
-                               (uint8_t *)&page_sel, 1);
+    a = stats->entry[i].name;
+    b = name;
+
+    while ((*a != '\0') && (*a == *b))
+    {
+      a++;
+      b++;
+    }
+
+    if (*a == *b)
+    {
+      stats->cur = i;
+    }
   }
 
-  if (ret == 0)
+  if ((stats->cur == 0U) && (stats->len < ISM330DHCX_STATS_MAX))
   {
-    page_address.page_addr = (uint8_t)(add - (page_sel.page_sel * 256U));
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_ADDRESS,
-                               (uint8_t *)&page_address, 1);
+    stats->cur = stats->len;
+    stats->entry[stats->cur].name = name;
+    stats->len++;
   }
 
-  if (ret == 0)
+  stats->entry[stats->cur].calls++;
+
+  if (stats->tick_get != NULL)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_VALUE, val, 2);
+    stats->start = stats->tick_get();
   }
+}
 
-  if (ret == 0)
+/**
+  * @brief  Stop charging bus accesses to the API call in progress and
+  *         record its latency.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  *
+  */
+void ism330dhcx_stats_end(const stmdev_ctx_t *ctx)
+{
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_stats_t *stats;
+  uint32_t elapsed;
+  uint8_t bin;
+
+  if ((priv == NULL) || (priv->stats == NULL) || (priv->stats->depth == 0U))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
+    return;
   }
 
-  if (ret == 0)
+  stats = priv->stats;
+  stats->depth--;
+
+  if (stats->depth > 0U)
   {
-    page_rw.page_rw = 0x00U; /* page_read disable */
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
+    return;
   }
 
-  if (ret == 0)
+  if (stats->tick_get != NULL)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    elapsed = stats->tick_get() - stats->start;
+    bin = 0;
+
+    while ((elapsed != 0U) && (bin < (ISM330DHCX_STATS_HIST_LEN - 1U)))
+    {
+      elapsed /= 2U;
+      bin++;
+    }
+
+    stats->entry[stats->cur].hist[bin]++;
   }
 
-  return ret;
+  stats->cur = 0;
 }
 
 /**
-  * @brief  Data-ready pulsed / letched mode.[set]
+  * @brief  Report every statistics entry in use.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of dataready_pulsed in
-  *                reg COUNTER_BDR_REG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  print  Application routine called once per entry.(ptr)
   *
   */
-int32_t ism330dhcx_data_ready_mode_set(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_dataready_pulsed_t val)
+void ism330dhcx_stats_dump(const stmdev_ctx_t *ctx,
+                           ism330dhcx_stats_print_ptr print)
 {
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  uint8_t i;
 
-  if (ret == 0)
+  if ((print == NULL) || (priv == NULL) || (priv->stats == NULL))
   {
-    counter_bdr_reg1.dataready_pulsed = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                               (uint8_t *)&counter_bdr_reg1, 1);
+    return;
   }
 
-  return ret;
+  for (i = 0; i < priv->stats->len; i++)
+  {
+    print(&priv->stats->entry[i]);
+  }
 }
 
 /**
-  * @brief  Data-ready pulsed / letched mode.[get]
+  * @brief  Latency percentile of a statistics entry, from its
+  *         histogram.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of dataready_pulsed in
-  *                reg COUNTER_BDR_REG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  val    Statistics entry.(ptr)
+  * @param  pct    Percentile, 1 to 100
+  * @retval        Upper bound of the percentile [ticks], 2^n for bin n;
+  *                0 if no latency was recorded
   *
   */
-int32_t ism330dhcx_data_ready_mode_get(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_dataready_pulsed_t *val)
+uint32_t ism330dhcx_stats_percentile_get(const ism330dhcx_stats_entry_t *val,
+                                         uint8_t pct)
 {
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
-  int32_t ret;
+  uint32_t total = 0;
+  uint32_t sum = 0;
+  uint32_t need;
+  uint8_t bin;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
-
-  switch (counter_bdr_reg1.dataready_pulsed)
+  for (bin = 0; bin < ISM330DHCX_STATS_HIST_LEN; bin++)
   {
-    case ISM330DHCX_DRDY_LATCHED:
-      *val = ISM330DHCX_DRDY_LATCHED;
-      break;
-
-    case ISM330DHCX_DRDY_PULSED:
-      *val = ISM330DHCX_DRDY_PULSED;
-      break;
+    total += val->hist[bin];
+  }
 
-    default:
-      *val = ISM330DHCX_DRDY_LATCHED;
-      break;
+  if (total == 0U)
+  {
+    return 0;
   }
 
-  return ret;
-}
+  need = (uint32_t)(((uint64_t)total * pct + 99U) / 100U);
 
-/**
-  * @brief  Device Who am I.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff)
-{
-  int32_t ret;
+  for (bin = 0; bin < (ISM330DHCX_STATS_HIST_LEN - 1U); bin++)
+  {
+    sum += val->hist[bin];
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WHO_AM_I, buff, 1);
+    if (sum >= need)
+    {
+      break;
+    }
+  }
 
-  return ret;
+  return (uint32_t)1U << bin;
 }
 
 /**
-  * @brief  Software reset. Restore the default values in user registers.[set]
+  * @brief  Write a line(byte) in a page.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sw_reset in reg CTRL3_C
+  * @param  add    Page line address
+  * @param  val    Value to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_reset_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_ln_pg_write_byte(const stmdev_ctx_t *ctx, uint16_t add,
+                                    uint8_t *val)
 {
-  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_page_rw_t page_rw;
+  ism330dhcx_page_sel_t page_sel;
+  ism330dhcx_page_address_t page_address;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ctrl3_c.sw_reset = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
-                               (uint8_t *)&ctrl3_c, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Software reset. Restore the default values in user registers.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sw_reset in reg CTRL3_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_reset_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  ism330dhcx_ctrl3_c_t ctrl3_c;
-  int32_t ret;
+  if (ret == 0)
+  {
+    page_rw.page_rw = 0x02U; /* page_write enable */
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
-  *val = ctrl3_c.sw_reset;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
+                              (uint8_t *)&page_sel, 1);
+  }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    page_sel.page_sel = (uint8_t)((add / 256U) & 0x0FU);
+    page_sel.not_used_01 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
+                               (uint8_t *)&page_sel, 1);
+  }
 
-/**
-  * @brief  Register address automatically incremented during a multiple byte
-  *         access with a serial interface.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of if_inc in reg CTRL3_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_auto_increment_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  ism330dhcx_ctrl3_c_t ctrl3_c;
-  int32_t ret;
+  if (ret == 0)
+  {
+    page_address.page_addr = (uint8_t)(add - (page_sel.page_sel * 256U));
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_ADDRESS,
+                               (uint8_t *)&page_address, 1);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_VALUE, val, 1);
+  }
 
   if (ret == 0)
   {
-    ctrl3_c.if_inc = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
-                               (uint8_t *)&ctrl3_c, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    page_rw.page_rw = 0x00; /* page_write disable */
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
 
-/**
-  * @brief  Register address automatically incremented during a multiple byte
-  *         access with a serial interface.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of if_inc in reg CTRL3_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_auto_increment_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  ism330dhcx_ctrl3_c_t ctrl3_c;
-  int32_t ret;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
-  *val = ctrl3_c.if_inc;
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Reboot memory content. Reload the calibration parameters.[set]
+  * @brief  Write buffer in a page.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of boot in reg CTRL3_C
+  * @param  buf    Page line address.(ptr)
+  * @param  val    Value to write.
+  * @param  len    buffer length.
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_boot_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t add,
+                               uint8_t *buf, uint8_t len)
 {
-  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_page_rw_t page_rw;
+  ism330dhcx_page_sel_t page_sel;
+  ism330dhcx_page_address_t page_address;
+  uint8_t msb;
+  uint8_t lsb;
   int32_t ret;
+  uint8_t i ;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  ism330dhcx_lock(ctx);
+  msb = (uint8_t)((add / 256U) & 0x0FU);
+  lsb = (uint8_t)(add - (msb * 256U));
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ctrl3_c.boot = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
-                               (uint8_t *)&ctrl3_c, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Reboot memory content. Reload the calibration parameters.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of boot in reg CTRL3_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_boot_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  ism330dhcx_ctrl3_c_t ctrl3_c;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
-  *val = ctrl3_c.boot;
-
-  return ret;
-}
-
-
-
-/**
-  * @brief  Linear acceleration sensor self-test enable.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of st_xl in reg CTRL5_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_xl_self_test_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_st_xl_t val)
-{
-  ism330dhcx_ctrl5_c_t ctrl5_c;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
-                            (uint8_t *)&ctrl5_c, 1);
+  if (ret == 0)
+  {
+    page_rw.page_rw = 0x02U; /* page_write enable*/
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
 
   if (ret == 0)
   {
-    ctrl5_c.st_xl = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL5_C,
-                               (uint8_t *)&ctrl5_c, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
+                              (uint8_t *)&page_sel, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    page_sel.page_sel = msb;
+    page_sel.not_used_01 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
+                               (uint8_t *)&page_sel, 1);
+  }
+
+  if (ret == 0)
+  {
+    page_address.page_addr = lsb;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_ADDRESS,
+                               (uint8_t *)&page_address, 1);
+  }
+
+  for (i = 0; i < len; i++)
+  {
+    if (ret == 0)
+    {
+      ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_VALUE, &buf[i], 1);
+
+      if (ret == 0)
+      {
+        /* Check if page wrap */
+        if (lsb == 0x00U)
+        {
+          msb++;
+          ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
+                                    (uint8_t *)&page_sel, 1);
+        }
+
+        lsb++;
+      }
+
+      if (ret == 0)
+      {
+        page_sel.page_sel = msb;
+        page_sel.not_used_01 = 1;
+        ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
+                                   (uint8_t *)&page_sel, 1);
+      }
+    }
+  }
+
+  if (ret == 0)
+  {
+    page_sel.page_sel = 0;
+    page_sel.not_used_01 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
+                               (uint8_t *)&page_sel, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    page_rw.page_rw = 0x00U; /* page_write disable */
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
 
 /**
-  * @brief  Linear acceleration sensor self-test enable.[get]
+  * @brief  Read a line(byte) in a page.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st_xl in reg CTRL5_C
+  * @param  add    Page line address.
+  * @param  val    Read value.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_self_test_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_st_xl_t *val)
+int32_t ism330dhcx_ln_pg_read_byte(const stmdev_ctx_t *ctx, uint16_t add,
+                                   uint8_t *val)
 {
-  ism330dhcx_ctrl5_c_t ctrl5_c;
+  ism330dhcx_page_rw_t page_rw;
+  ism330dhcx_page_sel_t page_sel;
+  ism330dhcx_page_address_t page_address;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
-                            (uint8_t *)&ctrl5_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
-  switch (ctrl5_c.st_xl)
+  if (ret == 0)
   {
-    case ISM330DHCX_XL_ST_DISABLE:
-      *val = ISM330DHCX_XL_ST_DISABLE;
-      break;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
+  }
 
-    case ISM330DHCX_XL_ST_POSITIVE:
-      *val = ISM330DHCX_XL_ST_POSITIVE;
-      break;
+  if (ret == 0)
+  {
+    page_rw.page_rw = 0x01U; /* page_read enable*/
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
 
-    case ISM330DHCX_XL_ST_NEGATIVE:
-      *val = ISM330DHCX_XL_ST_NEGATIVE;
-      break;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_SEL,
+                              (uint8_t *)&page_sel, 1);
+  }
 
-    default:
-      *val = ISM330DHCX_XL_ST_DISABLE;
-      break;
+  if (ret == 0)
+  {
+    page_sel.page_sel = (uint8_t)((add / 256U) & 0x0FU);
+    page_sel.not_used_01 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_SEL,
+                               (uint8_t *)&page_sel, 1);
+  }
+
+  if (ret == 0)
+  {
+    page_address.page_addr = (uint8_t)(add - (page_sel.page_sel * 256U));
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_ADDRESS,
+                               (uint8_t *)&page_address, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_VALUE, val, 2);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    page_rw.page_rw = 0x00U; /* page_read disable */
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Angular rate sensor self-test enable.[set]
+  * @brief  Data-ready pulsed / letched mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of st_g in reg CTRL5_C
+  * @param  val    Change the values of dataready_pulsed in
+  *                reg COUNTER_BDR_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_self_test_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_st_g_t val)
+int32_t ism330dhcx_data_ready_mode_set(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_dataready_pulsed_t val)
 {
-  ism330dhcx_ctrl5_c_t ctrl5_c;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
-                            (uint8_t *)&ctrl5_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
 
   if (ret == 0)
   {
-    ctrl5_c.st_g = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL5_C,
-                               (uint8_t *)&ctrl5_c, 1);
+    counter_bdr_reg1.dataready_pulsed = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                               (uint8_t *)&counter_bdr_reg1, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Angular rate sensor self-test enable.[get]
+  * @brief  Data-ready pulsed / letched mode.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st_g in reg CTRL5_C
+  * @param  val    Get the values of dataready_pulsed in
+  *                reg COUNTER_BDR_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_self_test_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_st_g_t *val)
+int32_t ism330dhcx_data_ready_mode_get(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_dataready_pulsed_t *val)
 {
-  ism330dhcx_ctrl5_c_t ctrl5_c;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
-                            (uint8_t *)&ctrl5_c, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
 
-  switch (ctrl5_c.st_g)
+  switch (counter_bdr_reg1.dataready_pulsed)
   {
-    case ISM330DHCX_GY_ST_DISABLE:
-      *val = ISM330DHCX_GY_ST_DISABLE;
-      break;
-
-    case ISM330DHCX_GY_ST_POSITIVE:
-      *val = ISM330DHCX_GY_ST_POSITIVE;
+    case ISM330DHCX_DRDY_LATCHED:
+      *val = ISM330DHCX_DRDY_LATCHED;
       break;
 
-    case ISM330DHCX_GY_ST_NEGATIVE:
-      *val = ISM330DHCX_GY_ST_NEGATIVE;
+    case ISM330DHCX_DRDY_PULSED:
+      *val = ISM330DHCX_DRDY_PULSED;
       break;
 
     default:
-      *val = ISM330DHCX_GY_ST_DISABLE;
+      *val = ISM330DHCX_DRDY_LATCHED;
       break;
   }
 
@@ -2639,242 +3730,250 @@ int32_t ism330dhcx_gy_self_test_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @}
+  * @brief  Device Who am I.[get]
   *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_filters
-  * @brief      This section group all the functions concerning the
-  *             filters configuration
-  * @{
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  buff   Buffer that stores data read
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t ism330dhcx_device_id_get(const stmdev_ctx_t *ctx, uint8_t *buff)
+{
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WHO_AM_I, buff, 1);
+
+  return ret;
+}
 
 /**
-  * @brief  Accelerometer output from LPF2 filtering stage selection.[set]
+  * @brief  Software reset. Restore the default values in user registers.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lpf2_xl_en in reg CTRL1_XL
+  * @param  val    Change the values of sw_reset in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_filter_lp2_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_reset_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_ctrl1_xl_t ctrl1_xl;
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
-                            (uint8_t *)&ctrl1_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
 
   if (ret == 0)
   {
-    ctrl1_xl.lpf2_xl_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_XL,
-                               (uint8_t *)&ctrl1_xl, 1);
+    ctrl3_c.sw_reset = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
+                               (uint8_t *)&ctrl3_c, 1);
+  }
+
+  if ((priv != NULL) && (val != PROPERTY_DISABLE))
+  {
+    /* FUNC_CFG_ACCESS is restored by the device */
+    priv->bank_valid = PROPERTY_DISABLE;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Accelerometer output from LPF2 filtering stage selection.[get]
+  * @brief  Software reset. Restore the default values in user registers.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lpf2_xl_en in reg CTRL1_XL
+  * @param  val    Change the values of sw_reset in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_filter_lp2_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_reset_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_ctrl1_xl_t ctrl1_xl;
+  ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
-                            (uint8_t *)&ctrl1_xl, 1);
-  *val = ctrl1_xl.lpf2_xl_en;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+  *val = ctrl3_c.sw_reset;
 
   return ret;
 }
 
 /**
-  * @brief  Enables gyroscope digital LPF1 if auxiliary SPI is disabled;
-  *         the bandwidth can be selected through FTYPE [2:0] in CTRL6_C.[set]
+  * @brief  Register address automatically incremented during a multiple byte
+  *         access with a serial interface.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lpf1_sel_g in reg CTRL4_C
+  * @param  val    Change the values of if_inc in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_filter_lp1_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_auto_increment_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
 
   if (ret == 0)
   {
-    ctrl4_c.lpf1_sel_g = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
-                               (uint8_t *)&ctrl4_c, 1);
+    ctrl3_c.if_inc = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
+                               (uint8_t *)&ctrl3_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enables gyroscope digital LPF1 if auxiliary SPI is disabled;
-  *         the bandwidth can be selected through FTYPE [2:0] in CTRL6_C.[get]
+  * @brief  Register address automatically incremented during a multiple byte
+  *         access with a serial interface.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lpf1_sel_g in reg CTRL4_C
+  * @param  val    Change the values of if_inc in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_filter_lp1_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_auto_increment_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
-  *val = ctrl4_c.lpf1_sel_g;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+  *val = ctrl3_c.if_inc;
 
   return ret;
 }
 
 /**
-  * @brief  Mask DRDY on pin (both XL & Gyro) until filter settling ends
-  *         (XL and Gyro independently masked).[set]
+  * @brief  Reboot memory content. Reload the calibration parameters.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of drdy_mask in reg CTRL4_C
+  * @param  val    Change the values of boot in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_filter_settling_mask_set(const stmdev_ctx_t *ctx,
-                                            uint8_t val)
+int32_t ism330dhcx_boot_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_priv_t *priv = ism330dhcx_priv_get(ctx);
+  ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
 
   if (ret == 0)
   {
-    ctrl4_c.drdy_mask = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
-                               (uint8_t *)&ctrl4_c, 1);
+    ctrl3_c.boot = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
+                               (uint8_t *)&ctrl3_c, 1);
   }
 
+  if ((priv != NULL) && (val != PROPERTY_DISABLE))
+  {
+    /* FUNC_CFG_ACCESS is restored by the device */
+    priv->bank_valid = PROPERTY_DISABLE;
+  }
+
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Mask DRDY on pin (both XL & Gyro) until filter settling ends
-  *         (XL and Gyro independently masked).[get]
+  * @brief  Reboot memory content. Reload the calibration parameters.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of drdy_mask in reg CTRL4_C
+  * @param  val    Change the values of boot in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_filter_settling_mask_get(const stmdev_ctx_t *ctx,
-                                            uint8_t *val)
+int32_t ism330dhcx_boot_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
-  *val = ctrl4_c.drdy_mask;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+  *val = ctrl3_c.boot;
 
   return ret;
 }
 
+
+
 /**
-  * @brief  Gyroscope low pass filter 1 bandwidth.[set]
+  * @brief  Linear acceleration sensor self-test enable.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ftype in reg CTRL6_C
+  * @param  val    Change the values of st_xl in reg CTRL5_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_lp1_bandwidth_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_ftype_t val)
+int32_t ism330dhcx_xl_self_test_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_st_xl_t val)
 {
-  ism330dhcx_ctrl6_c_t ctrl6_c;
+  ism330dhcx_ctrl5_c_t ctrl5_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
-                            (uint8_t *)&ctrl6_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
+                            (uint8_t *)&ctrl5_c, 1);
 
   if (ret == 0)
   {
-    ctrl6_c.ftype = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL6_C,
-                               (uint8_t *)&ctrl6_c, 1);
+    ctrl5_c.st_xl = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL5_C,
+                               (uint8_t *)&ctrl5_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Gyroscope low pass filter 1 bandwidth.[get]
+  * @brief  Linear acceleration sensor self-test enable.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ftype in reg CTRL6_C
+  * @param  val    Get the values of st_xl in reg CTRL5_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_ftype_t *val)
+int32_t ism330dhcx_xl_self_test_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_st_xl_t *val)
 {
-  ism330dhcx_ctrl6_c_t ctrl6_c;
+  ism330dhcx_ctrl5_c_t ctrl5_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
-                            (uint8_t *)&ctrl6_c, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
+                            (uint8_t *)&ctrl5_c, 1);
 
-  switch (ctrl6_c.ftype)
+  switch (ctrl5_c.st_xl)
   {
-    case ISM330DHCX_ULTRA_LIGHT:
-      *val = ISM330DHCX_ULTRA_LIGHT;
-      break;
-
-    case ISM330DHCX_VERY_LIGHT:
-      *val = ISM330DHCX_VERY_LIGHT;
-      break;
-
-    case ISM330DHCX_LIGHT:
-      *val = ISM330DHCX_LIGHT;
-      break;
-
-    case ISM330DHCX_MEDIUM:
-      *val = ISM330DHCX_MEDIUM;
-      break;
-
-    case ISM330DHCX_STRONG:
-      *val = ISM330DHCX_STRONG;
-      break;
-
-    case ISM330DHCX_VERY_STRONG:
-      *val = ISM330DHCX_VERY_STRONG;
+    case ISM330DHCX_XL_ST_DISABLE:
+      *val = ISM330DHCX_XL_ST_DISABLE;
       break;
 
-    case ISM330DHCX_AGGRESSIVE:
-      *val = ISM330DHCX_AGGRESSIVE;
+    case ISM330DHCX_XL_ST_POSITIVE:
+      *val = ISM330DHCX_XL_ST_POSITIVE;
       break;
 
-    case ISM330DHCX_XTREME:
-      *val = ISM330DHCX_XTREME;
+    case ISM330DHCX_XL_ST_NEGATIVE:
+      *val = ISM330DHCX_XL_ST_NEGATIVE;
       break;
 
     default:
-      *val = ISM330DHCX_ULTRA_LIGHT;
+      *val = ISM330DHCX_XL_ST_DISABLE;
       break;
   }
 
@@ -2882,390 +3981,323 @@ int32_t ism330dhcx_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Low pass filter 2 on 6D function selection.[set]
+  * @brief  Angular rate sensor self-test enable.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of low_pass_on_6d in reg CTRL8_XL
+  * @param  val    Change the values of st_g in reg CTRL5_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_lp2_on_6d_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_gy_self_test_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_st_g_t val)
 {
-  ism330dhcx_ctrl8_xl_t ctrl8_xl;
+  ism330dhcx_ctrl5_c_t ctrl5_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
-                            (uint8_t *)&ctrl8_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
+                            (uint8_t *)&ctrl5_c, 1);
 
   if (ret == 0)
   {
-    ctrl8_xl.low_pass_on_6d = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL8_XL,
-                               (uint8_t *)&ctrl8_xl, 1);
+    ctrl5_c.st_g = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL5_C,
+                               (uint8_t *)&ctrl5_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Low pass filter 2 on 6D function selection.[get]
+  * @brief  Angular rate sensor self-test enable.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of low_pass_on_6d in reg CTRL8_XL
+  * @param  val    Get the values of st_g in reg CTRL5_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_lp2_on_6d_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_gy_self_test_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_st_g_t *val)
 {
-  ism330dhcx_ctrl8_xl_t ctrl8_xl;
+  ism330dhcx_ctrl5_c_t ctrl5_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
-                            (uint8_t *)&ctrl8_xl, 1);
-  *val = ctrl8_xl.low_pass_on_6d;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL5_C,
+                            (uint8_t *)&ctrl5_c, 1);
+
+  switch (ctrl5_c.st_g)
+  {
+    case ISM330DHCX_GY_ST_DISABLE:
+      *val = ISM330DHCX_GY_ST_DISABLE;
+      break;
+
+    case ISM330DHCX_GY_ST_POSITIVE:
+      *val = ISM330DHCX_GY_ST_POSITIVE;
+      break;
+
+    case ISM330DHCX_GY_ST_NEGATIVE:
+      *val = ISM330DHCX_GY_ST_NEGATIVE;
+      break;
+
+    default:
+      *val = ISM330DHCX_GY_ST_DISABLE;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer slope filter / high-pass filter selection
-  *         on output.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_filters
+  * @brief      This section group all the functions concerning the
+  *             filters configuration
+  * @{
+  *
+  */
+
+/**
+  * @brief  Accelerometer output from LPF2 filtering stage selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of hp_slope_xl_en in reg CTRL8_XL
+  * @param  val    Change the values of lpf2_xl_en in reg CTRL1_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_hp_path_on_out_set(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_hp_slope_xl_en_t val)
+int32_t ism330dhcx_xl_filter_lp2_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_ctrl8_xl_t ctrl8_xl;
+  ism330dhcx_ctrl1_xl_t ctrl1_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
-                            (uint8_t *)&ctrl8_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
+                            (uint8_t *)&ctrl1_xl, 1);
 
   if (ret == 0)
   {
-    ctrl8_xl.hp_slope_xl_en = (((uint8_t)val & 0x10U) >> 4);
-    ctrl8_xl.hp_ref_mode_xl = (((uint8_t)val & 0x20U) >> 5);
-    ctrl8_xl.hpcf_xl = (uint8_t)val & 0x07U;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL8_XL,
-                               (uint8_t *)&ctrl8_xl, 1);
+    ctrl1_xl.lpf2_xl_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_XL,
+                               (uint8_t *)&ctrl1_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Accelerometer slope filter / high-pass filter selection on
-  *         output.[get]
+  * @brief  Accelerometer output from LPF2 filtering stage selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of hp_slope_xl_en in reg CTRL8_XL
+  * @param  val    Change the values of lpf2_xl_en in reg CTRL1_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_hp_path_on_out_get(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_hp_slope_xl_en_t *val)
+int32_t ism330dhcx_xl_filter_lp2_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_ctrl8_xl_t ctrl8_xl;
+  ism330dhcx_ctrl1_xl_t ctrl1_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
-                            (uint8_t *)&ctrl8_xl, 1);
-
-  switch (((ctrl8_xl.hp_ref_mode_xl << 5) + (ctrl8_xl.hp_slope_xl_en <<
-                                             4) +
-           ctrl8_xl.hpcf_xl))
-  {
-    case ISM330DHCX_HP_PATH_DISABLE_ON_OUT:
-      *val = ISM330DHCX_HP_PATH_DISABLE_ON_OUT;
-      break;
-
-    case ISM330DHCX_SLOPE_ODR_DIV_4:
-      *val = ISM330DHCX_SLOPE_ODR_DIV_4;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_10:
-      *val = ISM330DHCX_HP_ODR_DIV_10;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_20:
-      *val = ISM330DHCX_HP_ODR_DIV_20;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_45:
-      *val = ISM330DHCX_HP_ODR_DIV_45;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_100:
-      *val = ISM330DHCX_HP_ODR_DIV_100;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_200:
-      *val = ISM330DHCX_HP_ODR_DIV_200;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_400:
-      *val = ISM330DHCX_HP_ODR_DIV_400;
-      break;
-
-    case ISM330DHCX_HP_ODR_DIV_800:
-      *val = ISM330DHCX_HP_ODR_DIV_800;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_10:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_10;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_20:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_20;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_45:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_45;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_100:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_100;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_200:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_200;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_400:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_400;
-      break;
-
-    case ISM330DHCX_HP_REF_MD_ODR_DIV_800:
-      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_800;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_10:
-      *val = ISM330DHCX_LP_ODR_DIV_10;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_20:
-      *val = ISM330DHCX_LP_ODR_DIV_20;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_45:
-      *val = ISM330DHCX_LP_ODR_DIV_45;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_100:
-      *val = ISM330DHCX_LP_ODR_DIV_100;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_200:
-      *val = ISM330DHCX_LP_ODR_DIV_200;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_400:
-      *val = ISM330DHCX_LP_ODR_DIV_400;
-      break;
-
-    case ISM330DHCX_LP_ODR_DIV_800:
-      *val = ISM330DHCX_LP_ODR_DIV_800;
-      break;
-
-    default:
-      *val = ISM330DHCX_HP_PATH_DISABLE_ON_OUT;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL,
+                            (uint8_t *)&ctrl1_xl, 1);
+  *val = ctrl1_xl.lpf2_xl_en;
 
   return ret;
 }
 
 /**
-  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode.
-  *         The filter sets the second samples after writing this bit.
-  *         Active only during device exit from powerdown mode.[set]
+  * @brief  Enables gyroscope digital LPF1 if auxiliary SPI is disabled;
+  *         the bandwidth can be selected through FTYPE [2:0] in CTRL6_C.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fastsettl_mode_xl in reg CTRL8_XL
+  * @param  val    Change the values of lpf1_sel_g in reg CTRL4_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_fast_settling_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
+int32_t ism330dhcx_gy_filter_lp1_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_ctrl8_xl_t ctrl8_xl;
+  ism330dhcx_ctrl4_c_t ctrl4_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
-                            (uint8_t *)&ctrl8_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
 
   if (ret == 0)
   {
-    ctrl8_xl.fastsettl_mode_xl = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL8_XL,
-                               (uint8_t *)&ctrl8_xl, 1);
+    ctrl4_c.lpf1_sel_g = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
+                               (uint8_t *)&ctrl4_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode.
-  *         The filter sets the second samples after writing
-  *         this bit. Active only during device exit from powerdown mode.[get]
+  * @brief  Enables gyroscope digital LPF1 if auxiliary SPI is disabled;
+  *         the bandwidth can be selected through FTYPE [2:0] in CTRL6_C.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fastsettl_mode_xl in reg CTRL8_XL
+  * @param  val    Change the values of lpf1_sel_g in reg CTRL4_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_fast_settling_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
+int32_t ism330dhcx_gy_filter_lp1_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_ctrl8_xl_t ctrl8_xl;
+  ism330dhcx_ctrl4_c_t ctrl4_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
-                            (uint8_t *)&ctrl8_xl, 1);
-  *val = ctrl8_xl.fastsettl_mode_xl;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+  *val = ctrl4_c.lpf1_sel_g;
 
   return ret;
 }
 
 /**
-  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity
-  *         functions.[set]
+  * @brief  Mask DRDY on pin (both XL & Gyro) until filter settling ends
+  *         (XL and Gyro independently masked).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of slope_fds in reg TAP_CFG0
+  * @param  val    Change the values of drdy_mask in reg CTRL4_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_hp_path_internal_set(const stmdev_ctx_t *ctx,
-                                           ism330dhcx_slope_fds_t val)
+int32_t ism330dhcx_filter_settling_mask_set(const stmdev_ctx_t *ctx,
+                                            uint8_t val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
+  ism330dhcx_ctrl4_c_t ctrl4_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
 
   if (ret == 0)
   {
-    tap_cfg0.slope_fds = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
-                               (uint8_t *)&tap_cfg0, 1);
+    ctrl4_c.drdy_mask = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
+                               (uint8_t *)&ctrl4_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity
-  *         functions.[get]
+  * @brief  Mask DRDY on pin (both XL & Gyro) until filter settling ends
+  *         (XL and Gyro independently masked).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of slope_fds in reg TAP_CFG0
+  * @param  val    Change the values of drdy_mask in reg CTRL4_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_hp_path_internal_get(const stmdev_ctx_t *ctx,
-                                           ism330dhcx_slope_fds_t *val)
+int32_t ism330dhcx_filter_settling_mask_get(const stmdev_ctx_t *ctx,
+                                            uint8_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
+  ism330dhcx_ctrl4_c_t ctrl4_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-
-  switch (tap_cfg0.slope_fds)
-  {
-    case ISM330DHCX_USE_SLOPE:
-      *val = ISM330DHCX_USE_SLOPE;
-      break;
-
-    case ISM330DHCX_USE_HPF:
-      *val = ISM330DHCX_USE_HPF;
-      break;
-
-    default:
-      *val = ISM330DHCX_USE_SLOPE;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+  *val = ctrl4_c.drdy_mask;
 
   return ret;
 }
 
 /**
-  * @brief  Enables gyroscope digital high-pass filter. The filter is enabled
-  *         only if the gyro is in HP mode.[set]
+  * @brief  Gyroscope low pass filter 1 bandwidth.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of hp_en_g and hp_en_g in reg CTRL7_G
+  * @param  val    Change the values of ftype in reg CTRL6_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_hp_path_internal_set(const stmdev_ctx_t *ctx,
-                                           ism330dhcx_hpm_g_t val)
+int32_t ism330dhcx_gy_lp1_bandwidth_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_ftype_t val)
 {
-  ism330dhcx_ctrl7_g_t ctrl7_g;
+  ism330dhcx_ctrl6_c_t ctrl6_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
-                            (uint8_t *)&ctrl7_g, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
+                            (uint8_t *)&ctrl6_c, 1);
 
   if (ret == 0)
   {
-    ctrl7_g.hp_en_g = (((uint8_t)val & 0x80U) >> 7);
-    ctrl7_g.hpm_g = (uint8_t)val & 0x03U;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL7_G,
-                               (uint8_t *)&ctrl7_g, 1);
+    ctrl6_c.ftype = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL6_C,
+                               (uint8_t *)&ctrl6_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief    Enables gyroscope digital high-pass filter. The filter is
-  *           enabled only if the gyro is in HP mode.[get]
+  * @brief  Gyroscope low pass filter 1 bandwidth.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of hp_en_g and hp_en_g in reg CTRL7_G
+  * @param  val    Get the values of ftype in reg CTRL6_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_hp_path_internal_get(const stmdev_ctx_t *ctx,
-                                           ism330dhcx_hpm_g_t *val)
+int32_t ism330dhcx_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_ftype_t *val)
 {
-  ism330dhcx_ctrl7_g_t ctrl7_g;
+  ism330dhcx_ctrl6_c_t ctrl6_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
-                            (uint8_t *)&ctrl7_g, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
+                            (uint8_t *)&ctrl6_c, 1);
 
-  switch ((ctrl7_g.hp_en_g << 7) + ctrl7_g.hpm_g)
+  switch (ctrl6_c.ftype)
   {
-    case ISM330DHCX_HP_FILTER_NONE:
-      *val = ISM330DHCX_HP_FILTER_NONE;
+    case ISM330DHCX_ULTRA_LIGHT:
+      *val = ISM330DHCX_ULTRA_LIGHT;
       break;
 
-    case ISM330DHCX_HP_FILTER_16mHz:
-      *val = ISM330DHCX_HP_FILTER_16mHz;
+    case ISM330DHCX_VERY_LIGHT:
+      *val = ISM330DHCX_VERY_LIGHT;
       break;
 
-    case ISM330DHCX_HP_FILTER_65mHz:
-      *val = ISM330DHCX_HP_FILTER_65mHz;
+    case ISM330DHCX_LIGHT:
+      *val = ISM330DHCX_LIGHT;
       break;
 
-    case ISM330DHCX_HP_FILTER_260mHz:
-      *val = ISM330DHCX_HP_FILTER_260mHz;
+    case ISM330DHCX_MEDIUM:
+      *val = ISM330DHCX_MEDIUM;
       break;
 
-    case ISM330DHCX_HP_FILTER_1Hz04:
-      *val = ISM330DHCX_HP_FILTER_1Hz04;
+    case ISM330DHCX_STRONG:
+      *val = ISM330DHCX_STRONG;
+      break;
+
+    case ISM330DHCX_VERY_STRONG:
+      *val = ISM330DHCX_VERY_STRONG;
+      break;
+
+    case ISM330DHCX_AGGRESSIVE:
+      *val = ISM330DHCX_AGGRESSIVE;
+      break;
+
+    case ISM330DHCX_XTREME:
+      *val = ISM330DHCX_XTREME;
       break;
 
     default:
-      *val = ISM330DHCX_HP_FILTER_NONE;
+      *val = ISM330DHCX_ULTRA_LIGHT;
       break;
   }
 
@@ -3273,139 +4305,203 @@ int32_t ism330dhcx_gy_hp_path_internal_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_ Auxiliary_interface
-  * @brief      This section groups all the functions concerning
-  *             auxiliary interface.
-  * @{
-  *
-  */
-
-/**
-  * @brief  On auxiliary interface connect/disconnect SDO and OCS
-  *         internal pull-up.[set]
+  * @brief  Low pass filter 2 on 6D function selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ois_pu_dis in reg PIN_CTRL
+  * @param  val    Change the values of low_pass_on_6d in reg CTRL8_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_sdo_ocs_mode_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_ois_pu_dis_t val)
+int32_t ism330dhcx_xl_lp2_on_6d_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_pin_ctrl_t pin_ctrl;
+  ism330dhcx_ctrl8_xl_t ctrl8_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
-                            (uint8_t *)&pin_ctrl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
+                            (uint8_t *)&ctrl8_xl, 1);
 
   if (ret == 0)
   {
-    pin_ctrl.ois_pu_dis = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PIN_CTRL,
-                               (uint8_t *)&pin_ctrl, 1);
+    ctrl8_xl.low_pass_on_6d = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL8_XL,
+                               (uint8_t *)&ctrl8_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  On auxiliary interface connect/disconnect SDO and OCS
-  *         internal pull-up.[get]
+  * @brief  Low pass filter 2 on 6D function selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ois_pu_dis in reg PIN_CTRL
+  * @param  val    Change the values of low_pass_on_6d in reg CTRL8_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_sdo_ocs_mode_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_ois_pu_dis_t *val)
+int32_t ism330dhcx_xl_lp2_on_6d_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_pin_ctrl_t pin_ctrl;
+  ism330dhcx_ctrl8_xl_t ctrl8_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
-                            (uint8_t *)&pin_ctrl, 1);
-
-  switch (pin_ctrl.ois_pu_dis)
-  {
-    case ISM330DHCX_AUX_PULL_UP_DISC:
-      *val = ISM330DHCX_AUX_PULL_UP_DISC;
-      break;
-
-    case ISM330DHCX_AUX_PULL_UP_CONNECT:
-      *val = ISM330DHCX_AUX_PULL_UP_CONNECT;
-      break;
-
-    default:
-      *val = ISM330DHCX_AUX_PULL_UP_DISC;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
+                            (uint8_t *)&ctrl8_xl, 1);
+  *val = ctrl8_xl.low_pass_on_6d;
 
   return ret;
 }
 
 /**
-  * @brief  OIS chain on aux interface power on mode.[set]
+  * @brief  Accelerometer slope filter / high-pass filter selection
+  *         on output.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ois_on in reg CTRL7_G
+  * @param  val    Change the values of hp_slope_xl_en in reg CTRL8_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_pw_on_ctrl_set(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_ois_on_t val)
+int32_t ism330dhcx_xl_hp_path_on_out_set(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_hp_slope_xl_en_t val)
 {
-  ism330dhcx_ctrl7_g_t ctrl7_g;
+  ism330dhcx_ctrl8_xl_t ctrl8_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
-                            (uint8_t *)&ctrl7_g, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
+                            (uint8_t *)&ctrl8_xl, 1);
 
   if (ret == 0)
   {
-    ctrl7_g.ois_on_en = (uint8_t)val & 0x01U;
-    ctrl7_g.ois_on = (uint8_t)val & 0x01U;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL7_G,
-                               (uint8_t *)&ctrl7_g, 1);
+    ctrl8_xl.hp_slope_xl_en = (((uint8_t)val & 0x10U) >> 4);
+    ctrl8_xl.hp_ref_mode_xl = (((uint8_t)val & 0x20U) >> 5);
+    ctrl8_xl.hpcf_xl = (uint8_t)val & 0x07U;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL8_XL,
+                               (uint8_t *)&ctrl8_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  OIS chain on aux interface power on mode[get]
+  * @brief  Accelerometer slope filter / high-pass filter selection on
+  *         output.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ois_on in reg CTRL7_G
+  * @param  val    Get the values of hp_slope_xl_en in reg CTRL8_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_pw_on_ctrl_get(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_ois_on_t *val)
+int32_t ism330dhcx_xl_hp_path_on_out_get(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_hp_slope_xl_en_t *val)
 {
-  ism330dhcx_ctrl7_g_t ctrl7_g;
+  ism330dhcx_ctrl8_xl_t ctrl8_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
-                            (uint8_t *)&ctrl7_g, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
+                            (uint8_t *)&ctrl8_xl, 1);
 
-  switch (ctrl7_g.ois_on)
+  switch (((ctrl8_xl.hp_ref_mode_xl << 5) + (ctrl8_xl.hp_slope_xl_en <<
+                                             4) +
+           ctrl8_xl.hpcf_xl))
   {
-    case ISM330DHCX_AUX_ON:
-      *val = ISM330DHCX_AUX_ON;
+    case ISM330DHCX_HP_PATH_DISABLE_ON_OUT:
+      *val = ISM330DHCX_HP_PATH_DISABLE_ON_OUT;
       break;
 
-    case ISM330DHCX_AUX_ON_BY_AUX_INTERFACE:
-      *val = ISM330DHCX_AUX_ON_BY_AUX_INTERFACE;
+    case ISM330DHCX_SLOPE_ODR_DIV_4:
+      *val = ISM330DHCX_SLOPE_ODR_DIV_4;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_10:
+      *val = ISM330DHCX_HP_ODR_DIV_10;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_20:
+      *val = ISM330DHCX_HP_ODR_DIV_20;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_45:
+      *val = ISM330DHCX_HP_ODR_DIV_45;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_100:
+      *val = ISM330DHCX_HP_ODR_DIV_100;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_200:
+      *val = ISM330DHCX_HP_ODR_DIV_200;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_400:
+      *val = ISM330DHCX_HP_ODR_DIV_400;
+      break;
+
+    case ISM330DHCX_HP_ODR_DIV_800:
+      *val = ISM330DHCX_HP_ODR_DIV_800;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_10:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_10;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_20:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_20;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_45:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_45;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_100:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_100;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_200:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_200;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_400:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_400;
+      break;
+
+    case ISM330DHCX_HP_REF_MD_ODR_DIV_800:
+      *val = ISM330DHCX_HP_REF_MD_ODR_DIV_800;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_10:
+      *val = ISM330DHCX_LP_ODR_DIV_10;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_20:
+      *val = ISM330DHCX_LP_ODR_DIV_20;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_45:
+      *val = ISM330DHCX_LP_ODR_DIV_45;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_100:
+      *val = ISM330DHCX_LP_ODR_DIV_100;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_200:
+      *val = ISM330DHCX_LP_ODR_DIV_200;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_400:
+      *val = ISM330DHCX_LP_ODR_DIV_400;
+      break;
+
+    case ISM330DHCX_LP_ODR_DIV_800:
+      *val = ISM330DHCX_LP_ODR_DIV_800;
       break;
 
     default:
-      *val = ISM330DHCX_AUX_ON;
+      *val = ISM330DHCX_HP_PATH_DISABLE_ON_OUT;
       break;
   }
 
@@ -3413,149 +4509,201 @@ int32_t ism330dhcx_aux_pw_on_ctrl_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  The STATUS_SPIAux register is read by the auxiliary SPI.[get]
+  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode.
+  *         The filter sets the second samples after writing this bit.
+  *         Active only during device exit from powerdown mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  ism330dhcx_status_spiaux_t: registers STATUS_SPIAUX
+  * @param  val    Change the values of fastsettl_mode_xl in reg CTRL8_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_status_reg_get(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_status_spiaux_t *val)
+int32_t ism330dhcx_xl_fast_settling_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
 {
+  ism330dhcx_ctrl8_xl_t ctrl8_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
-                            (uint8_t *)val, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
+                            (uint8_t *)&ctrl8_xl, 1);
+
+  if (ret == 0)
+  {
+    ctrl8_xl.fastsettl_mode_xl = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL8_XL,
+                               (uint8_t *)&ctrl8_xl, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  AUX accelerometer data available.[get]
+  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode.
+  *         The filter sets the second samples after writing
+  *         this bit. Active only during device exit from powerdown mode.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of xlda in reg STATUS_SPIAUX
+  * @param  val    Change the values of fastsettl_mode_xl in reg CTRL8_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_flag_data_ready_get(const stmdev_ctx_t *ctx,
-                                              uint8_t *val)
+int32_t ism330dhcx_xl_fast_settling_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
 {
-  ism330dhcx_status_spiaux_t status_spiaux;
+  ism330dhcx_ctrl8_xl_t ctrl8_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
-                            (uint8_t *)&status_spiaux, 1);
-  *val = status_spiaux.xlda;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL8_XL,
+                            (uint8_t *)&ctrl8_xl, 1);
+  *val = ctrl8_xl.fastsettl_mode_xl;
 
   return ret;
 }
 
 /**
-  * @brief  AUX gyroscope data available.[get]
+  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity
+  *         functions.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of gda in reg STATUS_SPIAUX
+  * @param  val    Change the values of slope_fds in reg TAP_CFG0
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_flag_data_ready_get(const stmdev_ctx_t *ctx,
-                                              uint8_t *val)
+int32_t ism330dhcx_xl_hp_path_internal_set(const stmdev_ctx_t *ctx,
+                                           ism330dhcx_slope_fds_t val)
 {
-  ism330dhcx_status_spiaux_t status_spiaux;
+  ism330dhcx_tap_cfg0_t tap_cfg0;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
-                            (uint8_t *)&status_spiaux, 1);
-  *val = status_spiaux.gda;
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg0.slope_fds = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
+                               (uint8_t *)&tap_cfg0, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  High when the gyroscope output is in the settling phase.[get]
+  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity
+  *         functions.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of gyro_settling in reg STATUS_SPIAUX
+  * @param  val    Get the values of slope_fds in reg TAP_CFG0
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_flag_settling_get(const stmdev_ctx_t *ctx,
-                                            uint8_t *val)
+int32_t ism330dhcx_xl_hp_path_internal_get(const stmdev_ctx_t *ctx,
+                                           ism330dhcx_slope_fds_t *val)
 {
-  ism330dhcx_status_spiaux_t status_spiaux;
+  ism330dhcx_tap_cfg0_t tap_cfg0;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
-                            (uint8_t *)&status_spiaux, 1);
-  *val = status_spiaux.gyro_settling;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  switch (tap_cfg0.slope_fds)
+  {
+    case ISM330DHCX_USE_SLOPE:
+      *val = ISM330DHCX_USE_SLOPE;
+      break;
+
+    case ISM330DHCX_USE_HPF:
+      *val = ISM330DHCX_USE_HPF;
+      break;
+
+    default:
+      *val = ISM330DHCX_USE_SLOPE;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Selects accelerometer self-test. Effective only if XL OIS chain is
-  *         enabled.[set]
+  * @brief  Enables gyroscope digital high-pass filter. The filter is enabled
+  *         only if the gyro is in HP mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of st_xl_ois in reg INT_OIS
+  * @param  val    Get the values of hp_en_g and hp_en_g in reg CTRL7_G
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_self_test_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_st_xl_ois_t val)
+int32_t ism330dhcx_gy_hp_path_internal_set(const stmdev_ctx_t *ctx,
+                                           ism330dhcx_hpm_g_t val)
 {
-  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_ctrl7_g_t ctrl7_g;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
+                            (uint8_t *)&ctrl7_g, 1);
 
   if (ret == 0)
   {
-    int_ois.st_xl_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
-                               (uint8_t *)&int_ois, 1);
+    ctrl7_g.hp_en_g = (((uint8_t)val & 0x80U) >> 7);
+    ctrl7_g.hpm_g = (uint8_t)val & 0x03U;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL7_G,
+                               (uint8_t *)&ctrl7_g, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects accelerometer self-test. Effective only if XL OIS chain
-  *         is enabled.[get]
+  * @brief    Enables gyroscope digital high-pass filter. The filter is
+  *           enabled only if the gyro is in HP mode.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st_xl_ois in reg INT_OIS
+  * @param  val    Get the values of hp_en_g and hp_en_g in reg CTRL7_G
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_self_test_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_st_xl_ois_t *val)
+int32_t ism330dhcx_gy_hp_path_internal_get(const stmdev_ctx_t *ctx,
+                                           ism330dhcx_hpm_g_t *val)
 {
-  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_ctrl7_g_t ctrl7_g;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
+                            (uint8_t *)&ctrl7_g, 1);
 
-  switch (int_ois.st_xl_ois)
+  switch ((ctrl7_g.hp_en_g << 7) + ctrl7_g.hpm_g)
   {
-    case ISM330DHCX_AUX_XL_DISABLE:
-      *val = ISM330DHCX_AUX_XL_DISABLE;
+    case ISM330DHCX_HP_FILTER_NONE:
+      *val = ISM330DHCX_HP_FILTER_NONE;
       break;
 
-    case ISM330DHCX_AUX_XL_POS:
-      *val = ISM330DHCX_AUX_XL_POS;
+    case ISM330DHCX_HP_FILTER_16mHz:
+      *val = ISM330DHCX_HP_FILTER_16mHz;
       break;
 
-    case ISM330DHCX_AUX_XL_NEG:
-      *val = ISM330DHCX_AUX_XL_NEG;
+    case ISM330DHCX_HP_FILTER_65mHz:
+      *val = ISM330DHCX_HP_FILTER_65mHz;
+      break;
+
+    case ISM330DHCX_HP_FILTER_260mHz:
+      *val = ISM330DHCX_HP_FILTER_260mHz;
+      break;
+
+    case ISM330DHCX_HP_FILTER_1Hz04:
+      *val = ISM330DHCX_HP_FILTER_1Hz04;
       break;
 
     default:
-      *val = ISM330DHCX_AUX_XL_DISABLE;
+      *val = ISM330DHCX_HP_FILTER_NONE;
       break;
   }
 
@@ -3563,61 +4711,79 @@ int32_t ism330dhcx_aux_xl_self_test_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Indicates polarity of DEN signal on OIS chain.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_ Auxiliary_interface
+  * @brief      This section groups all the functions concerning
+  *             auxiliary interface.
+  * @{
+  *
+  */
+
+/**
+  * @brief  On auxiliary interface connect/disconnect SDO and OCS
+  *         internal pull-up.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_lh_ois in reg INT_OIS
+  * @param  val    Change the values of ois_pu_dis in reg PIN_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_den_polarity_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_den_lh_ois_t val)
+int32_t ism330dhcx_aux_sdo_ocs_mode_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_ois_pu_dis_t val)
 {
-  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_pin_ctrl_t pin_ctrl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
+                            (uint8_t *)&pin_ctrl, 1);
 
   if (ret == 0)
   {
-    int_ois.den_lh_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
-                               (uint8_t *)&int_ois, 1);
+    pin_ctrl.ois_pu_dis = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PIN_CTRL,
+                               (uint8_t *)&pin_ctrl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Indicates polarity of DEN signal on OIS chain.[get]
+  * @brief  On auxiliary interface connect/disconnect SDO and OCS
+  *         internal pull-up.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of den_lh_ois in reg INT_OIS
+  * @param  val    Get the values of ois_pu_dis in reg PIN_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_den_polarity_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_den_lh_ois_t *val)
+int32_t ism330dhcx_aux_sdo_ocs_mode_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_ois_pu_dis_t *val)
 {
-  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_pin_ctrl_t pin_ctrl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
+                            (uint8_t *)&pin_ctrl, 1);
 
-  switch (int_ois.den_lh_ois)
+  switch (pin_ctrl.ois_pu_dis)
   {
-    case ISM330DHCX_AUX_DEN_ACTIVE_LOW:
-      *val = ISM330DHCX_AUX_DEN_ACTIVE_LOW;
+    case ISM330DHCX_AUX_PULL_UP_DISC:
+      *val = ISM330DHCX_AUX_PULL_UP_DISC;
       break;
 
-    case ISM330DHCX_AUX_DEN_ACTIVE_HIGH:
-      *val = ISM330DHCX_AUX_DEN_ACTIVE_HIGH;
+    case ISM330DHCX_AUX_PULL_UP_CONNECT:
+      *val = ISM330DHCX_AUX_PULL_UP_CONNECT;
       break;
 
     default:
-      *val = ISM330DHCX_AUX_DEN_ACTIVE_LOW;
+      *val = ISM330DHCX_AUX_PULL_UP_DISC;
       break;
   }
 
@@ -3625,289 +4791,218 @@ int32_t ism330dhcx_aux_den_polarity_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Configure DEN mode on the OIS chain.[set]
+  * @brief  OIS chain on aux interface power on mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lvl2_ois in reg INT_OIS
+  * @param  val    Change the values of ois_on in reg CTRL7_G
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_den_mode_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_lvl2_ois_t val)
+int32_t ism330dhcx_aux_pw_on_ctrl_set(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_ois_on_t val)
 {
-  ism330dhcx_int_ois_t int_ois;
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_ctrl7_g_t ctrl7_g;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
-
-  if (ret == 0)
-  {
-    int_ois.lvl2_ois = (uint8_t)val & 0x01U;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
-                               (uint8_t *)&int_ois, 1);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
+                            (uint8_t *)&ctrl7_g, 1);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                              (uint8_t *)&ctrl1_ois, 1);
+    ctrl7_g.ois_on_en = (uint8_t)val & 0x01U;
+    ctrl7_g.ois_on = (uint8_t)val & 0x01U;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL7_G,
+                               (uint8_t *)&ctrl7_g, 1);
   }
 
-  if (ret == 0)
-  {
-    ctrl1_ois.lvl1_ois = ((uint8_t)val & 0x02U) >> 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                               (uint8_t *)&ctrl1_ois, 1);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Configure DEN mode on the OIS chain.[get]
+  * @brief  OIS chain on aux interface power on mode[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of lvl2_ois in reg INT_OIS
+  * @param  val    Get the values of ois_on in reg CTRL7_G
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_den_mode_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_lvl2_ois_t *val)
+int32_t ism330dhcx_aux_pw_on_ctrl_get(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_ois_on_t *val)
 {
-  ism330dhcx_int_ois_t int_ois;
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_ctrl7_g_t ctrl7_g;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL7_G,
+                            (uint8_t *)&ctrl7_g, 1);
 
-  if (ret == 0)
+  switch (ctrl7_g.ois_on)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                              (uint8_t *)&ctrl1_ois, 1);
-  }
+    case ISM330DHCX_AUX_ON:
+      *val = ISM330DHCX_AUX_ON;
+      break;
 
-  switch ((ctrl1_ois.lvl1_ois << 1) + int_ois.lvl2_ois)
-  {
-    case ISM330DHCX_AUX_DEN_DISABLE:
-      *val = ISM330DHCX_AUX_DEN_DISABLE;
+    case ISM330DHCX_AUX_ON_BY_AUX_INTERFACE:
+      *val = ISM330DHCX_AUX_ON_BY_AUX_INTERFACE;
       break;
 
-    case ISM330DHCX_AUX_DEN_LEVEL_LATCH:
-      *val = ISM330DHCX_AUX_DEN_LEVEL_LATCH;
+    default:
+      *val = ISM330DHCX_AUX_ON;
       break;
-
-    case ISM330DHCX_AUX_DEN_LEVEL_TRIG:
-      *val = ISM330DHCX_AUX_DEN_LEVEL_TRIG;
-      break;
-
-    default:
-      *val = ISM330DHCX_AUX_DEN_DISABLE;
-      break;
-  }
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Enables/Disable OIS chain DRDY on INT2 pin. This setting has
-  *         priority over all other INT2 settings.[set]
+  * @brief  The STATUS_SPIAux register is read by the auxiliary SPI.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_drdy_ois in reg INT_OIS
+  * @param  ism330dhcx_status_spiaux_t: registers STATUS_SPIAUX
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_drdy_on_int2_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
+int32_t ism330dhcx_aux_status_reg_get(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_status_spiaux_t *val)
 {
-  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
-
-  if (ret == 0)
-  {
-    int_ois.int2_drdy_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
-                               (uint8_t *)&int_ois, 1);
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
+                            (uint8_t *)val, 1);
 
   return ret;
 }
 
 /**
-  * @brief  Enables/Disable OIS chain DRDY on INT2 pin. This setting has
-  *         priority over all other INT2 settings.[get]
+  * @brief  AUX accelerometer data available.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_drdy_ois in reg INT_OIS
+  * @param  val    Change the values of xlda in reg STATUS_SPIAUX
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_drdy_on_int2_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
+int32_t ism330dhcx_aux_xl_flag_data_ready_get(const stmdev_ctx_t *ctx,
+                                              uint8_t *val)
 {
-  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_status_spiaux_t status_spiaux;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
-                            (uint8_t *)&int_ois, 1);
-  *val = int_ois.int2_drdy_ois;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
+                            (uint8_t *)&status_spiaux, 1);
+  *val = status_spiaux.xlda;
 
   return ret;
 }
 
 /**
-  * @brief  Enables OIS chain data processing for gyro in Mode 3 and Mode 4
-  *         (mode4_en = 1) and accelerometer data in and Mode 4 (mode4_en = 1).
-  *         When the OIS chain is enabled, the OIS outputs are available
-  *         through the SPI2 in registers OUTX_L_G (22h) through OUTZ_H_G(27h)
-  *         and STATUS_REG (1Eh) / STATUS_SPIAux, and LPF1 is dedicated to
-  *         this chain.[set]
+  * @brief  AUX gyroscope data available.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ois_en_spi2 in reg CTRL1_OIS
+  * @param  val    Change the values of gda in reg STATUS_SPIAUX
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_mode_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_ois_en_spi2_t val)
+int32_t ism330dhcx_aux_gy_flag_data_ready_get(const stmdev_ctx_t *ctx,
+                                              uint8_t *val)
 {
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_status_spiaux_t status_spiaux;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                            (uint8_t *)&ctrl1_ois, 1);
-
-  if (ret == 0)
-  {
-    ctrl1_ois.ois_en_spi2 = (uint8_t)val & 0x01U;
-    ctrl1_ois.mode4_en = ((uint8_t)val & 0x02U) >> 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                               (uint8_t *)&ctrl1_ois, 1);
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
+                            (uint8_t *)&status_spiaux, 1);
+  *val = status_spiaux.gda;
 
   return ret;
 }
 
 /**
-  * @brief  Enables OIS chain data processing for gyro in Mode 3 and Mode 4
-  *         (mode4_en = 1) and accelerometer data in and Mode 4 (mode4_en = 1).
-  *         When the OIS chain is enabled, the OIS outputs are available
-  *         through the SPI2 in registers OUTX_L_G (22h) through OUTZ_H_G(27h)
-  *         and STATUS_REG (1Eh) / STATUS_SPIAux, and LPF1 is dedicated to
-  *         this chain.[get]
+  * @brief  High when the gyroscope output is in the settling phase.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ois_en_spi2 in
-  *                                reg CTRL1_OIS
+  * @param  val    Change the values of gyro_settling in reg STATUS_SPIAUX
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_mode_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_ois_en_spi2_t *val)
+int32_t ism330dhcx_aux_gy_flag_settling_get(const stmdev_ctx_t *ctx,
+                                            uint8_t *val)
 {
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_status_spiaux_t status_spiaux;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                            (uint8_t *)&ctrl1_ois, 1);
-
-  switch (((ctrl1_ois.mode4_en << 1) + ctrl1_ois.ois_en_spi2))
-  {
-    case ISM330DHCX_AUX_DISABLE:
-      *val = ISM330DHCX_AUX_DISABLE;
-      break;
-
-    case ISM330DHCX_MODE_3_GY:
-      *val = ISM330DHCX_MODE_3_GY;
-      break;
-
-    case ISM330DHCX_MODE_4_GY_XL:
-      *val = ISM330DHCX_MODE_4_GY_XL;
-      break;
-
-    default:
-      *val = ISM330DHCX_AUX_DISABLE;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_SPIAUX,
+                            (uint8_t *)&status_spiaux, 1);
+  *val = status_spiaux.gyro_settling;
 
   return ret;
 }
 
 /**
-  * @brief  Selects gyroscope OIS chain full-scale.[set]
+  * @brief  Selects accelerometer self-test. Effective only if XL OIS chain is
+  *         enabled.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fs_g_ois in reg CTRL1_OIS
+  * @param  val    Change the values of st_xl_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_full_scale_set(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_fs_g_ois_t val)
+int32_t ism330dhcx_aux_xl_self_test_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_st_xl_ois_t val)
 {
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                            (uint8_t *)&ctrl1_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
   if (ret == 0)
   {
-    ctrl1_ois.fs_g_ois = (uint8_t)val & 0x03U;
-    ctrl1_ois.fs_125_ois = ((uint8_t)val & 0x04U) >> 2;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                               (uint8_t *)&ctrl1_ois, 1);
+    int_ois.st_xl_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
+                               (uint8_t *)&int_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects gyroscope OIS chain full-scale.[get]
+  * @brief  Selects accelerometer self-test. Effective only if XL OIS chain
+  *         is enabled.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fs_g_ois in reg CTRL1_OIS
+  * @param  val    Get the values of st_xl_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_full_scale_get(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_fs_g_ois_t *val)
+int32_t ism330dhcx_aux_xl_self_test_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_st_xl_ois_t *val)
 {
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                            (uint8_t *)&ctrl1_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
-  switch ((ctrl1_ois.fs_125_ois << 2) + ctrl1_ois.fs_g_ois)
+  switch (int_ois.st_xl_ois)
   {
-    case ISM330DHCX_250dps_AUX:
-      *val = ISM330DHCX_250dps_AUX;
-      break;
-
-    case ISM330DHCX_125dps_AUX:
-      *val = ISM330DHCX_125dps_AUX;
-      break;
-
-    case ISM330DHCX_500dps_AUX:
-      *val = ISM330DHCX_500dps_AUX;
+    case ISM330DHCX_AUX_XL_DISABLE:
+      *val = ISM330DHCX_AUX_XL_DISABLE;
       break;
 
-    case ISM330DHCX_1000dps_AUX:
-      *val = ISM330DHCX_1000dps_AUX;
+    case ISM330DHCX_AUX_XL_POS:
+      *val = ISM330DHCX_AUX_XL_POS;
       break;
 
-    case ISM330DHCX_2000dps_AUX:
-      *val = ISM330DHCX_2000dps_AUX;
+    case ISM330DHCX_AUX_XL_NEG:
+      *val = ISM330DHCX_AUX_XL_NEG;
       break;
 
     default:
-      *val = ISM330DHCX_250dps_AUX;
+      *val = ISM330DHCX_AUX_XL_DISABLE;
       break;
   }
 
@@ -3915,61 +5010,64 @@ int32_t ism330dhcx_aux_gy_full_scale_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  SPI2 3- or 4-wire interface.[set]
+  * @brief  Indicates polarity of DEN signal on OIS chain.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sim_ois in reg CTRL1_OIS
+  * @param  val    Change the values of den_lh_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_spi_mode_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sim_ois_t val)
+int32_t ism330dhcx_aux_den_polarity_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_den_lh_ois_t val)
 {
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                            (uint8_t *)&ctrl1_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
   if (ret == 0)
   {
-    ctrl1_ois.sim_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                               (uint8_t *)&ctrl1_ois, 1);
+    int_ois.den_lh_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
+                               (uint8_t *)&int_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  SPI2 3- or 4-wire interface.[get]
+  * @brief  Indicates polarity of DEN signal on OIS chain.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sim_ois in reg CTRL1_OIS
+  * @param  val    Get the values of den_lh_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_spi_mode_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sim_ois_t *val)
+int32_t ism330dhcx_aux_den_polarity_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_den_lh_ois_t *val)
 {
-  ism330dhcx_ctrl1_ois_t ctrl1_ois;
+  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
-                            (uint8_t *)&ctrl1_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
-  switch (ctrl1_ois.sim_ois)
+  switch (int_ois.den_lh_ois)
   {
-    case ISM330DHCX_AUX_SPI_4_WIRE:
-      *val = ISM330DHCX_AUX_SPI_4_WIRE;
+    case ISM330DHCX_AUX_DEN_ACTIVE_LOW:
+      *val = ISM330DHCX_AUX_DEN_ACTIVE_LOW;
       break;
 
-    case ISM330DHCX_AUX_SPI_3_WIRE:
-      *val = ISM330DHCX_AUX_SPI_3_WIRE;
+    case ISM330DHCX_AUX_DEN_ACTIVE_HIGH:
+      *val = ISM330DHCX_AUX_DEN_ACTIVE_HIGH;
       break;
 
     default:
-      *val = ISM330DHCX_AUX_SPI_4_WIRE;
+      *val = ISM330DHCX_AUX_DEN_ACTIVE_LOW;
       break;
   }
 
@@ -3977,210 +5075,226 @@ int32_t ism330dhcx_aux_spi_mode_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Selects gyroscope digital LPF1 filter bandwidth.[set]
+  * @brief  Configure DEN mode on the OIS chain.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ftype_ois in reg CTRL2_OIS
+  * @param  val    Change the values of lvl2_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_lp1_bandwidth_set(const stmdev_ctx_t *ctx,
-                                            ism330dhcx_ftype_ois_t val)
+int32_t ism330dhcx_aux_den_mode_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_lvl2_ois_t val)
 {
-  ism330dhcx_ctrl2_ois_t ctrl2_ois;
+  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
-                            (uint8_t *)&ctrl2_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
   if (ret == 0)
   {
-    ctrl2_ois.ftype_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL2_OIS,
-                               (uint8_t *)&ctrl2_ois, 1);
+    int_ois.lvl2_ois = (uint8_t)val & 0x01U;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
+                               (uint8_t *)&int_ois, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                              (uint8_t *)&ctrl1_ois, 1);
+  }
 
-/**
-  * @brief  Selects gyroscope digital LPF1 filter bandwidth.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ftype_ois in reg CTRL2_OIS
+  if (ret == 0)
+  {
+    ctrl1_ois.lvl1_ois = ((uint8_t)val & 0x02U) >> 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                               (uint8_t *)&ctrl1_ois, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Configure DEN mode on the OIS chain.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of lvl2_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
-                                            ism330dhcx_ftype_ois_t *val)
+int32_t ism330dhcx_aux_den_mode_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_lvl2_ois_t *val)
 {
-  ism330dhcx_ctrl2_ois_t ctrl2_ois;
+  ism330dhcx_int_ois_t int_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
-                            (uint8_t *)&ctrl2_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
-  switch (ctrl2_ois.ftype_ois)
+  if (ret == 0)
   {
-    case ISM330DHCX_351Hz39:
-      *val = ISM330DHCX_351Hz39;
-      break;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                              (uint8_t *)&ctrl1_ois, 1);
+  }
 
-    case ISM330DHCX_236Hz63:
-      *val = ISM330DHCX_236Hz63;
+  switch ((ctrl1_ois.lvl1_ois << 1) + int_ois.lvl2_ois)
+  {
+    case ISM330DHCX_AUX_DEN_DISABLE:
+      *val = ISM330DHCX_AUX_DEN_DISABLE;
       break;
 
-    case ISM330DHCX_172Hz70:
-      *val = ISM330DHCX_172Hz70;
+    case ISM330DHCX_AUX_DEN_LEVEL_LATCH:
+      *val = ISM330DHCX_AUX_DEN_LEVEL_LATCH;
       break;
 
-    case ISM330DHCX_937Hz91:
-      *val = ISM330DHCX_937Hz91;
+    case ISM330DHCX_AUX_DEN_LEVEL_TRIG:
+      *val = ISM330DHCX_AUX_DEN_LEVEL_TRIG;
       break;
 
     default:
-      *val = ISM330DHCX_351Hz39;
+      *val = ISM330DHCX_AUX_DEN_DISABLE;
       break;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects gyroscope OIS chain digital high-pass filter cutoff.[set]
+  * @brief  Enables/Disable OIS chain DRDY on INT2 pin. This setting has
+  *         priority over all other INT2 settings.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of hpm_ois in reg CTRL2_OIS
+  * @param  val    Change the values of int2_drdy_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_hp_bandwidth_set(const stmdev_ctx_t *ctx,
-                                           ism330dhcx_hpm_ois_t val)
+int32_t ism330dhcx_aux_drdy_on_int2_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
 {
-  ism330dhcx_ctrl2_ois_t ctrl2_ois;
+  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
-                            (uint8_t *)&ctrl2_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
 
   if (ret == 0)
   {
-    ctrl2_ois.hpm_ois = (uint8_t)val & 0x03U;
-    ctrl2_ois.hp_en_ois = ((uint8_t)val & 0x10U) >> 4;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL2_OIS,
-                               (uint8_t *)&ctrl2_ois, 1);
+    int_ois.int2_drdy_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_OIS,
+                               (uint8_t *)&int_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects gyroscope OIS chain digital high-pass filter cutoff.[get]
+  * @brief  Enables/Disable OIS chain DRDY on INT2 pin. This setting has
+  *         priority over all other INT2 settings.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of hpm_ois in reg CTRL2_OIS
+  * @param  val    Change the values of int2_drdy_ois in reg INT_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_hp_bandwidth_get(const stmdev_ctx_t *ctx,
-                                           ism330dhcx_hpm_ois_t *val)
+int32_t ism330dhcx_aux_drdy_on_int2_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
 {
-  ism330dhcx_ctrl2_ois_t ctrl2_ois;
+  ism330dhcx_int_ois_t int_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
-                            (uint8_t *)&ctrl2_ois, 1);
-
-  switch ((ctrl2_ois.hp_en_ois << 4) + ctrl2_ois.hpm_ois)
-  {
-    case ISM330DHCX_AUX_HP_DISABLE:
-      *val = ISM330DHCX_AUX_HP_DISABLE;
-      break;
-
-    case ISM330DHCX_AUX_HP_Hz016:
-      *val = ISM330DHCX_AUX_HP_Hz016;
-      break;
-
-    case ISM330DHCX_AUX_HP_Hz065:
-      *val = ISM330DHCX_AUX_HP_Hz065;
-      break;
-
-    case ISM330DHCX_AUX_HP_Hz260:
-      *val = ISM330DHCX_AUX_HP_Hz260;
-      break;
-
-    case ISM330DHCX_AUX_HP_1Hz040:
-      *val = ISM330DHCX_AUX_HP_1Hz040;
-      break;
-
-    default:
-      *val = ISM330DHCX_AUX_HP_DISABLE;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_OIS,
+                            (uint8_t *)&int_ois, 1);
+  *val = int_ois.int2_drdy_ois;
 
   return ret;
 }
 
 /**
-  * @brief  Enable / Disables OIS chain clamp. Enable: All OIS chain
-  *         outputs = 8000h during self-test; Disable: OIS chain self-test
-  *         outputs dependent from the aux gyro full scale selected.[set]
+  * @brief  Enables OIS chain data processing for gyro in Mode 3 and Mode 4
+  *         (mode4_en = 1) and accelerometer data in and Mode 4 (mode4_en = 1).
+  *         When the OIS chain is enabled, the OIS outputs are available
+  *         through the SPI2 in registers OUTX_L_G (22h) through OUTZ_H_G(27h)
+  *         and STATUS_REG (1Eh) / STATUS_SPIAux, and LPF1 is dedicated to
+  *         this chain.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of st_ois_clampdis in reg CTRL3_OIS
+  * @param  val    Change the values of ois_en_spi2 in reg CTRL1_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_clamp_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_st_ois_clampdis_t val)
+int32_t ism330dhcx_aux_mode_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_ois_en_spi2_t val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                            (uint8_t *)&ctrl1_ois, 1);
 
   if (ret == 0)
   {
-    ctrl3_ois.st_ois_clampdis = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                               (uint8_t *)&ctrl3_ois, 1);
+    ctrl1_ois.ois_en_spi2 = (uint8_t)val & 0x01U;
+    ctrl1_ois.mode4_en = ((uint8_t)val & 0x02U) >> 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                               (uint8_t *)&ctrl1_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable / Disables OIS chain clamp. Enable: All OIS chain
-  *         outputs = 8000h during self-test; Disable: OIS chain self-test
-  *         outputs dependent from the aux gyro full scale selected.[get]
+  * @brief  Enables OIS chain data processing for gyro in Mode 3 and Mode 4
+  *         (mode4_en = 1) and accelerometer data in and Mode 4 (mode4_en = 1).
+  *         When the OIS chain is enabled, the OIS outputs are available
+  *         through the SPI2 in registers OUTX_L_G (22h) through OUTZ_H_G(27h)
+  *         and STATUS_REG (1Eh) / STATUS_SPIAux, and LPF1 is dedicated to
+  *         this chain.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st_ois_clampdis in reg CTRL3_OIS
+  * @param  val    Get the values of ois_en_spi2 in
+  *                                reg CTRL1_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_clamp_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_st_ois_clampdis_t *val)
+int32_t ism330dhcx_aux_mode_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_ois_en_spi2_t *val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                            (uint8_t *)&ctrl1_ois, 1);
 
-  switch (ctrl3_ois.st_ois_clampdis)
+  switch (((ctrl1_ois.mode4_en << 1) + ctrl1_ois.ois_en_spi2))
   {
-    case ISM330DHCX_ENABLE_CLAMP:
-      *val = ISM330DHCX_ENABLE_CLAMP;
+    case ISM330DHCX_AUX_DISABLE:
+      *val = ISM330DHCX_AUX_DISABLE;
       break;
 
-    case ISM330DHCX_DISABLE_CLAMP:
-      *val = ISM330DHCX_DISABLE_CLAMP;
+    case ISM330DHCX_MODE_3_GY:
+      *val = ISM330DHCX_MODE_3_GY;
+      break;
+
+    case ISM330DHCX_MODE_4_GY_XL:
+      *val = ISM330DHCX_MODE_4_GY_XL;
       break;
 
     default:
-      *val = ISM330DHCX_ENABLE_CLAMP;
+      *val = ISM330DHCX_AUX_DISABLE;
       break;
   }
 
@@ -4188,65 +5302,77 @@ int32_t ism330dhcx_aux_gy_clamp_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Selects gyroscope OIS chain self-test.[set]
+  * @brief  Selects gyroscope OIS chain full-scale.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of st_ois in reg CTRL3_OIS
+  * @param  val    Change the values of fs_g_ois in reg CTRL1_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_self_test_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_st_ois_t val)
+int32_t ism330dhcx_aux_gy_full_scale_set(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_fs_g_ois_t val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                            (uint8_t *)&ctrl1_ois, 1);
 
   if (ret == 0)
   {
-    ctrl3_ois.st_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                               (uint8_t *)&ctrl3_ois, 1);
+    ctrl1_ois.fs_g_ois = (uint8_t)val & 0x03U;
+    ctrl1_ois.fs_125_ois = ((uint8_t)val & 0x04U) >> 2;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                               (uint8_t *)&ctrl1_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects gyroscope OIS chain self-test.[get]
+  * @brief  Selects gyroscope OIS chain full-scale.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st_ois in reg CTRL3_OIS
+  * @param  val    Get the values of fs_g_ois in reg CTRL1_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_gy_self_test_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_st_ois_t *val)
+int32_t ism330dhcx_aux_gy_full_scale_get(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_fs_g_ois_t *val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                            (uint8_t *)&ctrl1_ois, 1);
 
-  switch (ctrl3_ois.st_ois)
+  switch ((ctrl1_ois.fs_125_ois << 2) + ctrl1_ois.fs_g_ois)
   {
-    case ISM330DHCX_AUX_GY_DISABLE:
-      *val = ISM330DHCX_AUX_GY_DISABLE;
+    case ISM330DHCX_250dps_AUX:
+      *val = ISM330DHCX_250dps_AUX;
       break;
 
-    case ISM330DHCX_AUX_GY_POS:
-      *val = ISM330DHCX_AUX_GY_POS;
+    case ISM330DHCX_125dps_AUX:
+      *val = ISM330DHCX_125dps_AUX;
       break;
 
-    case ISM330DHCX_AUX_GY_NEG:
-      *val = ISM330DHCX_AUX_GY_NEG;
+    case ISM330DHCX_500dps_AUX:
+      *val = ISM330DHCX_500dps_AUX;
+      break;
+
+    case ISM330DHCX_1000dps_AUX:
+      *val = ISM330DHCX_1000dps_AUX;
+      break;
+
+    case ISM330DHCX_2000dps_AUX:
+      *val = ISM330DHCX_2000dps_AUX;
       break;
 
     default:
-      *val = ISM330DHCX_AUX_GY_DISABLE;
+      *val = ISM330DHCX_250dps_AUX;
       break;
   }
 
@@ -4254,85 +5380,64 @@ int32_t ism330dhcx_aux_gy_self_test_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Selects accelerometer OIS channel bandwidth.[set]
+  * @brief  SPI2 3- or 4-wire interface.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of filter_xl_conf_ois in reg CTRL3_OIS
+  * @param  val    Change the values of sim_ois in reg CTRL1_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_bandwidth_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_filter_xl_conf_ois_t val)
+int32_t ism330dhcx_aux_spi_mode_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sim_ois_t val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                            (uint8_t *)&ctrl1_ois, 1);
 
   if (ret == 0)
   {
-    ctrl3_ois.filter_xl_conf_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                               (uint8_t *)&ctrl3_ois, 1);
+    ctrl1_ois.sim_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                               (uint8_t *)&ctrl1_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects accelerometer OIS channel bandwidth.[get]
+  * @brief  SPI2 3- or 4-wire interface.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of filter_xl_conf_ois in reg CTRL3_OIS
+  * @param  val    Get the values of sim_ois in reg CTRL1_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_bandwidth_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_filter_xl_conf_ois_t *val)
+int32_t ism330dhcx_aux_spi_mode_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sim_ois_t *val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl1_ois_t ctrl1_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_OIS,
+                            (uint8_t *)&ctrl1_ois, 1);
 
-  switch (ctrl3_ois.filter_xl_conf_ois)
+  switch (ctrl1_ois.sim_ois)
   {
-    case ISM330DHCX_631Hz:
-      *val = ISM330DHCX_631Hz;
-      break;
-
-    case ISM330DHCX_295Hz:
-      *val = ISM330DHCX_295Hz;
-      break;
-
-    case ISM330DHCX_140Hz:
-      *val = ISM330DHCX_140Hz;
-      break;
-
-    case ISM330DHCX_68Hz2:
-      *val = ISM330DHCX_68Hz2;
-      break;
-
-    case ISM330DHCX_33Hz6:
-      *val = ISM330DHCX_33Hz6;
-      break;
-
-    case ISM330DHCX_16Hz7:
-      *val = ISM330DHCX_16Hz7;
-      break;
-
-    case ISM330DHCX_8Hz3:
-      *val = ISM330DHCX_8Hz3;
+    case ISM330DHCX_AUX_SPI_4_WIRE:
+      *val = ISM330DHCX_AUX_SPI_4_WIRE;
       break;
 
-    case ISM330DHCX_4Hz11:
-      *val = ISM330DHCX_4Hz11;
+    case ISM330DHCX_AUX_SPI_3_WIRE:
+      *val = ISM330DHCX_AUX_SPI_3_WIRE;
       break;
 
     default:
-      *val = ISM330DHCX_631Hz;
+      *val = ISM330DHCX_AUX_SPI_4_WIRE;
       break;
   }
 
@@ -4340,69 +5445,72 @@ int32_t ism330dhcx_aux_xl_bandwidth_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Selects accelerometer OIS channel full-scale.[set]
+  * @brief  Selects gyroscope digital LPF1 filter bandwidth.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fs_xl_ois in reg CTRL3_OIS
+  * @param  val    Change the values of ftype_ois in reg CTRL2_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_full_scale_set(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_fs_xl_ois_t val)
+int32_t ism330dhcx_aux_gy_lp1_bandwidth_set(const stmdev_ctx_t *ctx,
+                                            ism330dhcx_ftype_ois_t val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl2_ois_t ctrl2_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
+                            (uint8_t *)&ctrl2_ois, 1);
 
   if (ret == 0)
   {
-    ctrl3_ois.fs_xl_ois = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                               (uint8_t *)&ctrl3_ois, 1);
+    ctrl2_ois.ftype_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL2_OIS,
+                               (uint8_t *)&ctrl2_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects accelerometer OIS channel full-scale.[get]
+  * @brief  Selects gyroscope digital LPF1 filter bandwidth.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fs_xl_ois in reg CTRL3_OIS
+  * @param  val    Get the values of ftype_ois in reg CTRL2_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_aux_xl_full_scale_get(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_fs_xl_ois_t *val)
+int32_t ism330dhcx_aux_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
+                                            ism330dhcx_ftype_ois_t *val)
 {
-  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  ism330dhcx_ctrl2_ois_t ctrl2_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
-                            (uint8_t *)&ctrl3_ois, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
+                            (uint8_t *)&ctrl2_ois, 1);
 
-  switch (ctrl3_ois.fs_xl_ois)
+  switch (ctrl2_ois.ftype_ois)
   {
-    case ISM330DHCX_AUX_2g:
-      *val = ISM330DHCX_AUX_2g;
+    case ISM330DHCX_351Hz39:
+      *val = ISM330DHCX_351Hz39;
       break;
 
-    case ISM330DHCX_AUX_16g:
-      *val = ISM330DHCX_AUX_16g;
+    case ISM330DHCX_236Hz63:
+      *val = ISM330DHCX_236Hz63;
       break;
 
-    case ISM330DHCX_AUX_4g:
-      *val = ISM330DHCX_AUX_4g;
+    case ISM330DHCX_172Hz70:
+      *val = ISM330DHCX_172Hz70;
       break;
 
-    case ISM330DHCX_AUX_8g:
-      *val = ISM330DHCX_AUX_8g;
+    case ISM330DHCX_937Hz91:
+      *val = ISM330DHCX_937Hz91;
       break;
 
     default:
-      *val = ISM330DHCX_AUX_2g;
+      *val = ISM330DHCX_351Hz39;
       break;
   }
 
@@ -4410,74 +5518,77 @@ int32_t ism330dhcx_aux_xl_full_scale_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_ main_serial_interface
-  * @brief      This section groups all the functions concerning main
-  *             serial interface management (not auxiliary)
-  * @{
-  *
-  */
-
-/**
-  * @brief  Connect/Disconnect SDO/SA0 internal pull-up.[set]
+  * @brief  Selects gyroscope OIS chain digital high-pass filter cutoff.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sdo_pu_en in reg PIN_CTRL
+  * @param  val    Change the values of hpm_ois in reg CTRL2_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sdo_sa0_mode_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sdo_pu_en_t val)
+int32_t ism330dhcx_aux_gy_hp_bandwidth_set(const stmdev_ctx_t *ctx,
+                                           ism330dhcx_hpm_ois_t val)
 {
-  ism330dhcx_pin_ctrl_t pin_ctrl;
+  ism330dhcx_ctrl2_ois_t ctrl2_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
-                            (uint8_t *)&pin_ctrl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
+                            (uint8_t *)&ctrl2_ois, 1);
 
   if (ret == 0)
   {
-    pin_ctrl.sdo_pu_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PIN_CTRL,
-                               (uint8_t *)&pin_ctrl, 1);
+    ctrl2_ois.hpm_ois = (uint8_t)val & 0x03U;
+    ctrl2_ois.hp_en_ois = ((uint8_t)val & 0x10U) >> 4;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL2_OIS,
+                               (uint8_t *)&ctrl2_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Connect/Disconnect SDO/SA0 internal pull-up.[get]
+  * @brief  Selects gyroscope OIS chain digital high-pass filter cutoff.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sdo_pu_en in reg PIN_CTRL
+  * @param  val    Get the values of hpm_ois in reg CTRL2_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sdo_sa0_mode_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sdo_pu_en_t *val)
+int32_t ism330dhcx_aux_gy_hp_bandwidth_get(const stmdev_ctx_t *ctx,
+                                           ism330dhcx_hpm_ois_t *val)
 {
-  ism330dhcx_pin_ctrl_t pin_ctrl;
+  ism330dhcx_ctrl2_ois_t ctrl2_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
-                            (uint8_t *)&pin_ctrl, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL2_OIS,
+                            (uint8_t *)&ctrl2_ois, 1);
 
-  switch (pin_ctrl.sdo_pu_en)
+  switch ((ctrl2_ois.hp_en_ois << 4) + ctrl2_ois.hpm_ois)
   {
-    case ISM330DHCX_PULL_UP_DISC:
-      *val = ISM330DHCX_PULL_UP_DISC;
+    case ISM330DHCX_AUX_HP_DISABLE:
+      *val = ISM330DHCX_AUX_HP_DISABLE;
       break;
 
-    case ISM330DHCX_PULL_UP_CONNECT:
-      *val = ISM330DHCX_PULL_UP_CONNECT;
+    case ISM330DHCX_AUX_HP_Hz016:
+      *val = ISM330DHCX_AUX_HP_Hz016;
+      break;
+
+    case ISM330DHCX_AUX_HP_Hz065:
+      *val = ISM330DHCX_AUX_HP_Hz065;
+      break;
+
+    case ISM330DHCX_AUX_HP_Hz260:
+      *val = ISM330DHCX_AUX_HP_Hz260;
+      break;
+
+    case ISM330DHCX_AUX_HP_1Hz040:
+      *val = ISM330DHCX_AUX_HP_1Hz040;
       break;
 
     default:
-      *val = ISM330DHCX_PULL_UP_DISC;
+      *val = ISM330DHCX_AUX_HP_DISABLE;
       break;
   }
 
@@ -4485,61 +5596,68 @@ int32_t ism330dhcx_sdo_sa0_mode_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  SPI Serial Interface Mode selection.[set]
+  * @brief  Enable / Disables OIS chain clamp. Enable: All OIS chain
+  *         outputs = 8000h during self-test; Disable: OIS chain self-test
+  *         outputs dependent from the aux gyro full scale selected.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sim in reg CTRL3_C
+  * @param  val    Change the values of st_ois_clampdis in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_spi_mode_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_sim_t val)
+int32_t ism330dhcx_aux_gy_clamp_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_st_ois_clampdis_t val)
 {
-  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
   if (ret == 0)
   {
-    ctrl3_c.sim = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
-                               (uint8_t *)&ctrl3_c, 1);
+    ctrl3_ois.st_ois_clampdis = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                               (uint8_t *)&ctrl3_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  SPI Serial Interface Mode selection.[get]
+  * @brief  Enable / Disables OIS chain clamp. Enable: All OIS chain
+  *         outputs = 8000h during self-test; Disable: OIS chain self-test
+  *         outputs dependent from the aux gyro full scale selected.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sim in reg CTRL3_C
+  * @param  val    Get the values of st_ois_clampdis in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_spi_mode_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_sim_t *val)
+int32_t ism330dhcx_aux_gy_clamp_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_st_ois_clampdis_t *val)
 {
-  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
-  switch (ctrl3_c.sim)
+  switch (ctrl3_ois.st_ois_clampdis)
   {
-    case ISM330DHCX_SPI_4_WIRE:
-      *val = ISM330DHCX_SPI_4_WIRE;
+    case ISM330DHCX_ENABLE_CLAMP:
+      *val = ISM330DHCX_ENABLE_CLAMP;
       break;
 
-    case ISM330DHCX_SPI_3_WIRE:
-      *val = ISM330DHCX_SPI_3_WIRE;
+    case ISM330DHCX_DISABLE_CLAMP:
+      *val = ISM330DHCX_DISABLE_CLAMP;
       break;
 
     default:
-      *val = ISM330DHCX_SPI_4_WIRE;
+      *val = ISM330DHCX_ENABLE_CLAMP;
       break;
   }
 
@@ -4547,61 +5665,68 @@ int32_t ism330dhcx_spi_mode_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Disable / Enable I2C interface.[set]
+  * @brief  Selects gyroscope OIS chain self-test.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of i2c_disable in reg CTRL4_C
+  * @param  val    Change the values of st_ois in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_i2c_interface_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_i2c_disable_t val)
+int32_t ism330dhcx_aux_gy_self_test_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_st_ois_t val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
   if (ret == 0)
   {
-    ctrl4_c.i2c_disable = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
-                               (uint8_t *)&ctrl4_c, 1);
+    ctrl3_ois.st_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                               (uint8_t *)&ctrl3_ois, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Disable / Enable I2C interface.[get]
+  * @brief  Selects gyroscope OIS chain self-test.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of i2c reg CTRL4_C
+  * @param  val    Get the values of st_ois in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_i2c_interface_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_i2c_disable_t *val)
+int32_t ism330dhcx_aux_gy_self_test_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_st_ois_t *val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
-  switch (ctrl4_c.i2c_disable)
+  switch (ctrl3_ois.st_ois)
   {
-    case ISM330DHCX_I2C_ENABLE:
-      *val = ISM330DHCX_I2C_ENABLE;
+    case ISM330DHCX_AUX_GY_DISABLE:
+      *val = ISM330DHCX_AUX_GY_DISABLE;
       break;
 
-    case ISM330DHCX_I2C_DISABLE:
-      *val = ISM330DHCX_I2C_DISABLE;
+    case ISM330DHCX_AUX_GY_POS:
+      *val = ISM330DHCX_AUX_GY_POS;
+      break;
+
+    case ISM330DHCX_AUX_GY_NEG:
+      *val = ISM330DHCX_AUX_GY_NEG;
       break;
 
     default:
-      *val = ISM330DHCX_I2C_ENABLE;
+      *val = ISM330DHCX_AUX_GY_DISABLE;
       break;
   }
 
@@ -4609,439 +5734,285 @@ int32_t ism330dhcx_i2c_interface_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_interrupt_pins
-  * @brief      This section groups all the functions that manage
-  *             interrupt pins
-  * @{
-  *
-  */
-
-/**
-  * @brief   Select the signal that need to route on int1 pad[set]
+  * @brief  Selects accelerometer OIS channel bandwidth.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers: INT1_CTRL,MD1_CFG,
-  *                EMB_FUNC_INT1, FSM_INT1_A, FSM_INT1_B
+  * @param  val    Change the values of filter_xl_conf_ois in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_int1_route_set(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_pin_int1_route_t *val)
+int32_t ism330dhcx_aux_xl_bandwidth_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_filter_xl_conf_ois_t val)
 {
-  ism330dhcx_tap_cfg2_t tap_cfg2;
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MLC_INT1,
-                               (uint8_t *)&val->mlc_int1, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INT1,
-                               (uint8_t *)&val->emb_func_int1, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_INT1_A,
-                               (uint8_t *)&val->fsm_int1_a, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_INT1_B,
-                               (uint8_t *)&val->fsm_int1_b, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
-
-  if (ret == 0)
-  {
-    if ((val->emb_func_int1.int1_fsm_lc |
-         val->emb_func_int1.int1_sig_mot |
-         val->emb_func_int1.int1_step_detector |
-         val->emb_func_int1.int1_tilt |
-         val->fsm_int1_a.int1_fsm1 |
-         val->fsm_int1_a.int1_fsm2 |
-         val->fsm_int1_a.int1_fsm3 |
-         val->fsm_int1_a.int1_fsm4 |
-         val->fsm_int1_a.int1_fsm5 |
-         val->fsm_int1_a.int1_fsm6 |
-         val->fsm_int1_a.int1_fsm7 |
-         val->fsm_int1_a.int1_fsm8 |
-         val->fsm_int1_b.int1_fsm9 |
-         val->fsm_int1_b.int1_fsm10 |
-         val->fsm_int1_b.int1_fsm11 |
-         val->fsm_int1_b.int1_fsm12 |
-         val->fsm_int1_b.int1_fsm13 |
-         val->fsm_int1_b.int1_fsm14 |
-         val->fsm_int1_b.int1_fsm15 |
-         val->fsm_int1_b.int1_fsm16 |
-         val->mlc_int1.int1_mlc1 |
-         val->mlc_int1.int1_mlc2 |
-         val->mlc_int1.int1_mlc3 |
-         val->mlc_int1.int1_mlc4 |
-         val->mlc_int1.int1_mlc5 |
-         val->mlc_int1.int1_mlc6 |
-         val->mlc_int1.int1_mlc7 |
-         val->mlc_int1.int1_mlc8) != PROPERTY_DISABLE)
-    {
-      val->md1_cfg.int1_emb_func = PROPERTY_ENABLE;
-    }
-    else
-    {
-      val->md1_cfg.int1_emb_func = PROPERTY_DISABLE;
-    }
-
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT1_CTRL,
-                               (uint8_t *)&val->int1_ctrl, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MD1_CFG,
-                               (uint8_t *)&val->md1_cfg, 1);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
-                              (uint8_t *)&tap_cfg2, 1);
-
-    if ((val->int1_ctrl.den_drdy_flag |
-         val->int1_ctrl.int1_boot |
-         val->int1_ctrl.int1_cnt_bdr |
-         val->int1_ctrl.int1_drdy_g |
-         val->int1_ctrl.int1_drdy_xl |
-         val->int1_ctrl.int1_fifo_full |
-         val->int1_ctrl.int1_fifo_ovr |
-         val->int1_ctrl.int1_fifo_th |
-         val->md1_cfg.int1_shub |
-         val->md1_cfg.int1_6d |
-         val->md1_cfg.int1_double_tap |
-         val->md1_cfg.int1_ff |
-         val->md1_cfg.int1_wu |
-         val->md1_cfg.int1_single_tap |
-         val->md1_cfg.int1_sleep_change) != PROPERTY_DISABLE)
-    {
-      tap_cfg2.interrupts_enable = PROPERTY_ENABLE;
-    }
-
-    else
-    {
-      tap_cfg2.interrupts_enable = PROPERTY_DISABLE;
-    }
+    ctrl3_ois.filter_xl_conf_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                               (uint8_t *)&ctrl3_ois, 1);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
-                               (uint8_t *)&tap_cfg2, 1);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Select the signal that need to route on int1 pad.[get]
+  * @brief  Selects accelerometer OIS channel bandwidth.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers: INT1_CTRL, MD1_CFG,
-  *                EMB_FUNC_INT1, FSM_INT1_A, FSM_INT1_B.(ptr)
+  * @param  val    Get the values of filter_xl_conf_ois in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_int1_route_get(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_pin_int1_route_t *val)
+int32_t ism330dhcx_aux_xl_bandwidth_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_filter_xl_conf_ois_t *val)
 {
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
-  if (ret == 0)
+  switch (ctrl3_ois.filter_xl_conf_ois)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MLC_INT1,
-                              (uint8_t *)&val->mlc_int1, 1);
-  }
+    case ISM330DHCX_631Hz:
+      *val = ISM330DHCX_631Hz;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INT1,
-                              (uint8_t *)&val->emb_func_int1, 1);
-  }
+    case ISM330DHCX_295Hz:
+      *val = ISM330DHCX_295Hz;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT1_A,
-                              (uint8_t *)&val->fsm_int1_a, 1);
-  }
+    case ISM330DHCX_140Hz:
+      *val = ISM330DHCX_140Hz;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT1_B,
-                              (uint8_t *)&val->fsm_int1_b, 1);
-  }
+    case ISM330DHCX_68Hz2:
+      *val = ISM330DHCX_68Hz2;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+    case ISM330DHCX_33Hz6:
+      *val = ISM330DHCX_33Hz6;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT1_CTRL,
-                              (uint8_t *)&val->int1_ctrl, 1);
-  }
+    case ISM330DHCX_16Hz7:
+      *val = ISM330DHCX_16Hz7;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MD1_CFG,
-                              (uint8_t *)&val->md1_cfg, 1);
+    case ISM330DHCX_8Hz3:
+      *val = ISM330DHCX_8Hz3;
+      break;
+
+    case ISM330DHCX_4Hz11:
+      *val = ISM330DHCX_4Hz11;
+      break;
+
+    default:
+      *val = ISM330DHCX_631Hz;
+      break;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Select the signal that need to route on int2 pad[set]
+  * @brief  Selects accelerometer OIS channel full-scale.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers INT2_CTRL,  MD2_CFG,
-  *                EMB_FUNC_INT2, FSM_INT2_A, FSM_INT2_B
+  * @param  val    Change the values of fs_xl_ois in reg CTRL3_OIS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_int2_route_set(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_pin_int2_route_t *val)
+int32_t ism330dhcx_aux_xl_full_scale_set(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_fs_xl_ois_t val)
 {
-  ism330dhcx_tap_cfg2_t tap_cfg2;
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MLC_INT2,
-                               (uint8_t *)&val->mlc_int2, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INT2,
-                               (uint8_t *)&val->emb_func_int2, 1);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_INT2_A,
-                               (uint8_t *)&val->fsm_int2_a, 1);
+    ctrl3_ois.fs_xl_ois = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                               (uint8_t *)&ctrl3_ois, 1);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_INT2_B,
-                               (uint8_t *)&val->fsm_int2_b, 1);
-  }
+  ism330dhcx_unlock(ctx);
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  return ret;
+}
 
-  if (ret == 0)
-  {
-    if ((val->emb_func_int2.int2_step_detector |
-         val->emb_func_int2.int2_tilt |
-         val->emb_func_int2.int2_sig_mot |
-         val->emb_func_int2.int2_fsm_lc |
-         val->fsm_int2_a.int2_fsm1 |
-         val->fsm_int2_a.int2_fsm2 |
-         val->fsm_int2_a.int2_fsm3 |
-         val->fsm_int2_a.int2_fsm4 |
-         val->fsm_int2_a.int2_fsm5 |
-         val->fsm_int2_a.int2_fsm6 |
-         val->fsm_int2_a.int2_fsm7 |
-         val->fsm_int2_a.int2_fsm8 |
-         val->fsm_int2_b.int2_fsm9 |
-         val->fsm_int2_b.int2_fsm10 |
-         val->fsm_int2_b.int2_fsm11 |
-         val->fsm_int2_b.int2_fsm12 |
-         val->fsm_int2_b.int2_fsm13 |
-         val->fsm_int2_b.int2_fsm14 |
-         val->fsm_int2_b.int2_fsm15 |
-         val->fsm_int2_b.int2_fsm16 |
-         val->mlc_int2.int2_mlc1 |
-         val->mlc_int2.int2_mlc2 |
-         val->mlc_int2.int2_mlc3 |
-         val->mlc_int2.int2_mlc4 |
-         val->mlc_int2.int2_mlc5 |
-         val->mlc_int2.int2_mlc6 |
-         val->mlc_int2.int2_mlc7 |
-         val->mlc_int2.int2_mlc8) != PROPERTY_DISABLE)
-    {
-      val->md2_cfg.int2_emb_func = PROPERTY_ENABLE;
-    }
-    else
-    {
-      val->md2_cfg.int2_emb_func = PROPERTY_DISABLE;
-    }
+/**
+  * @brief  Selects accelerometer OIS channel full-scale.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fs_xl_ois in reg CTRL3_OIS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_aux_xl_full_scale_get(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_fs_xl_ois_t *val)
+{
+  ism330dhcx_ctrl3_ois_t ctrl3_ois;
+  int32_t ret;
 
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT2_CTRL,
-                               (uint8_t *)&val->int2_ctrl, 1);
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_OIS,
+                            (uint8_t *)&ctrl3_ois, 1);
 
-  if (ret == 0)
+  switch (ctrl3_ois.fs_xl_ois)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MD2_CFG,
-                               (uint8_t *)&val->md2_cfg, 1);
-  }
+    case ISM330DHCX_AUX_2g:
+      *val = ISM330DHCX_AUX_2g;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
-                              (uint8_t *)&tap_cfg2, 1);
-  }
+    case ISM330DHCX_AUX_16g:
+      *val = ISM330DHCX_AUX_16g;
+      break;
 
-  if (ret == 0)
-  {
-    if ((val->int2_ctrl.int2_drdy_xl |
-         val->int2_ctrl.int2_drdy_g |
-         val->int2_ctrl.int2_drdy_temp |
-         val->int2_ctrl.int2_fifo_th |
-         val->int2_ctrl.int2_fifo_ovr |
-         val->int2_ctrl.int2_fifo_full |
-         val->int2_ctrl.int2_cnt_bdr |
-         val->md2_cfg.int2_6d |
-         val->md2_cfg.int2_double_tap |
-         val->md2_cfg.int2_ff |
-         val->md2_cfg.int2_wu |
-         val->md2_cfg.int2_single_tap |
-         val->md2_cfg.int2_sleep_change) != PROPERTY_DISABLE)
-    {
-      tap_cfg2.interrupts_enable = PROPERTY_ENABLE;
-    }
+    case ISM330DHCX_AUX_4g:
+      *val = ISM330DHCX_AUX_4g;
+      break;
 
-    else
-    {
-      tap_cfg2.interrupts_enable = PROPERTY_DISABLE;
-    }
+    case ISM330DHCX_AUX_8g:
+      *val = ISM330DHCX_AUX_8g;
+      break;
 
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
-                               (uint8_t *)&tap_cfg2, 1);
+    default:
+      *val = ISM330DHCX_AUX_2g;
+      break;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Select the signal that need to route on int2 pad.[get]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_ main_serial_interface
+  * @brief      This section groups all the functions concerning main
+  *             serial interface management (not auxiliary)
+  * @{
+  *
+  */
+
+/**
+  * @brief  Connect/Disconnect SDO/SA0 internal pull-up.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers INT2_CTRL,  MD2_CFG,
-  *                EMB_FUNC_INT2, FSM_INT2_A, FSM_INT2_B.[get]
+  * @param  val    Change the values of sdo_pu_en in reg PIN_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_int2_route_get(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_pin_int2_route_t *val)
+int32_t ism330dhcx_sdo_sa0_mode_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sdo_pu_en_t val)
 {
+  ism330dhcx_pin_ctrl_t pin_ctrl;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
+                            (uint8_t *)&pin_ctrl, 1);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MLC_INT2,
-                              (uint8_t *)&val->mlc_int2, 1);
+    pin_ctrl.sdo_pu_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PIN_CTRL,
+                               (uint8_t *)&pin_ctrl, 1);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INT2,
-                              (uint8_t *)&val->emb_func_int2, 1);
-  }
+  ism330dhcx_unlock(ctx);
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT2_A,
-                              (uint8_t *)&val->fsm_int2_a, 1);
-  }
+  return ret;
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT2_B,
-                              (uint8_t *)&val->fsm_int2_b, 1);
-  }
+/**
+  * @brief  Connect/Disconnect SDO/SA0 internal pull-up.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of sdo_pu_en in reg PIN_CTRL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_sdo_sa0_mode_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sdo_pu_en_t *val)
+{
+  ism330dhcx_pin_ctrl_t pin_ctrl;
+  int32_t ret;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PIN_CTRL,
+                            (uint8_t *)&pin_ctrl, 1);
 
-  if (ret == 0)
+  switch (pin_ctrl.sdo_pu_en)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT2_CTRL,
-                              (uint8_t *)&val->int2_ctrl, 1);
-  }
+    case ISM330DHCX_PULL_UP_DISC:
+      *val = ISM330DHCX_PULL_UP_DISC;
+      break;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MD2_CFG,
-                              (uint8_t *)&val->md2_cfg, 1);
+    case ISM330DHCX_PULL_UP_CONNECT:
+      *val = ISM330DHCX_PULL_UP_CONNECT;
+      break;
+
+    default:
+      *val = ISM330DHCX_PULL_UP_DISC;
+      break;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Push-pull/open drain selection on interrupt pads.[set]
+  * @brief  SPI Serial Interface Mode selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pp_od in reg CTRL3_C
+  * @param  val    Change the values of sim in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_mode_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_pp_od_t val)
+int32_t ism330dhcx_spi_mode_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_sim_t val)
 {
   ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
                             (uint8_t *)&ctrl3_c, 1);
 
   if (ret == 0)
   {
-    ctrl3_c.pp_od = (uint8_t)val;
+    ctrl3_c.sim = (uint8_t)val;
     ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
                                (uint8_t *)&ctrl3_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Push-pull/open drain selection on interrupt pads.[get]
+  * @brief  SPI Serial Interface Mode selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of pp_od in reg CTRL3_C
+  * @param  val    Get the values of sim in reg CTRL3_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_mode_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_pp_od_t *val)
+int32_t ism330dhcx_spi_mode_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_sim_t *val)
 {
   ism330dhcx_ctrl3_c_t ctrl3_c;
   int32_t ret;
@@ -5049,18 +6020,2732 @@ int32_t ism330dhcx_pin_mode_get(const stmdev_ctx_t *ctx,
   ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
                             (uint8_t *)&ctrl3_c, 1);
 
-  switch (ctrl3_c.pp_od)
-  {
-    case ISM330DHCX_PUSH_PULL:
-      *val = ISM330DHCX_PUSH_PULL;
+  switch (ctrl3_c.sim)
+  {
+    case ISM330DHCX_SPI_4_WIRE:
+      *val = ISM330DHCX_SPI_4_WIRE;
+      break;
+
+    case ISM330DHCX_SPI_3_WIRE:
+      *val = ISM330DHCX_SPI_3_WIRE;
+      break;
+
+    default:
+      *val = ISM330DHCX_SPI_4_WIRE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Disable / Enable I2C interface.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of i2c_disable in reg CTRL4_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_i2c_interface_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_i2c_disable_t val)
+{
+  ism330dhcx_ctrl4_c_t ctrl4_c;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+
+  if (ret == 0)
+  {
+    ctrl4_c.i2c_disable = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
+                               (uint8_t *)&ctrl4_c, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Disable / Enable I2C interface.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of i2c reg CTRL4_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_i2c_interface_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_i2c_disable_t *val)
+{
+  ism330dhcx_ctrl4_c_t ctrl4_c;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+
+  switch (ctrl4_c.i2c_disable)
+  {
+    case ISM330DHCX_I2C_ENABLE:
+      *val = ISM330DHCX_I2C_ENABLE;
+      break;
+
+    case ISM330DHCX_I2C_DISABLE:
+      *val = ISM330DHCX_I2C_DISABLE;
+      break;
+
+    default:
+      *val = ISM330DHCX_I2C_ENABLE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_interrupt_pins
+  * @brief      This section groups all the functions that manage
+  *             interrupt pins
+  * @{
+  *
+  */
+
+/**
+  * @brief   Select the signal that need to route on int1 pad[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Structure of registers: INT1_CTRL,MD1_CFG,
+  *                EMB_FUNC_INT1, FSM_INT1_A, FSM_INT1_B
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_int1_route_set(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_pin_int1_route_t *val)
+{
+  ism330dhcx_tap_cfg2_t tap_cfg2;
+  ism330dhcx_tx_t tx;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    /* EMB_FUNC_INT1, FSM_INT1_A, FSM_INT1_B, MLC_INT1: single burst */
+    ism330dhcx_tx_init(&tx);
+    ret = ism330dhcx_tx_write(&tx, ISM330DHCX_EMB_FUNC_INT1,
+                              (uint8_t *)&val->emb_func_int1, 1);
+    ret += ism330dhcx_tx_write(&tx, ISM330DHCX_FSM_INT1_A,
+                               (uint8_t *)&val->fsm_int1_a, 1);
+    ret += ism330dhcx_tx_write(&tx, ISM330DHCX_FSM_INT1_B,
+                               (uint8_t *)&val->fsm_int1_b, 1);
+    ret += ism330dhcx_tx_write(&tx, ISM330DHCX_MLC_INT1,
+                               (uint8_t *)&val->mlc_int1, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_tx_commit(ctx, &tx);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  if (ret == 0)
+  {
+    if ((val->emb_func_int1.int1_fsm_lc |
+         val->emb_func_int1.int1_sig_mot |
+         val->emb_func_int1.int1_step_detector |
+         val->emb_func_int1.int1_tilt |
+         val->fsm_int1_a.int1_fsm1 |
+         val->fsm_int1_a.int1_fsm2 |
+         val->fsm_int1_a.int1_fsm3 |
+         val->fsm_int1_a.int1_fsm4 |
+         val->fsm_int1_a.int1_fsm5 |
+         val->fsm_int1_a.int1_fsm6 |
+         val->fsm_int1_a.int1_fsm7 |
+         val->fsm_int1_a.int1_fsm8 |
+         val->fsm_int1_b.int1_fsm9 |
+         val->fsm_int1_b.int1_fsm10 |
+         val->fsm_int1_b.int1_fsm11 |
+         val->fsm_int1_b.int1_fsm12 |
+         val->fsm_int1_b.int1_fsm13 |
+         val->fsm_int1_b.int1_fsm14 |
+         val->fsm_int1_b.int1_fsm15 |
+         val->fsm_int1_b.int1_fsm16 |
+         val->mlc_int1.int1_mlc1 |
+         val->mlc_int1.int1_mlc2 |
+         val->mlc_int1.int1_mlc3 |
+         val->mlc_int1.int1_mlc4 |
+         val->mlc_int1.int1_mlc5 |
+         val->mlc_int1.int1_mlc6 |
+         val->mlc_int1.int1_mlc7 |
+         val->mlc_int1.int1_mlc8) != PROPERTY_DISABLE)
+    {
+      val->md1_cfg.int1_emb_func = PROPERTY_ENABLE;
+    }
+    else
+    {
+      val->md1_cfg.int1_emb_func = PROPERTY_DISABLE;
+    }
+
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT1_CTRL,
+                               (uint8_t *)&val->int1_ctrl, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MD1_CFG,
+                               (uint8_t *)&val->md1_cfg, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
+                              (uint8_t *)&tap_cfg2, 1);
+
+    if ((val->int1_ctrl.den_drdy_flag |
+         val->int1_ctrl.int1_boot |
+         val->int1_ctrl.int1_cnt_bdr |
+         val->int1_ctrl.int1_drdy_g |
+         val->int1_ctrl.int1_drdy_xl |
+         val->int1_ctrl.int1_fifo_full |
+         val->int1_ctrl.int1_fifo_ovr |
+         val->int1_ctrl.int1_fifo_th |
+         val->md1_cfg.int1_shub |
+         val->md1_cfg.int1_6d |
+         val->md1_cfg.int1_double_tap |
+         val->md1_cfg.int1_ff |
+         val->md1_cfg.int1_wu |
+         val->md1_cfg.int1_single_tap |
+         val->md1_cfg.int1_sleep_change) != PROPERTY_DISABLE)
+    {
+      tap_cfg2.interrupts_enable = PROPERTY_ENABLE;
+    }
+
+    else
+    {
+      tap_cfg2.interrupts_enable = PROPERTY_DISABLE;
+    }
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
+                               (uint8_t *)&tap_cfg2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Select the signal that need to route on int1 pad.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Structure of registers: INT1_CTRL, MD1_CFG,
+  *                EMB_FUNC_INT1, FSM_INT1_A, FSM_INT1_B.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_int1_route_get(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_pin_int1_route_t *val)
+{
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MLC_INT1,
+                              (uint8_t *)&val->mlc_int1, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INT1,
+                              (uint8_t *)&val->emb_func_int1, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT1_A,
+                              (uint8_t *)&val->fsm_int1_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT1_B,
+                              (uint8_t *)&val->fsm_int1_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT1_CTRL,
+                              (uint8_t *)&val->int1_ctrl, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MD1_CFG,
+                              (uint8_t *)&val->md1_cfg, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Select the signal that need to route on int2 pad[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Structure of registers INT2_CTRL,  MD2_CFG,
+  *                EMB_FUNC_INT2, FSM_INT2_A, FSM_INT2_B
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_int2_route_set(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_pin_int2_route_t *val)
+{
+  ism330dhcx_tap_cfg2_t tap_cfg2;
+  ism330dhcx_tx_t tx;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    /* EMB_FUNC_INT2, FSM_INT2_A, FSM_INT2_B, MLC_INT2: single burst */
+    ism330dhcx_tx_init(&tx);
+    ret = ism330dhcx_tx_write(&tx, ISM330DHCX_EMB_FUNC_INT2,
+                              (uint8_t *)&val->emb_func_int2, 1);
+    ret += ism330dhcx_tx_write(&tx, ISM330DHCX_FSM_INT2_A,
+                               (uint8_t *)&val->fsm_int2_a, 1);
+    ret += ism330dhcx_tx_write(&tx, ISM330DHCX_FSM_INT2_B,
+                               (uint8_t *)&val->fsm_int2_b, 1);
+    ret += ism330dhcx_tx_write(&tx, ISM330DHCX_MLC_INT2,
+                               (uint8_t *)&val->mlc_int2, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_tx_commit(ctx, &tx);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  if (ret == 0)
+  {
+    if ((val->emb_func_int2.int2_step_detector |
+         val->emb_func_int2.int2_tilt |
+         val->emb_func_int2.int2_sig_mot |
+         val->emb_func_int2.int2_fsm_lc |
+         val->fsm_int2_a.int2_fsm1 |
+         val->fsm_int2_a.int2_fsm2 |
+         val->fsm_int2_a.int2_fsm3 |
+         val->fsm_int2_a.int2_fsm4 |
+         val->fsm_int2_a.int2_fsm5 |
+         val->fsm_int2_a.int2_fsm6 |
+         val->fsm_int2_a.int2_fsm7 |
+         val->fsm_int2_a.int2_fsm8 |
+         val->fsm_int2_b.int2_fsm9 |
+         val->fsm_int2_b.int2_fsm10 |
+         val->fsm_int2_b.int2_fsm11 |
+         val->fsm_int2_b.int2_fsm12 |
+         val->fsm_int2_b.int2_fsm13 |
+         val->fsm_int2_b.int2_fsm14 |
+         val->fsm_int2_b.int2_fsm15 |
+         val->fsm_int2_b.int2_fsm16 |
+         val->mlc_int2.int2_mlc1 |
+         val->mlc_int2.int2_mlc2 |
+         val->mlc_int2.int2_mlc3 |
+         val->mlc_int2.int2_mlc4 |
+         val->mlc_int2.int2_mlc5 |
+         val->mlc_int2.int2_mlc6 |
+         val->mlc_int2.int2_mlc7 |
+         val->mlc_int2.int2_mlc8) != PROPERTY_DISABLE)
+    {
+      val->md2_cfg.int2_emb_func = PROPERTY_ENABLE;
+    }
+    else
+    {
+      val->md2_cfg.int2_emb_func = PROPERTY_DISABLE;
+    }
+
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT2_CTRL,
+                               (uint8_t *)&val->int2_ctrl, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MD2_CFG,
+                               (uint8_t *)&val->md2_cfg, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
+                              (uint8_t *)&tap_cfg2, 1);
+  }
+
+  if (ret == 0)
+  {
+    if ((val->int2_ctrl.int2_drdy_xl |
+         val->int2_ctrl.int2_drdy_g |
+         val->int2_ctrl.int2_drdy_temp |
+         val->int2_ctrl.int2_fifo_th |
+         val->int2_ctrl.int2_fifo_ovr |
+         val->int2_ctrl.int2_fifo_full |
+         val->int2_ctrl.int2_cnt_bdr |
+         val->md2_cfg.int2_6d |
+         val->md2_cfg.int2_double_tap |
+         val->md2_cfg.int2_ff |
+         val->md2_cfg.int2_wu |
+         val->md2_cfg.int2_single_tap |
+         val->md2_cfg.int2_sleep_change) != PROPERTY_DISABLE)
+    {
+      tap_cfg2.interrupts_enable = PROPERTY_ENABLE;
+    }
+
+    else
+    {
+      tap_cfg2.interrupts_enable = PROPERTY_DISABLE;
+    }
+
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
+                               (uint8_t *)&tap_cfg2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Select the signal that need to route on int2 pad.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Structure of registers INT2_CTRL,  MD2_CFG,
+  *                EMB_FUNC_INT2, FSM_INT2_A, FSM_INT2_B.[get]
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_int2_route_get(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_pin_int2_route_t *val)
+{
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MLC_INT2,
+                              (uint8_t *)&val->mlc_int2, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INT2,
+                              (uint8_t *)&val->emb_func_int2, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT2_A,
+                              (uint8_t *)&val->fsm_int2_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_INT2_B,
+                              (uint8_t *)&val->fsm_int2_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT2_CTRL,
+                              (uint8_t *)&val->int2_ctrl, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MD2_CFG,
+                              (uint8_t *)&val->md2_cfg, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Push-pull/open drain selection on interrupt pads.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of pp_od in reg CTRL3_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_mode_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_pp_od_t val)
+{
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+
+  if (ret == 0)
+  {
+    ctrl3_c.pp_od = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
+                               (uint8_t *)&ctrl3_c, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Push-pull/open drain selection on interrupt pads.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of pp_od in reg CTRL3_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_mode_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_pp_od_t *val)
+{
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+
+  switch (ctrl3_c.pp_od)
+  {
+    case ISM330DHCX_PUSH_PULL:
+      *val = ISM330DHCX_PUSH_PULL;
+      break;
+
+    case ISM330DHCX_OPEN_DRAIN:
+      *val = ISM330DHCX_OPEN_DRAIN;
+      break;
+
+    default:
+      *val = ISM330DHCX_PUSH_PULL;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt active-high/low.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of h_lactive in reg CTRL3_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_polarity_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_h_lactive_t val)
+{
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+
+  if (ret == 0)
+  {
+    ctrl3_c.h_lactive = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
+                               (uint8_t *)&ctrl3_c, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt active-high/low.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of h_lactive in reg CTRL3_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_pin_polarity_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_h_lactive_t *val)
+{
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
+                            (uint8_t *)&ctrl3_c, 1);
+
+  switch (ctrl3_c.h_lactive)
+  {
+    case ISM330DHCX_ACTIVE_HIGH:
+      *val = ISM330DHCX_ACTIVE_HIGH;
+      break;
+
+    case ISM330DHCX_ACTIVE_LOW:
+      *val = ISM330DHCX_ACTIVE_LOW;
+      break;
+
+    default:
+      *val = ISM330DHCX_ACTIVE_HIGH;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  All interrupt signals become available on INT1 pin.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of int2_on_int1 in reg CTRL4_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_all_on_int1_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_ctrl4_c_t ctrl4_c;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+
+  if (ret == 0)
+  {
+    ctrl4_c.int2_on_int1 = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
+                               (uint8_t *)&ctrl4_c, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  All interrupt signals become available on INT1 pin.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of int2_on_int1 in reg CTRL4_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_all_on_int1_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_ctrl4_c_t ctrl4_c;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+  *val = ctrl4_c.int2_on_int1;
+
+  return ret;
+}
+
+/**
+  * @brief  All interrupt signals notification mode.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of lir in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_int_notification_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_lir_t val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  ism330dhcx_page_rw_t page_rw;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg0.lir = (uint8_t)val & 0x01U;
+    tap_cfg0.int_clr_on_read = (uint8_t)val & 0x01U;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
+                               (uint8_t *)&tap_cfg0, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    page_rw.emb_func_lir = ((uint8_t)val & 0x02U) >> 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
+                               (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  All interrupt signals notification mode.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of lir in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_int_notification_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_lir_t *val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  ism330dhcx_page_rw_t page_rw;
+  int32_t ret;
+
+  *val = ISM330DHCX_ALL_INT_PULSED;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
+                              (uint8_t *)&page_rw, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  switch ((page_rw.emb_func_lir << 1) + tap_cfg0.lir)
+  {
+    case ISM330DHCX_ALL_INT_PULSED:
+      *val = ISM330DHCX_ALL_INT_PULSED;
+      break;
+
+    case ISM330DHCX_BASE_LATCHED_EMB_PULSED:
+      *val = ISM330DHCX_BASE_LATCHED_EMB_PULSED;
+      break;
+
+    case ISM330DHCX_BASE_PULSED_EMB_LATCHED:
+      *val = ISM330DHCX_BASE_PULSED_EMB_LATCHED;
+      break;
+
+    case ISM330DHCX_ALL_INT_LATCHED:
+      *val = ISM330DHCX_ALL_INT_LATCHED;
+      break;
+
+    default:
+      *val = ISM330DHCX_ALL_INT_PULSED;
+      break;
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_Wake_Up_event
+  * @brief      This section groups all the functions that manage the
+  *             Wake Up event generation.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Weight of 1 LSB of wakeup threshold.[set]
+  *         0: 1 LSB =FS_XL  /  64
+  *         1: 1 LSB = FS_XL / 256
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wake_ths_w in reg WAKE_UP_DUR
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_wkup_ths_weight_set(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_wake_ths_w_t val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+
+  if (ret == 0)
+  {
+    wake_up_dur.wake_ths_w = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                               (uint8_t *)&wake_up_dur, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Weight of 1 LSB of wakeup threshold.[get]
+  *         0: 1 LSB =FS_XL  /  64
+  *         1: 1 LSB = FS_XL / 256
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of wake_ths_w in reg WAKE_UP_DUR
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_wkup_ths_weight_get(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_wake_ths_w_t *val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+
+  switch (wake_up_dur.wake_ths_w)
+  {
+    case ISM330DHCX_LSb_FS_DIV_64:
+      *val = ISM330DHCX_LSb_FS_DIV_64;
+      break;
+
+    case ISM330DHCX_LSb_FS_DIV_256:
+      *val = ISM330DHCX_LSb_FS_DIV_256;
+      break;
+
+    default:
+      *val = ISM330DHCX_LSb_FS_DIV_64;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Threshold for wakeup: 1 LSB weight depends on WAKE_THS_W in
+  *         WAKE_UP_DUR.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wk_ths in reg WAKE_UP_THS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_wkup_threshold_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_wake_up_ths_t wake_up_ths;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                            (uint8_t *)&wake_up_ths, 1);
+
+  if (ret == 0)
+  {
+    wake_up_ths.wk_ths = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                               (uint8_t *)&wake_up_ths, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Threshold for wakeup: 1 LSB weight depends on WAKE_THS_W in
+  *         WAKE_UP_DUR.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wk_ths in reg WAKE_UP_THS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_wkup_threshold_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_wake_up_ths_t wake_up_ths;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                            (uint8_t *)&wake_up_ths, 1);
+  *val = wake_up_ths.wk_ths;
+
+  return ret;
+}
+
+/**
+  * @brief  Wake up duration event( 1LSb = 1 / ODR ).[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of usr_off_on_wu in reg WAKE_UP_THS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_xl_usr_offset_on_wkup_set(const stmdev_ctx_t *ctx,
+                                             uint8_t val)
+{
+  ism330dhcx_wake_up_ths_t wake_up_ths;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                            (uint8_t *)&wake_up_ths, 1);
+
+  if (ret == 0)
+  {
+    wake_up_ths.usr_off_on_wu = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                               (uint8_t *)&wake_up_ths, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Wake up duration event( 1LSb = 1 / ODR ).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of usr_off_on_wu in reg WAKE_UP_THS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_xl_usr_offset_on_wkup_get(const stmdev_ctx_t *ctx,
+                                             uint8_t *val)
+{
+  ism330dhcx_wake_up_ths_t wake_up_ths;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                            (uint8_t *)&wake_up_ths, 1);
+  *val = wake_up_ths.usr_off_on_wu;
+
+  return ret;
+}
+
+/**
+  * @brief  Wake up duration event(1LSb = 1 / ODR).[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wake_dur in reg WAKE_UP_DUR
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_wkup_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+
+  if (ret == 0)
+  {
+    wake_up_dur.wake_dur = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                               (uint8_t *)&wake_up_dur, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Wake up duration event(1LSb = 1 / ODR).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wake_dur in reg WAKE_UP_DUR
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_wkup_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+  *val = wake_up_dur.wake_dur;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_ Activity/Inactivity_detection
+  * @brief      This section groups all the functions concerning
+  *             activity/inactivity detection.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enables gyroscope Sleep mode.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sleep_g in reg CTRL4_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_gy_sleep_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_ctrl4_c_t ctrl4_c;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+
+  if (ret == 0)
+  {
+    ctrl4_c.sleep_g = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
+                               (uint8_t *)&ctrl4_c, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enables gyroscope Sleep mode.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sleep_g in reg CTRL4_C
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_gy_sleep_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_ctrl4_c_t ctrl4_c;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
+                            (uint8_t *)&ctrl4_c, 1);
+  *val = ctrl4_c.sleep_g;
+
+  return ret;
+}
+
+/**
+  * @brief  Drives the sleep status instead of sleep change on INT pins
+  *         (only if INT1_SLEEP_CHANGE or INT2_SLEEP_CHANGE bits
+  *         are enabled).[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sleep_status_on_int in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_act_pin_notification_set(const stmdev_ctx_t *ctx,
+                                            ism330dhcx_sleep_status_on_int_t val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg0. sleep_status_on_int = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
+                               (uint8_t *)&tap_cfg0, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Drives the sleep status instead of sleep change on INT pins
+  *         (only if INT1_SLEEP_CHANGE or INT2_SLEEP_CHANGE bits
+  *         are enabled).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of sleep_status_on_int in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_act_pin_notification_get(const stmdev_ctx_t *ctx,
+                                            ism330dhcx_sleep_status_on_int_t *val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  switch (tap_cfg0. sleep_status_on_int)
+  {
+    case ISM330DHCX_DRIVE_SLEEP_CHG_EVENT:
+      *val = ISM330DHCX_DRIVE_SLEEP_CHG_EVENT;
+      break;
+
+    case ISM330DHCX_DRIVE_SLEEP_STATUS:
+      *val = ISM330DHCX_DRIVE_SLEEP_STATUS;
+      break;
+
+    default:
+      *val = ISM330DHCX_DRIVE_SLEEP_CHG_EVENT;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enable inactivity function.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of inact_en in reg TAP_CFG2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_act_mode_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_inact_en_t val)
+{
+  ism330dhcx_tap_cfg2_t tap_cfg2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
+                            (uint8_t *)&tap_cfg2, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg2.inact_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
+                               (uint8_t *)&tap_cfg2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable inactivity function.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of inact_en in reg TAP_CFG2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_act_mode_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_inact_en_t *val)
+{
+  ism330dhcx_tap_cfg2_t tap_cfg2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
+                            (uint8_t *)&tap_cfg2, 1);
+
+  switch (tap_cfg2.inact_en)
+  {
+    case ISM330DHCX_XL_AND_GY_NOT_AFFECTED:
+      *val = ISM330DHCX_XL_AND_GY_NOT_AFFECTED;
+      break;
+
+    case ISM330DHCX_XL_12Hz5_GY_NOT_AFFECTED:
+      *val = ISM330DHCX_XL_12Hz5_GY_NOT_AFFECTED;
+      break;
+
+    case ISM330DHCX_XL_12Hz5_GY_SLEEP:
+      *val = ISM330DHCX_XL_12Hz5_GY_SLEEP;
+      break;
+
+    case ISM330DHCX_XL_12Hz5_GY_PD:
+      *val = ISM330DHCX_XL_12Hz5_GY_PD;
+      break;
+
+    default:
+      *val = ISM330DHCX_XL_AND_GY_NOT_AFFECTED;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Duration to go in sleep mode (1 LSb = 512 / ODR).[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sleep_dur in reg WAKE_UP_DUR
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_act_sleep_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+
+  if (ret == 0)
+  {
+    wake_up_dur.sleep_dur = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                               (uint8_t *)&wake_up_dur, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Duration to go in sleep mode.(1 LSb = 512 / ODR).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sleep_dur in reg WAKE_UP_DUR
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_act_sleep_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+  *val = wake_up_dur.sleep_dur;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_tap_generator
+  * @brief      This section groups all the functions that manage the
+  *             tap and double tap event generation.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enable Z direction in tap recognition.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_z_en in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_detection_on_z_set(const stmdev_ctx_t *ctx,
+                                          uint8_t val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg0.tap_z_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
+                               (uint8_t *)&tap_cfg0, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable Z direction in tap recognition.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_z_en in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_detection_on_z_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+  *val = tap_cfg0.tap_z_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Enable Y direction in tap recognition.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_y_en in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_detection_on_y_set(const stmdev_ctx_t *ctx,
+                                          uint8_t val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg0.tap_y_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
+                               (uint8_t *)&tap_cfg0, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable Y direction in tap recognition.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_y_en in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_detection_on_y_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+  *val = tap_cfg0.tap_y_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Enable X direction in tap recognition.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_x_en in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_detection_on_x_set(const stmdev_ctx_t *ctx,
+                                          uint8_t val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg0.tap_x_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
+                               (uint8_t *)&tap_cfg0, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable X direction in tap recognition.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_x_en in reg TAP_CFG0
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_detection_on_x_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *val)
+{
+  ism330dhcx_tap_cfg0_t tap_cfg0;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
+                            (uint8_t *)&tap_cfg0, 1);
+  *val = tap_cfg0.tap_x_en;
+
+  return ret;
+}
+
+/**
+  * @brief  X-axis tap recognition threshold.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_ths_x in reg TAP_CFG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_threshold_x_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_tap_cfg1_t tap_cfg1;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
+                            (uint8_t *)&tap_cfg1, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg1.tap_ths_x = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG1,
+                               (uint8_t *)&tap_cfg1, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  X-axis tap recognition threshold.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_ths_x in reg TAP_CFG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_threshold_x_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
+{
+  ism330dhcx_tap_cfg1_t tap_cfg1;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
+                            (uint8_t *)&tap_cfg1, 1);
+  *val = tap_cfg1.tap_ths_x;
+
+  return ret;
+}
+
+/**
+  * @brief  Selection of axis priority for TAP detection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_priority in reg TAP_CFG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_axis_priority_set(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_tap_priority_t val)
+{
+  ism330dhcx_tap_cfg1_t tap_cfg1;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
+                            (uint8_t *)&tap_cfg1, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg1.tap_priority = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG1,
+                               (uint8_t *)&tap_cfg1, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Selection of axis priority for TAP detection[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of tap_priority in reg TAP_CFG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_axis_priority_get(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_tap_priority_t *val)
+{
+  ism330dhcx_tap_cfg1_t tap_cfg1;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
+                            (uint8_t *)&tap_cfg1, 1);
+
+  switch (tap_cfg1.tap_priority)
+  {
+    case ISM330DHCX_XYZ:
+      *val = ISM330DHCX_XYZ;
+      break;
+
+    case ISM330DHCX_YXZ:
+      *val = ISM330DHCX_YXZ;
+      break;
+
+    case ISM330DHCX_XZY:
+      *val = ISM330DHCX_XZY;
+      break;
+
+    case ISM330DHCX_ZYX:
+      *val = ISM330DHCX_ZYX;
+      break;
+
+    case ISM330DHCX_YZX:
+      *val = ISM330DHCX_YZX;
+      break;
+
+    case ISM330DHCX_ZXY:
+      *val = ISM330DHCX_ZXY;
+      break;
+
+    default:
+      *val = ISM330DHCX_XYZ;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Y-axis tap recognition threshold.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_ths_y in reg TAP_CFG2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_threshold_y_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_tap_cfg2_t tap_cfg2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
+                            (uint8_t *)&tap_cfg2, 1);
+
+  if (ret == 0)
+  {
+    tap_cfg2.tap_ths_y = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
+                               (uint8_t *)&tap_cfg2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Y-axis tap recognition threshold.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_ths_y in reg TAP_CFG2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_threshold_y_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
+{
+  ism330dhcx_tap_cfg2_t tap_cfg2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
+                            (uint8_t *)&tap_cfg2, 1);
+  *val = tap_cfg2.tap_ths_y;
+
+  return ret;
+}
+
+/**
+  * @brief  Z-axis recognition threshold.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_ths_z in reg TAP_THS_6D
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_threshold_z_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_tap_ths_6d_t tap_ths_6d;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                            (uint8_t *)&tap_ths_6d, 1);
+
+  if (ret == 0)
+  {
+    tap_ths_6d.tap_ths_z = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                               (uint8_t *)&tap_ths_6d, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Z-axis recognition threshold.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of tap_ths_z in reg TAP_THS_6D
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_threshold_z_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
+{
+  ism330dhcx_tap_ths_6d_t tap_ths_6d;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                            (uint8_t *)&tap_ths_6d, 1);
+  *val = tap_ths_6d.tap_ths_z;
+
+  return ret;
+}
+
+/**
+  * @brief  Maximum duration is the maximum time of an overthreshold signal
+  *         detection to be recognized as a tap event. The default value of
+  *         these bits is 00b which corresponds to 4*ODR_XL time.
+  *         If the SHOCK[1:0] bits are set to a different value, 1LSB
+  *         corresponds to 8*ODR_XL time.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of shock in reg INT_DUR2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_shock_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_int_dur2_t int_dur2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
+                            (uint8_t *)&int_dur2, 1);
+
+  if (ret == 0)
+  {
+    int_dur2.shock = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_DUR2,
+                               (uint8_t *)&int_dur2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Maximum duration is the maximum time of an overthreshold signal
+  *         detection to be recognized as a tap event. The default value of
+  *         these bits is 00b which corresponds to 4*ODR_XL time.
+  *         If the SHOCK[1:0] bits are set to a different value, 1LSB
+  *         corresponds to 8*ODR_XL time.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of shock in reg INT_DUR2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_shock_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_int_dur2_t int_dur2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
+                            (uint8_t *)&int_dur2, 1);
+  *val = int_dur2.shock;
+
+  return ret;
+}
+
+/**
+  * @brief  Quiet time is the time after the first detected tap in which
+  *         there must not be any overthreshold event.
+  *         The default value of these bits is 00b which corresponds to
+  *         2*ODR_XL time. If the QUIET[1:0] bits are set to a different
+  *         value, 1LSB corresponds to 4*ODR_XL time.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of quiet in reg INT_DUR2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_quiet_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_int_dur2_t int_dur2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
+                            (uint8_t *)&int_dur2, 1);
+
+  if (ret == 0)
+  {
+    int_dur2.quiet = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_DUR2,
+                               (uint8_t *)&int_dur2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Quiet time is the time after the first detected tap in which
+  *         there must not be any overthreshold event.
+  *         The default value of these bits is 00b which corresponds to
+  *         2*ODR_XL time. If the QUIET[1:0] bits are set to a different
+  *         value, 1LSB corresponds to 4*ODR_XL time.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of quiet in reg INT_DUR2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_quiet_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_int_dur2_t int_dur2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
+                            (uint8_t *)&int_dur2, 1);
+  *val = int_dur2.quiet;
+
+  return ret;
+}
+
+/**
+  * @brief  When double tap recognition is enabled, this register expresses
+  *         the maximum time between two consecutive detected taps to
+  *         determine a double tap event.
+  *         The default value of these bits is 0000b which corresponds to
+  *         16*ODR_XL time.
+  *         If the DUR[3:0] bits are set to a different value, 1LSB
+  *         corresponds to 32*ODR_XL time.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of dur in reg INT_DUR2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_int_dur2_t int_dur2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
+                            (uint8_t *)&int_dur2, 1);
+
+  if (ret == 0)
+  {
+    int_dur2.dur = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_DUR2,
+                               (uint8_t *)&int_dur2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  When double tap recognition is enabled, this register expresses the
+  *         maximum time between two consecutive detected taps to determine
+  *         a double tap event. The default value of these bits is 0000b which
+  *         corresponds to 16*ODR_XL time. If the DUR[3:0] bits are set to
+  *         a different value, 1LSB corresponds to 32*ODR_XL time.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of dur in reg INT_DUR2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_int_dur2_t int_dur2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
+                            (uint8_t *)&int_dur2, 1);
+  *val = int_dur2.dur;
+
+  return ret;
+}
+
+/**
+  * @brief  Single/double-tap event enable.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of single_double_tap in reg WAKE_UP_THS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_mode_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_single_double_tap_t val)
+{
+  ism330dhcx_wake_up_ths_t wake_up_ths;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                            (uint8_t *)&wake_up_ths, 1);
+
+  if (ret == 0)
+  {
+    wake_up_ths.single_double_tap = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                               (uint8_t *)&wake_up_ths, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Single/double-tap event enable.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of single_double_tap in reg WAKE_UP_THS
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_tap_mode_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_single_double_tap_t *val)
+{
+  ism330dhcx_wake_up_ths_t wake_up_ths;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
+                            (uint8_t *)&wake_up_ths, 1);
+
+  switch (wake_up_ths.single_double_tap)
+  {
+    case ISM330DHCX_ONLY_SINGLE:
+      *val = ISM330DHCX_ONLY_SINGLE;
+      break;
+
+    case ISM330DHCX_BOTH_SINGLE_DOUBLE:
+      *val = ISM330DHCX_BOTH_SINGLE_DOUBLE;
+      break;
+
+    default:
+      *val = ISM330DHCX_ONLY_SINGLE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_ Six_position_detection(6D/4D)
+  * @brief      This section groups all the functions concerning six
+  *             position detection (6D).
+  * @{
+  *
+  */
+
+/**
+  * @brief  Threshold for 4D/6D function.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of sixd_ths in reg TAP_THS_6D
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_6d_threshold_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sixd_ths_t val)
+{
+  ism330dhcx_tap_ths_6d_t tap_ths_6d;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                            (uint8_t *)&tap_ths_6d, 1);
+
+  if (ret == 0)
+  {
+    tap_ths_6d.sixd_ths = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                               (uint8_t *)&tap_ths_6d, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Threshold for 4D/6D function.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of sixd_ths in reg TAP_THS_6D
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_6d_threshold_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sixd_ths_t *val)
+{
+  ism330dhcx_tap_ths_6d_t tap_ths_6d;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                            (uint8_t *)&tap_ths_6d, 1);
+
+  switch (tap_ths_6d.sixd_ths)
+  {
+    case ISM330DHCX_DEG_80:
+      *val = ISM330DHCX_DEG_80;
+      break;
+
+    case ISM330DHCX_DEG_70:
+      *val = ISM330DHCX_DEG_70;
+      break;
+
+    case ISM330DHCX_DEG_60:
+      *val = ISM330DHCX_DEG_60;
+      break;
+
+    case ISM330DHCX_DEG_50:
+      *val = ISM330DHCX_DEG_50;
+      break;
+
+    default:
+      *val = ISM330DHCX_DEG_80;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  4D orientation detection enable.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of d4d_en in reg TAP_THS_6D
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_4d_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_tap_ths_6d_t tap_ths_6d;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                            (uint8_t *)&tap_ths_6d, 1);
+
+  if (ret == 0)
+  {
+    tap_ths_6d.d4d_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                               (uint8_t *)&tap_ths_6d, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  4D orientation detection enable.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of d4d_en in reg TAP_THS_6D
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_4d_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_tap_ths_6d_t tap_ths_6d;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
+                            (uint8_t *)&tap_ths_6d, 1);
+  *val = tap_ths_6d.d4d_en;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_free_fall
+  * @brief      This section group all the functions concerning the free
+  *             fall detection.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Free fall threshold setting.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of ff_ths in reg FREE_FALL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_ff_threshold_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_ff_ths_t val)
+{
+  ism330dhcx_free_fall_t free_fall;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
+                            (uint8_t *)&free_fall, 1);
+
+  if (ret == 0)
+  {
+    free_fall.ff_ths = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FREE_FALL,
+                               (uint8_t *)&free_fall, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Free fall threshold setting.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of ff_ths in reg FREE_FALL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_ff_threshold_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_ff_ths_t *val)
+{
+  ism330dhcx_free_fall_t free_fall;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
+                            (uint8_t *)&free_fall, 1);
+
+  switch (free_fall.ff_ths)
+  {
+    case ISM330DHCX_FF_TSH_156mg:
+      *val = ISM330DHCX_FF_TSH_156mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_219mg:
+      *val = ISM330DHCX_FF_TSH_219mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_250mg:
+      *val = ISM330DHCX_FF_TSH_250mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_312mg:
+      *val = ISM330DHCX_FF_TSH_312mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_344mg:
+      *val = ISM330DHCX_FF_TSH_344mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_406mg:
+      *val = ISM330DHCX_FF_TSH_406mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_469mg:
+      *val = ISM330DHCX_FF_TSH_469mg;
+      break;
+
+    case ISM330DHCX_FF_TSH_500mg:
+      *val = ISM330DHCX_FF_TSH_500mg;
+      break;
+
+    default:
+      *val = ISM330DHCX_FF_TSH_156mg;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Free-fall duration event(1LSb = 1 / ODR).[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of ff_dur in reg FREE_FALL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_ff_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  ism330dhcx_free_fall_t free_fall;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+
+  if (ret == 0)
+  {
+    wake_up_dur.ff_dur = (val & 0x20U) >> 5;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                               (uint8_t *)&wake_up_dur, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
+                              (uint8_t *)&free_fall, 1);
+  }
+
+  if (ret == 0)
+  {
+    free_fall.ff_dur = val & 0x1FU;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FREE_FALL,
+                               (uint8_t *)&free_fall, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Free-fall duration event(1LSb = 1 / ODR).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of ff_dur in reg FREE_FALL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_ff_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_wake_up_dur_t wake_up_dur;
+  ism330dhcx_free_fall_t free_fall;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
+                            (uint8_t *)&wake_up_dur, 1);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
+                              (uint8_t *)&free_fall, 1);
+  }
+
+  *val = (wake_up_dur.ff_dur << 5) + free_fall.ff_dur;
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_fifo
+  * @brief      This section group all the functions concerning
+  *             the fifo usage
+  * @{
+  *
+  */
+
+/**
+  * @brief  FIFO watermark level selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wtm in reg FIFO_CTRL1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_watermark_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  uint8_t reg[2];
+  ism330dhcx_fifo_ctrl1_t *fifo_ctrl1 = (ism330dhcx_fifo_ctrl1_t *)&reg[0];
+  ism330dhcx_fifo_ctrl2_t *fifo_ctrl2 = (ism330dhcx_fifo_ctrl2_t *)&reg[1];
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  /* read both FIFO_CTRL1 + FIFO_CTRL2 regs */
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL1, (uint8_t *)reg, 2);
+
+  if (ret == 0)
+  {
+    fifo_ctrl1->wtm = (uint8_t)(val  & 0xFFU);
+    fifo_ctrl2->wtm = (uint8_t)(val / 256U) & 0x01U;
+
+    /* write both FIFO_CTRL1 + FIFO_CTRL2 regs in a single burst */
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL1, (uint8_t *)reg, 2);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark level selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of wtm in reg FIFO_CTRL1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_watermark_get(const stmdev_ctx_t *ctx,
+                                      uint16_t *val)
+{
+  ism330dhcx_fifo_ctrl1_t fifo_ctrl1;
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
+  ret += ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+
+  *val = fifo_ctrl2.wtm;
+  *val = (*val * 256U) +  fifo_ctrl1.wtm;;
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO compression feature initialization request.[set].
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of FIFO_COMPR_INIT in reg EMB_FUNC_INIT_B
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_compression_algo_init_set(const stmdev_ctx_t *ctx,
+                                             uint8_t val)
+{
+  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                              (uint8_t *)&emb_func_init_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_init_b.fifo_compr_init = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                               (uint8_t *)&emb_func_init_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO compression feature initialization request.[get].
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    change the values of FIFO_COMPR_INIT in
+  *                reg EMB_FUNC_INIT_B
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_compression_algo_init_get(const stmdev_ctx_t *ctx,
+                                             uint8_t *val)
+{
+  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                              (uint8_t *)&emb_func_init_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_init_b.fifo_compr_init;
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable and configure compression algo.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of uncoptr_rate in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_compression_algo_set(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_uncoptr_rate_t val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  ism330dhcx_emb_func_en_b_t emb_func_en_b;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                              (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_en_b.fifo_compr_en = ((uint8_t)val & 0x04U) >> 2;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                               (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                              (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  if (ret == 0)
+  {
+    fifo_ctrl2.fifo_compr_rt_en = ((uint8_t)val & 0x04U) >> 2;
+    fifo_ctrl2.uncoptr_rate = (uint8_t)val & 0x03U;
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                               (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable and configure compression algo.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of uncoptr_rate in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_compression_algo_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_uncoptr_rate_t *val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+
+  switch ((fifo_ctrl2.fifo_compr_rt_en << 2) +
+          fifo_ctrl2.uncoptr_rate)
+  {
+    case ISM330DHCX_CMP_DISABLE:
+      *val = ISM330DHCX_CMP_DISABLE;
+      break;
+
+    case ISM330DHCX_CMP_ALWAYS:
+      *val = ISM330DHCX_CMP_ALWAYS;
+      break;
+
+    case ISM330DHCX_CMP_8_TO_1:
+      *val = ISM330DHCX_CMP_8_TO_1;
+      break;
+
+    case ISM330DHCX_CMP_16_TO_1:
+      *val = ISM330DHCX_CMP_16_TO_1;
+      break;
+
+    case ISM330DHCX_CMP_32_TO_1:
+      *val = ISM330DHCX_CMP_32_TO_1;
+      break;
+
+    default:
+      *val = ISM330DHCX_CMP_DISABLE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of odrchg_en in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_virtual_sens_odr_chg_set(const stmdev_ctx_t *ctx,
+                                                 uint8_t val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl2.odrchg_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                               (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of odrchg_en in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_virtual_sens_odr_chg_get(const stmdev_ctx_t *ctx,
+                                                 uint8_t *val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+  *val = fifo_ctrl2.odrchg_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Enables/Disables compression algorithm runtime[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fifo_compr_rt_en in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_compression_algo_real_time_set(const stmdev_ctx_t *ctx,
+                                                  uint8_t val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl2.fifo_compr_rt_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                               (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Enables/Disables compression algorithm runtime.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fifo_compr_rt_en in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_compression_algo_real_time_get(const stmdev_ctx_t *ctx,
+                                                  uint8_t *val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+  *val = fifo_ctrl2.fifo_compr_rt_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Sensing chain FIFO stop values memorization at threshold
+  *         level.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of stop_on_wtm in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_stop_on_wtm_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl2.stop_on_wtm = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                               (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Sensing chain FIFO stop values memorization at threshold
+  *         level.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of stop_on_wtm in reg FIFO_CTRL2
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_stop_on_wtm_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
+{
+  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
+                            (uint8_t *)&fifo_ctrl2, 1);
+  *val = fifo_ctrl2.stop_on_wtm;
+
+  return ret;
+}
+
+/**
+  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
+  *         for accelerometer data.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of bdr_xl in reg FIFO_CTRL3
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_xl_batch_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_bdr_xl_t val)
+{
+  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
+                            (uint8_t *)&fifo_ctrl3, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl3.bdr_xl = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL3,
+                               (uint8_t *)&fifo_ctrl3, 1);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
+  *         for accelerometer data.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of bdr_xl in reg FIFO_CTRL3
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_xl_batch_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_bdr_xl_t *val)
+{
+  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
+                            (uint8_t *)&fifo_ctrl3, 1);
+
+  switch (fifo_ctrl3.bdr_xl)
+  {
+    case ISM330DHCX_XL_NOT_BATCHED:
+      *val = ISM330DHCX_XL_NOT_BATCHED;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_12Hz5:
+      *val = ISM330DHCX_XL_BATCHED_AT_12Hz5;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_26Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_26Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_52Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_52Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_104Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_104Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_208Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_208Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_417Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_417Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_833Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_833Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_1667Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_1667Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_3333Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_3333Hz;
+      break;
+
+    case ISM330DHCX_XL_BATCHED_AT_6667Hz:
+      *val = ISM330DHCX_XL_BATCHED_AT_6667Hz;
       break;
 
-    case ISM330DHCX_OPEN_DRAIN:
-      *val = ISM330DHCX_OPEN_DRAIN;
+    case ISM330DHCX_XL_BATCHED_AT_6Hz5:
+      *val = ISM330DHCX_XL_BATCHED_AT_6Hz5;
       break;
 
     default:
-      *val = ISM330DHCX_PUSH_PULL;
+      *val = ISM330DHCX_XL_NOT_BATCHED;
       break;
   }
 
@@ -5068,299 +8753,262 @@ int32_t ism330dhcx_pin_mode_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Interrupt active-high/low.[set]
+  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
+  *         for gyroscope data.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of h_lactive in reg CTRL3_C
+  * @param  val    Change the values of bdr_gy in reg FIFO_CTRL3
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_polarity_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_h_lactive_t val)
+int32_t ism330dhcx_fifo_gy_batch_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_bdr_gy_t val)
 {
-  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
+                            (uint8_t *)&fifo_ctrl3, 1);
 
   if (ret == 0)
   {
-    ctrl3_c.h_lactive = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL3_C,
-                               (uint8_t *)&ctrl3_c, 1);
+    fifo_ctrl3.bdr_gy = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL3,
+                               (uint8_t *)&fifo_ctrl3, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Interrupt active-high/low.[get]
+  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
+  *         for gyroscope data.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of h_lactive in reg CTRL3_C
+  * @param  val    Get the values of bdr_gy in reg FIFO_CTRL3
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pin_polarity_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_h_lactive_t *val)
+int32_t ism330dhcx_fifo_gy_batch_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_bdr_gy_t *val)
 {
-  ism330dhcx_ctrl3_c_t ctrl3_c;
+  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL3_C,
-                            (uint8_t *)&ctrl3_c, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
+                            (uint8_t *)&fifo_ctrl3, 1);
 
-  switch (ctrl3_c.h_lactive)
+  switch (fifo_ctrl3.bdr_gy)
   {
-    case ISM330DHCX_ACTIVE_HIGH:
-      *val = ISM330DHCX_ACTIVE_HIGH;
+    case ISM330DHCX_GY_NOT_BATCHED:
+      *val = ISM330DHCX_GY_NOT_BATCHED;
       break;
 
-    case ISM330DHCX_ACTIVE_LOW:
-      *val = ISM330DHCX_ACTIVE_LOW;
+    case ISM330DHCX_GY_BATCHED_AT_12Hz5:
+      *val = ISM330DHCX_GY_BATCHED_AT_12Hz5;
       break;
 
-    default:
-      *val = ISM330DHCX_ACTIVE_HIGH;
+    case ISM330DHCX_GY_BATCHED_AT_26Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_26Hz;
       break;
-  }
 
-  return ret;
-}
+    case ISM330DHCX_GY_BATCHED_AT_52Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_52Hz;
+      break;
 
-/**
-  * @brief  All interrupt signals become available on INT1 pin.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_on_int1 in reg CTRL4_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_all_on_int1_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  ism330dhcx_ctrl4_c_t ctrl4_c;
-  int32_t ret;
+    case ISM330DHCX_GY_BATCHED_AT_104Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_104Hz;
+      break;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
+    case ISM330DHCX_GY_BATCHED_AT_208Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_208Hz;
+      break;
 
-  if (ret == 0)
-  {
-    ctrl4_c.int2_on_int1 = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
-                               (uint8_t *)&ctrl4_c, 1);
-  }
+    case ISM330DHCX_GY_BATCHED_AT_417Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_417Hz;
+      break;
 
-  return ret;
-}
+    case ISM330DHCX_GY_BATCHED_AT_833Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_833Hz;
+      break;
 
-/**
-  * @brief  All interrupt signals become available on INT1 pin.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_on_int1 in reg CTRL4_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_all_on_int1_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  ism330dhcx_ctrl4_c_t ctrl4_c;
-  int32_t ret;
+    case ISM330DHCX_GY_BATCHED_AT_1667Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_1667Hz;
+      break;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
-  *val = ctrl4_c.int2_on_int1;
+    case ISM330DHCX_GY_BATCHED_AT_3333Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_3333Hz;
+      break;
+
+    case ISM330DHCX_GY_BATCHED_AT_6667Hz:
+      *val = ISM330DHCX_GY_BATCHED_AT_6667Hz;
+      break;
+
+    case ISM330DHCX_GY_BATCHED_6Hz5:
+      *val = ISM330DHCX_GY_BATCHED_6Hz5;
+      break;
+
+    default:
+      *val = ISM330DHCX_GY_NOT_BATCHED;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  All interrupt signals notification mode.[set]
+  * @brief  FIFO mode selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of lir in reg TAP_CFG0
+  * @param  val    Change the values of fifo_mode in reg FIFO_CTRL4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_int_notification_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_lir_t val)
+int32_t ism330dhcx_fifo_mode_set(const stmdev_ctx_t *ctx,
+                                 ism330dhcx_fifo_mode_t val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
-  ism330dhcx_page_rw_t page_rw;
+  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-
-  if (ret == 0)
-  {
-    tap_cfg0.lir = (uint8_t)val & 0x01U;
-    tap_cfg0.int_clr_on_read = (uint8_t)val & 0x01U;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
-                               (uint8_t *)&tap_cfg0, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                            (uint8_t *)&fifo_ctrl4, 1);
 
   if (ret == 0)
   {
-    page_rw.emb_func_lir = ((uint8_t)val & 0x02U) >> 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_PAGE_RW,
-                               (uint8_t *)&page_rw, 1);
+    fifo_ctrl4.fifo_mode = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                               (uint8_t *)&fifo_ctrl4, 1);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  All interrupt signals notification mode.[get]
+  * @brief  FIFO mode selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of lir in reg TAP_CFG0
+  * @param  val    Get the values of fifo_mode in reg FIFO_CTRL4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_int_notification_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_lir_t *val)
+int32_t ism330dhcx_fifo_mode_get(const stmdev_ctx_t *ctx,
+                                 ism330dhcx_fifo_mode_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
-  ism330dhcx_page_rw_t page_rw;
+  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
   int32_t ret;
 
-  *val = ISM330DHCX_ALL_INT_PULSED;
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_PAGE_RW,
-                              (uint8_t *)&page_rw, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                            (uint8_t *)&fifo_ctrl4, 1);
 
-  switch ((page_rw.emb_func_lir << 1) + tap_cfg0.lir)
+  switch (fifo_ctrl4.fifo_mode)
   {
-    case ISM330DHCX_ALL_INT_PULSED:
-      *val = ISM330DHCX_ALL_INT_PULSED;
+    case ISM330DHCX_BYPASS_MODE:
+      *val = ISM330DHCX_BYPASS_MODE;
       break;
 
-    case ISM330DHCX_BASE_LATCHED_EMB_PULSED:
-      *val = ISM330DHCX_BASE_LATCHED_EMB_PULSED;
+    case ISM330DHCX_FIFO_MODE:
+      *val = ISM330DHCX_FIFO_MODE;
       break;
 
-    case ISM330DHCX_BASE_PULSED_EMB_LATCHED:
-      *val = ISM330DHCX_BASE_PULSED_EMB_LATCHED;
+    case ISM330DHCX_STREAM_TO_FIFO_MODE:
+      *val = ISM330DHCX_STREAM_TO_FIFO_MODE;
       break;
 
-    case ISM330DHCX_ALL_INT_LATCHED:
-      *val = ISM330DHCX_ALL_INT_LATCHED;
+    case ISM330DHCX_BYPASS_TO_STREAM_MODE:
+      *val = ISM330DHCX_BYPASS_TO_STREAM_MODE;
       break;
 
-    default:
-      *val = ISM330DHCX_ALL_INT_PULSED;
+    case ISM330DHCX_STREAM_MODE:
+      *val = ISM330DHCX_STREAM_MODE;
       break;
-  }
-
-  return ret;
-}
 
-/**
-  * @}
-  *
-  */
+    case ISM330DHCX_BYPASS_TO_FIFO_MODE:
+      *val = ISM330DHCX_BYPASS_TO_FIFO_MODE;
+      break;
 
-/**
-  * @defgroup   ISM330DHCX_Wake_Up_event
-  * @brief      This section groups all the functions that manage the
-  *             Wake Up event generation.
-  * @{
-  *
-  */
+    default:
+      *val = ISM330DHCX_BYPASS_MODE;
+      break;
+  }
+
+  return ret;
+}
 
 /**
-  * @brief  Weight of 1 LSB of wakeup threshold.[set]
-  *         0: 1 LSB =FS_XL  /  64
-  *         1: 1 LSB = FS_XL / 256
+  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
+  *         for temperature data.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wake_ths_w in reg WAKE_UP_DUR
+  * @param  val    Change the values of odr_t_batch in reg FIFO_CTRL4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_wkup_ths_weight_set(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_wake_ths_w_t val)
+int32_t ism330dhcx_fifo_temp_batch_set(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_odr_t_batch_t val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
+  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                            (uint8_t *)&fifo_ctrl4, 1);
 
   if (ret == 0)
   {
-    wake_up_dur.wake_ths_w = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                               (uint8_t *)&wake_up_dur, 1);
+    fifo_ctrl4.odr_t_batch = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                               (uint8_t *)&fifo_ctrl4, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Weight of 1 LSB of wakeup threshold.[get]
-  *         0: 1 LSB =FS_XL  /  64
-  *         1: 1 LSB = FS_XL / 256
+  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
+  *         for temperature data.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of wake_ths_w in reg WAKE_UP_DUR
+  * @param  val    Get the values of odr_t_batch in reg FIFO_CTRL4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_wkup_ths_weight_get(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_wake_ths_w_t *val)
+int32_t ism330dhcx_fifo_temp_batch_get(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_odr_t_batch_t *val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
+  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                            (uint8_t *)&fifo_ctrl4, 1);
 
-  switch (wake_up_dur.wake_ths_w)
+  switch (fifo_ctrl4.odr_t_batch)
   {
-    case ISM330DHCX_LSb_FS_DIV_64:
-      *val = ISM330DHCX_LSb_FS_DIV_64;
+    case ISM330DHCX_TEMP_NOT_BATCHED:
+      *val = ISM330DHCX_TEMP_NOT_BATCHED;
       break;
 
-    case ISM330DHCX_LSb_FS_DIV_256:
-      *val = ISM330DHCX_LSb_FS_DIV_256;
+    case ISM330DHCX_TEMP_BATCHED_AT_52Hz:
+      *val = ISM330DHCX_TEMP_BATCHED_AT_52Hz;
+      break;
+
+    case ISM330DHCX_TEMP_BATCHED_AT_12Hz5:
+      *val = ISM330DHCX_TEMP_BATCHED_AT_12Hz5;
+      break;
+
+    case ISM330DHCX_TEMP_BATCHED_AT_1Hz6:
+      *val = ISM330DHCX_TEMP_BATCHED_AT_1Hz6;
       break;
 
     default:
-      *val = ISM330DHCX_LSb_FS_DIV_64;
+      *val = ISM330DHCX_TEMP_NOT_BATCHED;
       break;
   }
 
@@ -5368,1379 +9016,1827 @@ int32_t ism330dhcx_wkup_ths_weight_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Threshold for wakeup: 1 LSB weight depends on WAKE_THS_W in
-  *         WAKE_UP_DUR.[set]
+  * @brief  Selects decimation for timestamp batching in FIFO.
+  *         Writing rate will be the maximum rate between XL and
+  *         GYRO BDR divided by decimation decoder.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wk_ths in reg WAKE_UP_THS
+  * @param  val    Change the values of odr_ts_batch in reg FIFO_CTRL4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_wkup_threshold_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_fifo_timestamp_decimation_set(const stmdev_ctx_t *ctx,
+                                                 ism330dhcx_odr_ts_batch_t val)
 {
-  ism330dhcx_wake_up_ths_t wake_up_ths;
+  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                            (uint8_t *)&wake_up_ths, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                            (uint8_t *)&fifo_ctrl4, 1);
 
   if (ret == 0)
   {
-    wake_up_ths.wk_ths = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                               (uint8_t *)&wake_up_ths, 1);
+    fifo_ctrl4.odr_ts_batch = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                               (uint8_t *)&fifo_ctrl4, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Threshold for wakeup: 1 LSB weight depends on WAKE_THS_W in
-  *         WAKE_UP_DUR.[get]
+  * @brief  Selects decimation for timestamp batching in FIFO.
+  *         Writing rate will be the maximum rate between XL and
+  *         GYRO BDR divided by decimation decoder.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wk_ths in reg WAKE_UP_THS
+  * @param  val    Get the values of odr_ts_batch in reg
+  *                                 FIFO_CTRL4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_wkup_threshold_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_fifo_timestamp_decimation_get(const stmdev_ctx_t *ctx,
+                                                 ism330dhcx_odr_ts_batch_t *val)
 {
-  ism330dhcx_wake_up_ths_t wake_up_ths;
+  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                            (uint8_t *)&wake_up_ths, 1);
-  *val = wake_up_ths.wk_ths;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
+                            (uint8_t *)&fifo_ctrl4, 1);
+
+  switch (fifo_ctrl4.odr_ts_batch)
+  {
+    case ISM330DHCX_NO_DECIMATION:
+      *val = ISM330DHCX_NO_DECIMATION;
+      break;
+
+    case ISM330DHCX_DEC_1:
+      *val = ISM330DHCX_DEC_1;
+      break;
+
+    case ISM330DHCX_DEC_8:
+      *val = ISM330DHCX_DEC_8;
+      break;
+
+    case ISM330DHCX_DEC_32:
+      *val = ISM330DHCX_DEC_32;
+      break;
+
+    default:
+      *val = ISM330DHCX_NO_DECIMATION;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Wake up duration event( 1LSb = 1 / ODR ).[set]
+  * @brief  Selects the trigger for the internal counter of batching events
+  *         between XL and gyro.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of usr_off_on_wu in reg WAKE_UP_THS
+  * @param  val    Change the values of trig_counter_bdr in
+  *                reg COUNTER_BDR_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_usr_offset_on_wkup_set(const stmdev_ctx_t *ctx,
-                                             uint8_t val)
+int32_t ism330dhcx_fifo_cnt_event_batch_set(const stmdev_ctx_t *ctx,
+                                            ism330dhcx_trig_counter_bdr_t val)
 {
-  ism330dhcx_wake_up_ths_t wake_up_ths;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                            (uint8_t *)&wake_up_ths, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
 
   if (ret == 0)
   {
-    wake_up_ths.usr_off_on_wu = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                               (uint8_t *)&wake_up_ths, 1);
+    counter_bdr_reg1.trig_counter_bdr = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                               (uint8_t *)&counter_bdr_reg1, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Wake up duration event( 1LSb = 1 / ODR ).[get]
+  * @brief  Selects the trigger for the internal counter of batching events
+  *          between XL and gyro.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of usr_off_on_wu in reg WAKE_UP_THS
+  * @param  val    Get the values of trig_counter_bdr
+  *                in reg COUNTER_BDR_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_xl_usr_offset_on_wkup_get(const stmdev_ctx_t *ctx,
-                                             uint8_t *val)
+int32_t ism330dhcx_fifo_cnt_event_batch_get(const stmdev_ctx_t *ctx,
+                                            ism330dhcx_trig_counter_bdr_t *val)
 {
-  ism330dhcx_wake_up_ths_t wake_up_ths;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                            (uint8_t *)&wake_up_ths, 1);
-  *val = wake_up_ths.usr_off_on_wu;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
+
+  switch (counter_bdr_reg1.trig_counter_bdr)
+  {
+    case ISM330DHCX_XL_BATCH_EVENT:
+      *val = ISM330DHCX_XL_BATCH_EVENT;
+      break;
+
+    case ISM330DHCX_GYRO_BATCH_EVENT:
+      *val = ISM330DHCX_GYRO_BATCH_EVENT;
+      break;
+
+    default:
+      *val = ISM330DHCX_XL_BATCH_EVENT;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Wake up duration event(1LSb = 1 / ODR).[set]
+  * @brief  Resets the internal counter of batching events for a single sensor.
+  *         This bit is automatically reset to zero if it was set to '1'.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wake_dur in reg WAKE_UP_DUR
+  * @param  val    Change the values of rst_counter_bdr in reg COUNTER_BDR_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_wkup_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_rst_batch_counter_set(const stmdev_ctx_t *ctx,
+                                         uint8_t val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
 
   if (ret == 0)
   {
-    wake_up_dur.wake_dur = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                               (uint8_t *)&wake_up_dur, 1);
+    counter_bdr_reg1.rst_counter_bdr = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                               (uint8_t *)&counter_bdr_reg1, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Wake up duration event(1LSb = 1 / ODR).[get]
+  * @brief  Resets the internal counter of batching events for a single sensor.
+  *         This bit is automatically reset to zero if it was set to '1'.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wake_dur in reg WAKE_UP_DUR
+  * @param  val    Change the values of rst_counter_bdr in reg COUNTER_BDR_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_wkup_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_rst_batch_counter_get(const stmdev_ctx_t *ctx,
+                                         uint8_t *val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
-  *val = wake_up_dur.wake_dur;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
+  *val = counter_bdr_reg1.rst_counter_bdr;
 
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_ Activity/Inactivity_detection
-  * @brief      This section groups all the functions concerning
-  *             activity/inactivity detection.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Enables gyroscope Sleep mode.[set]
+  * @brief  Batch data rate counter.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sleep_g in reg CTRL4_C
+  * @param  val    Change the values of cnt_bdr_th in reg COUNTER_BDR_REG2
+  *                and COUNTER_BDR_REG1.
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_sleep_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_batch_counter_threshold_set(const stmdev_ctx_t *ctx,
+                                               uint16_t val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_counter_bdr_reg2_t counter_bdr_reg1;
+  ism330dhcx_counter_bdr_reg2_t counter_bdr_reg2;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
+
+  if (ret == 0)
+  {
+    counter_bdr_reg1.cnt_bdr_th = (uint8_t)((val / 256U) & 0x07U);
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                               (uint8_t *)&counter_bdr_reg1, 1);
+  }
 
   if (ret == 0)
   {
-    ctrl4_c.sleep_g = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL4_C,
-                               (uint8_t *)&ctrl4_c, 1);
+    counter_bdr_reg2.cnt_bdr_th = (uint8_t)(val -
+                                            (counter_bdr_reg1.cnt_bdr_th * 256U));
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG2,
+                               (uint8_t *)&counter_bdr_reg2, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enables gyroscope Sleep mode.[get]
+  * @brief  Batch data rate counter.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sleep_g in reg CTRL4_C
+  * @param  val    Change the values of cnt_bdr_th in reg COUNTER_BDR_REG2
+  *                and COUNTER_BDR_REG1.
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_gy_sleep_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_batch_counter_threshold_get(const stmdev_ctx_t *ctx,
+                                               uint16_t *val)
 {
-  ism330dhcx_ctrl4_c_t ctrl4_c;
+  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
+  ism330dhcx_counter_bdr_reg2_t counter_bdr_reg2;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL4_C,
-                            (uint8_t *)&ctrl4_c, 1);
-  *val = ctrl4_c.sleep_g;
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
+                            (uint8_t *)&counter_bdr_reg1, 1);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG2,
+                              (uint8_t *)&counter_bdr_reg2, 1);
+  }
+
+  *val = counter_bdr_reg1.cnt_bdr_th;
+  *val = (*val * 256U) +  counter_bdr_reg2.cnt_bdr_th;
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Drives the sleep status instead of sleep change on INT pins
-  *         (only if INT1_SLEEP_CHANGE or INT2_SLEEP_CHANGE bits
-  *         are enabled).[set]
+  * @brief  Number of unread sensor data (TAG + 6 bytes) stored in FIFO.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sleep_status_on_int in reg TAP_CFG0
+  * @param  val    Read the value of diff_fifo in reg FIFO_STATUS1 and FIFO_STATUS2
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_act_pin_notification_set(const stmdev_ctx_t *ctx,
-                                            ism330dhcx_sleep_status_on_int_t val)
+int32_t ism330dhcx_fifo_data_level_get(const stmdev_ctx_t *ctx,
+                                       uint16_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
+  uint8_t reg[2];
+  ism330dhcx_fifo_status1_t *fifo_status1 = (ism330dhcx_fifo_status1_t *)&reg[0];
+  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-
+  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
   if (ret == 0)
   {
-    tap_cfg0. sleep_status_on_int = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
-                               (uint8_t *)&tap_cfg0, 1);
+    *val = fifo_status2->diff_fifo;
+    *val = (*val * 256U) + fifo_status1->diff_fifo;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Drives the sleep status instead of sleep change on INT pins
-  *         (only if INT1_SLEEP_CHANGE or INT2_SLEEP_CHANGE bits
-  *         are enabled).[get]
+  * @brief  Smart FIFO status.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sleep_status_on_int in reg TAP_CFG0
+  * @param  val    Read registers FIFO_STATUS2
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_act_pin_notification_get(const stmdev_ctx_t *ctx,
-                                            ism330dhcx_sleep_status_on_int_t *val)
+int32_t ism330dhcx_fifo_status_get(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_fifo_status2_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
+  uint8_t reg[2];
+  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-
-  switch (tap_cfg0. sleep_status_on_int)
+  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
+  if (ret == 0)
   {
-    case ISM330DHCX_DRIVE_SLEEP_CHG_EVENT:
-      *val = ISM330DHCX_DRIVE_SLEEP_CHG_EVENT;
-      break;
-
-    case ISM330DHCX_DRIVE_SLEEP_STATUS:
-      *val = ISM330DHCX_DRIVE_SLEEP_STATUS;
-      break;
-
-    default:
-      *val = ISM330DHCX_DRIVE_SLEEP_CHG_EVENT;
-      break;
+    *val = *fifo_status2;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enable inactivity function.[set]
+  * @brief  FIFO level and flags, FIFO_STATUS1 and FIFO_STATUS2 read
+  *         together once.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of inact_en in reg TAP_CFG2
+  * @param  val    FIFO level and status flags.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_act_mode_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_inact_en_t val)
+int32_t ism330dhcx_fifo_state_get(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_fifo_state_t *val)
 {
-  ism330dhcx_tap_cfg2_t tap_cfg2;
+  uint8_t reg[2];
+  ism330dhcx_fifo_status1_t *fifo_status1 = (ism330dhcx_fifo_status1_t *)&reg[0];
+  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
-                            (uint8_t *)&tap_cfg2, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
 
   if (ret == 0)
   {
-    tap_cfg2.inact_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
-                               (uint8_t *)&tap_cfg2, 1);
+    val->level = fifo_status2->diff_fifo;
+    val->level = (val->level * 256U) + fifo_status1->diff_fifo;
+    val->wtm = fifo_status2->fifo_wtm_ia;
+    val->ovr = fifo_status2->fifo_ovr_ia;
+    val->full = fifo_status2->fifo_full_ia;
+    val->counter_bdr = fifo_status2->counter_bdr_ia;
+    val->ovr_latched = fifo_status2->over_run_latched;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enable inactivity function.[get]
+  * @brief  Smart FIFO full status.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of inact_en in reg TAP_CFG2
+  * @param  val    Read the values of fifo_full_ia in reg FIFO_STATUS2
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_act_mode_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_inact_en_t *val)
+int32_t ism330dhcx_fifo_full_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_tap_cfg2_t tap_cfg2;
+  uint8_t reg[2];
+  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
-                            (uint8_t *)&tap_cfg2, 1);
-
-  switch (tap_cfg2.inact_en)
+  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
+  if (ret == 0)
   {
-    case ISM330DHCX_XL_AND_GY_NOT_AFFECTED:
-      *val = ISM330DHCX_XL_AND_GY_NOT_AFFECTED;
-      break;
-
-    case ISM330DHCX_XL_12Hz5_GY_NOT_AFFECTED:
-      *val = ISM330DHCX_XL_12Hz5_GY_NOT_AFFECTED;
-      break;
-
-    case ISM330DHCX_XL_12Hz5_GY_SLEEP:
-      *val = ISM330DHCX_XL_12Hz5_GY_SLEEP;
-      break;
-
-    case ISM330DHCX_XL_12Hz5_GY_PD:
-      *val = ISM330DHCX_XL_12Hz5_GY_PD;
-      break;
-
-    default:
-      *val = ISM330DHCX_XL_AND_GY_NOT_AFFECTED;
-      break;
+    *val = fifo_status2->fifo_full_ia;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Duration to go in sleep mode (1 LSb = 512 / ODR).[set]
+  * @brief  FIFO overrun status.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sleep_dur in reg WAKE_UP_DUR
+  * @param  val    Read the values of  fifo_over_run_latched in
+  *                reg FIFO_STATUS2
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_act_sleep_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_fifo_ovr_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
+  uint8_t reg[2];
+  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
-
+  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
   if (ret == 0)
   {
-    wake_up_dur.sleep_dur = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                               (uint8_t *)&wake_up_dur, 1);
+    *val = fifo_status2->fifo_ovr_ia;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Duration to go in sleep mode.(1 LSb = 512 / ODR).[get]
+  * @brief  FIFO watermark status.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sleep_dur in reg WAKE_UP_DUR
+  * @param  val    Read the values of fifo_wtm_ia in reg FIFO_STATUS2
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_act_sleep_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_fifo_wtm_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
+  uint8_t reg[2];
+  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
-  *val = wake_up_dur.sleep_dur;
+  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
+  if (ret == 0)
+  {
+    *val = fifo_status2->fifo_wtm_ia;
+  }
 
   return ret;
 }
 
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_tap_generator
-  * @brief      This section groups all the functions that manage the
-  *             tap and double tap event generation.
-  * @{
-  *
-  */
+/*
+ * tag_sensor -> ism330dhcx_fifo_tag_t, 0 for codes the device never
+ * produces (reported as ISM330DHCX_SENSORHUB_NACK_TAG, as done so far).
+ */
+static const uint8_t ism330dhcx_fifo_tag_map[32] =
+{
+  0U,
+  (uint8_t)ISM330DHCX_GYRO_NC_TAG,
+  (uint8_t)ISM330DHCX_XL_NC_TAG,
+  (uint8_t)ISM330DHCX_TEMPERATURE_TAG,
+  (uint8_t)ISM330DHCX_TIMESTAMP_TAG,
+  (uint8_t)ISM330DHCX_CFG_CHANGE_TAG,
+  (uint8_t)ISM330DHCX_XL_NC_T_2_TAG,
+  (uint8_t)ISM330DHCX_XL_NC_T_1_TAG,
+  (uint8_t)ISM330DHCX_XL_2XC_TAG,
+  (uint8_t)ISM330DHCX_XL_3XC_TAG,
+  (uint8_t)ISM330DHCX_GYRO_NC_T_2_TAG,
+  (uint8_t)ISM330DHCX_GYRO_NC_T_1_TAG,
+  (uint8_t)ISM330DHCX_GYRO_2XC_TAG,
+  (uint8_t)ISM330DHCX_GYRO_3XC_TAG,
+  (uint8_t)ISM330DHCX_SENSORHUB_SLAVE0_TAG,
+  (uint8_t)ISM330DHCX_SENSORHUB_SLAVE1_TAG,
+  (uint8_t)ISM330DHCX_SENSORHUB_SLAVE2_TAG,
+  (uint8_t)ISM330DHCX_SENSORHUB_SLAVE3_TAG,
+  (uint8_t)ISM330DHCX_STEP_CPUNTER_TAG,
+  0U, 0U, 0U, 0U, 0U, 0U,
+  (uint8_t)ISM330DHCX_SENSORHUB_NACK_TAG,
+  0U, 0U, 0U, 0U, 0U, 0U,
+};
 
 /**
-  * @brief  Enable Z direction in tap recognition.[set]
+  * @brief  Convert a FIFO_DATA_OUT_TAG register value into a sensor tag.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_z_en in reg TAP_CFG0
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  tag    FIFO_DATA_OUT_TAG register value
+  * @param  val    Sensor identified by tag_sensor
   *
   */
-int32_t ism330dhcx_tap_detection_on_z_set(const stmdev_ctx_t *ctx,
-                                          uint8_t val)
+static void ism330dhcx_fifo_tag_conv(uint8_t tag, ism330dhcx_fifo_tag_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
+  const ism330dhcx_fifo_data_out_tag_t *fifo_data_out_tag =
+    (const ism330dhcx_fifo_data_out_tag_t *)&tag;
+  uint8_t code = ism330dhcx_fifo_tag_map[fifo_data_out_tag->tag_sensor];
 
-  if (ret == 0)
+  if (code == 0U)
   {
-    tap_cfg0.tap_z_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
-                               (uint8_t *)&tap_cfg0, 1);
+    code = (uint8_t)ISM330DHCX_SENSORHUB_NACK_TAG;
   }
 
-  return ret;
+  *val = (ism330dhcx_fifo_tag_t)code;
 }
 
 /**
-  * @brief  Enable Z direction in tap recognition.[get]
+  * @brief  Identifies the sensor in FIFO_DATA_OUT.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_z_en in reg TAP_CFG0
+  * @param  val    Change the values of tag_sensor in reg FIFO_DATA_OUT_TAG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tap_detection_on_z_get(const stmdev_ctx_t *ctx,
-                                          uint8_t *val)
+int32_t ism330dhcx_fifo_sensor_tag_get(const stmdev_ctx_t *ctx,
+                                       ism330dhcx_fifo_tag_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
+  uint8_t tag;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-  *val = tap_cfg0.tap_z_en;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_DATA_OUT_TAG, &tag, 1);
+  ism330dhcx_fifo_tag_conv(tag, val);
 
   return ret;
 }
 
 /**
-  * @brief  Enable Y direction in tap recognition.[set]
+  * @brief  Read several FIFO words (tag and data) in a single burst.[get]
+  *         After FIFO_DATA_OUT_Z_H the address pointer rolls back to
+  *         FIFO_DATA_OUT_TAG, so one auto-increment read of num * 7 bytes
+  *         pops num words from the FIFO.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_y_en in reg TAP_CFG0
+  * @param  buff   Buffer of num * ISM330DHCX_FIFO_WORD_LEN bytes; each
+  *                word is the FIFO_DATA_OUT_TAG byte followed by
+  *                FIFO_DATA_OUT_X_L .. FIFO_DATA_OUT_Z_H
+  * @param  num    Number of words to read, see fifo_data_level_get
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tap_detection_on_y_set(const stmdev_ctx_t *ctx,
-                                          uint8_t val)
+int32_t ism330dhcx_fifo_out_multi_raw_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *buff, uint16_t num)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
+  if (num > ISM330DHCX_FIFO_BURST_MAX)
+  {
+    return -1;
+  }
 
-  if (ret == 0)
+  if (num == 0U)
   {
-    tap_cfg0.tap_y_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
-                               (uint8_t *)&tap_cfg0, 1);
+    return 0;
   }
 
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_DATA_OUT_TAG, buff,
+                            (uint16_t)(num * ISM330DHCX_FIFO_WORD_LEN));
+
   return ret;
 }
 
 /**
-  * @brief  Enable Y direction in tap recognition.[get]
+  * @brief  Sensor tag of a word read with fifo_out_multi_raw_get.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_y_en in reg TAP_CFG0
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  word   FIFO word, ISM330DHCX_FIFO_WORD_LEN bytes.(ptr)
+  * @param  val    Sensor that produced the word
   *
   */
-int32_t ism330dhcx_tap_detection_on_y_get(const stmdev_ctx_t *ctx,
-                                          uint8_t *val)
+void ism330dhcx_fifo_word_tag_get(const uint8_t *word,
+                                  ism330dhcx_fifo_tag_t *val)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
-  int32_t ret;
+  ism330dhcx_fifo_tag_conv(word[0], val);
+}
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-  *val = tap_cfg0.tap_y_en;
+/**
+  * @brief  Decode a FIFO word read with fifo_out_multi_raw_get.
+  *         The tag byte has even parity: tag_parity is the XOR of
+  *         tag_sensor and tag_cnt bits.
+  *
+  * @param  word   FIFO word, ISM330DHCX_FIFO_WORD_LEN bytes.(ptr)
+  * @param  val    Decoded word; data points inside word.(ptr)
+  * @retval        0 -> valid word, -1 -> parity error or unknown tag
+  *
+  */
+int32_t ism330dhcx_fifo_word_decode(const uint8_t *word,
+                                    ism330dhcx_fifo_word_t *val)
+{
+  const ism330dhcx_fifo_data_out_tag_t *fifo_data_out_tag =
+    (const ism330dhcx_fifo_data_out_tag_t *)word;
+  uint8_t parity = word[0];
+  uint8_t code;
+
+  parity ^= parity >> 4;
+  parity ^= parity >> 2;
+  parity ^= parity >> 1;
+
+  code = ism330dhcx_fifo_tag_map[fifo_data_out_tag->tag_sensor];
+  val->tag = (ism330dhcx_fifo_tag_t)code;
+  val->cnt = fifo_data_out_tag->tag_cnt;
+  val->data = &word[1];
+
+  if (((parity & 0x01U) != 0U) || (code == 0U))
+  {
+    return -1;
+  }
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Enable X direction in tap recognition.[set]
+  * @brief  Initialize a FIFO decoder with no handler installed.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_x_en in reg TAP_CFG0
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  dec    FIFO decoder.(ptr)
+  * @param  arg    Argument passed to every handler.(ptr)
   *
   */
-int32_t ism330dhcx_tap_detection_on_x_set(const stmdev_ctx_t *ctx,
-                                          uint8_t val)
+void ism330dhcx_fifo_decoder_init(ism330dhcx_fifo_decoder_t *dec, void *arg)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
+  uint8_t i;
 
-  if (ret == 0)
+  for (i = 0; i < 32U; i++)
   {
-    tap_cfg0.tap_x_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG0,
-                               (uint8_t *)&tap_cfg0, 1);
+    dec->handler[i] = NULL;
   }
 
-  return ret;
+  dec->arg = arg;
+  dec->words = 0;
+  dec->parity_err = 0;
+  dec->unknown = 0;
 }
 
 /**
-  * @brief  Enable X direction in tap recognition.[get]
+  * @brief  Install the handler of a sensor tag, NULL to drop its words.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_x_en in reg TAP_CFG0
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  dec    FIFO decoder.(ptr)
+  * @param  tag    Sensor tag
+  * @param  fn     Handler.(ptr)
   *
   */
-int32_t ism330dhcx_tap_detection_on_x_get(const stmdev_ctx_t *ctx,
-                                          uint8_t *val)
+void ism330dhcx_fifo_decoder_handler_set(ism330dhcx_fifo_decoder_t *dec,
+                                         ism330dhcx_fifo_tag_t tag,
+                                         ism330dhcx_fifo_handler_ptr fn)
 {
-  ism330dhcx_tap_cfg0_t tap_cfg0;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0,
-                            (uint8_t *)&tap_cfg0, 1);
-  *val = tap_cfg0.tap_x_en;
-
-  return ret;
+  dec->handler[(uint8_t)tag & 0x1FU] = fn;
 }
 
 /**
-  * @brief  X-axis tap recognition threshold.[set]
+  * @brief  Decode num FIFO words and dispatch each one to the handler of
+  *         its tag. Words with a parity error or an unknown tag are
+  *         counted and skipped.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_ths_x in reg TAP_CFG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  dec    FIFO decoder.(ptr)
+  * @param  buff   Words read with fifo_out_multi_raw_get.(ptr)
+  * @param  num    Number of words in buff
+  * @retval        Number of words dispatched to a handler
   *
   */
-int32_t ism330dhcx_tap_threshold_x_set(const stmdev_ctx_t *ctx, uint8_t val)
+uint16_t ism330dhcx_fifo_decode(ism330dhcx_fifo_decoder_t *dec,
+                                const uint8_t *buff, uint16_t num)
 {
-  ism330dhcx_tap_cfg1_t tap_cfg1;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
-                            (uint8_t *)&tap_cfg1, 1);
+  ism330dhcx_fifo_handler_ptr fn;
+  ism330dhcx_fifo_word_t word;
+  const ism330dhcx_fifo_data_out_tag_t *fifo_data_out_tag;
+  const uint8_t *raw;
+  uint16_t done = 0;
+  uint16_t i;
 
-  if (ret == 0)
+  for (i = 0; i < num; i++)
   {
-    tap_cfg1.tap_ths_x = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG1,
-                               (uint8_t *)&tap_cfg1, 1);
+    raw = &buff[i * ISM330DHCX_FIFO_WORD_LEN];
+    dec->words++;
+
+    if (ism330dhcx_fifo_word_decode(raw, &word) != 0)
+    {
+      fifo_data_out_tag = (const ism330dhcx_fifo_data_out_tag_t *)raw;
+
+      if (ism330dhcx_fifo_tag_map[fifo_data_out_tag->tag_sensor] == 0U)
+      {
+        dec->unknown++;
+      }
+
+      else
+      {
+        dec->parity_err++;
+      }
+    }
+
+    else
+    {
+      fn = dec->handler[(uint8_t)word.tag];
+
+      if (fn != NULL)
+      {
+        fn(dec->arg, &word);
+        done++;
+      }
+    }
   }
 
-  return ret;
+  return done;
 }
 
 /**
-  * @brief  X-axis tap recognition threshold.[get]
+  * @brief  Initialize a FIFO decompressor. Compressed words are dropped
+  *         until the first non-compressed word of each sensor provides
+  *         the reference sample; the rate of forced non-compressed
+  *         words (compression_algo_set) bounds this resync latency.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_ths_x in reg TAP_CFG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  dc     FIFO decompressor.(ptr)
+  * @param  out    Routine receiving every rebuilt sample.(ptr)
+  * @param  arg    Argument of out.(ptr)
   *
   */
-int32_t ism330dhcx_tap_threshold_x_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
+void ism330dhcx_fifo_decomp_init(ism330dhcx_fifo_decomp_t *dc,
+                                 ism330dhcx_fifo_sample_ptr out, void *arg)
 {
-  ism330dhcx_tap_cfg1_t tap_cfg1;
-  int32_t ret;
+  uint8_t i;
+  uint8_t j;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
-                            (uint8_t *)&tap_cfg1, 1);
-  *val = tap_cfg1.tap_ths_x;
+  for (i = 0; i < 2U; i++)
+  {
+    for (j = 0; j < 3U; j++)
+    {
+      dc->last[i][j] = 0;
+    }
 
-  return ret;
+    dc->valid[i] = PROPERTY_DISABLE;
+  }
+
+  dc->out = out;
+  dc->arg = arg;
+  dc->samples = 0;
+  dc->dropped = 0;
 }
 
 /**
-  * @brief  Selection of axis priority for TAP detection.[set]
+  * @brief  Emit a rebuilt sample and keep it as reference of the sensor.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_priority in reg TAP_CFG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  dc     FIFO decompressor.(ptr)
+  * @param  id     0 -> accelerometer, 1 -> gyroscope
+  * @param  cnt    Tag counter of the sample time slot
+  * @param  val    Sample.(ptr)
   *
   */
-int32_t ism330dhcx_tap_axis_priority_set(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_tap_priority_t val)
+static void ism330dhcx_fifo_decomp_emit(ism330dhcx_fifo_decomp_t *dc,
+                                        uint8_t id, uint8_t cnt,
+                                        const int16_t *val)
 {
-  ism330dhcx_tap_cfg1_t tap_cfg1;
-  int32_t ret;
+  ism330dhcx_fifo_sample_t sample;
+  uint8_t i;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
-                            (uint8_t *)&tap_cfg1, 1);
+  sample.tag = (id == 0U) ? ISM330DHCX_XL_NC_TAG : ISM330DHCX_GYRO_NC_TAG;
+  sample.cnt = cnt & 0x03U;
 
-  if (ret == 0)
+  for (i = 0; i < 3U; i++)
   {
-    tap_cfg1.tap_priority = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG1,
-                               (uint8_t *)&tap_cfg1, 1);
+    sample.val[i] = val[i];
+    dc->last[id][i] = val[i];
   }
 
-  return ret;
+  dc->valid[id] = PROPERTY_ENABLE;
+  dc->samples++;
+
+  if (dc->out != NULL)
+  {
+    dc->out(dc->arg, &sample);
+  }
 }
 
 /**
-  * @brief  Selection of axis priority for TAP detection[get]
+  * @brief  Rebuild the accelerometer / gyroscope samples carried by a
+  *         FIFO word. A word tagged with counter t holds:
+  *         NC     -> sample t (16 bit)
+  *         NC_T_1 -> sample t-1 (16 bit)
+  *         NC_T_2 -> sample t-2 (16 bit)
+  *         2XC    -> samples t-2, t-1 as 8-bit differences
+  *         3XC    -> samples t-2, t-1, t as 5-bit differences
+  *         Differences apply to the previous sample of the same sensor.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of tap_priority in reg TAP_CFG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  dc     FIFO decompressor.(ptr)
+  * @param  word   Decoded FIFO word.(ptr)
+  * @retval        Number of samples rebuilt (0 for other sensors, or
+  *                while waiting for a reference sample)
   *
   */
-int32_t ism330dhcx_tap_axis_priority_get(const stmdev_ctx_t *ctx,
-                                         ism330dhcx_tap_priority_t *val)
+uint8_t ism330dhcx_fifo_decompress(ism330dhcx_fifo_decomp_t *dc,
+                                   const ism330dhcx_fifo_word_t *word)
 {
-  ism330dhcx_tap_cfg1_t tap_cfg1;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG1,
-                            (uint8_t *)&tap_cfg1, 1);
+  const uint8_t *d = word->data;
+  int16_t val[3];
+  int32_t diff;
+  uint16_t packed = 0;
+  uint8_t id = 0;
+  uint8_t lag = 0;
+  uint8_t num = 0;
+  uint8_t i;
+  uint8_t j;
 
-  switch (tap_cfg1.tap_priority)
+  switch (word->tag)
   {
-    case ISM330DHCX_XYZ:
-      *val = ISM330DHCX_XYZ;
+    case ISM330DHCX_XL_NC_TAG:
+    case ISM330DHCX_GYRO_NC_TAG:
+      lag = 0;
       break;
 
-    case ISM330DHCX_YXZ:
-      *val = ISM330DHCX_YXZ;
+    case ISM330DHCX_XL_NC_T_1_TAG:
+    case ISM330DHCX_GYRO_NC_T_1_TAG:
+      lag = 1;
       break;
 
-    case ISM330DHCX_XZY:
-      *val = ISM330DHCX_XZY;
+    case ISM330DHCX_XL_NC_T_2_TAG:
+    case ISM330DHCX_GYRO_NC_T_2_TAG:
+      lag = 2;
       break;
 
-    case ISM330DHCX_ZYX:
-      *val = ISM330DHCX_ZYX;
+    case ISM330DHCX_XL_2XC_TAG:
+    case ISM330DHCX_GYRO_2XC_TAG:
+      num = 2;
       break;
 
-    case ISM330DHCX_YZX:
-      *val = ISM330DHCX_YZX;
+    case ISM330DHCX_XL_3XC_TAG:
+    case ISM330DHCX_GYRO_3XC_TAG:
+      num = 3;
       break;
 
-    case ISM330DHCX_ZXY:
-      *val = ISM330DHCX_ZXY;
+    default:
+      return 0;
+  }
+
+  switch (word->tag)
+  {
+    case ISM330DHCX_GYRO_NC_TAG:
+    case ISM330DHCX_GYRO_NC_T_1_TAG:
+    case ISM330DHCX_GYRO_NC_T_2_TAG:
+    case ISM330DHCX_GYRO_2XC_TAG:
+    case ISM330DHCX_GYRO_3XC_TAG:
+      id = 1;
       break;
 
     default:
-      *val = ISM330DHCX_XYZ;
+      id = 0;
       break;
   }
 
-  return ret;
+  if (num == 0U)
+  {
+    for (i = 0; i < 3U; i++)
+    {
+      val[i] = (int16_t)d[(2U * i) + 1U];
+      val[i] = (val[i] * 256) + (int16_t)d[2U * i];
+    }
+
+    ism330dhcx_fifo_decomp_emit(dc, id, (uint8_t)(word->cnt - lag), val);
+
+    return 1;
+  }
+
+  if (dc->valid[id] == PROPERTY_DISABLE)
+  {
+    dc->dropped += num;
+
+    return 0;
+  }
+
+  for (j = 0; j < num; j++)
+  {
+    if (num == 3U)
+    {
+      packed = (uint16_t)d[(2U * j) + 1U];
+      packed = (uint16_t)(packed << 8) | (uint16_t)d[2U * j];
+    }
+
+    for (i = 0; i < 3U; i++)
+    {
+      if (num == 2U)
+      {
+        diff = (int32_t)d[(3U * j) + i];
+        diff = (diff > 127) ? (diff - 256) : diff;
+      }
+
+      else
+      {
+        diff = (int32_t)((packed >> (5U * i)) & 0x1FU);
+        diff = (diff > 15) ? (diff - 32) : diff;
+      }
+
+      /* wraps as the 16-bit differences computed by the device */
+      val[i] = (int16_t)(uint16_t)((uint16_t)dc->last[id][i] +
+                                   (uint16_t)diff);
+    }
+
+    ism330dhcx_fifo_decomp_emit(dc, id, (uint8_t)((word->cnt + j) - 2U), val);
+  }
+
+  return num;
 }
 
 /**
-  * @brief  Y-axis tap recognition threshold.[set]
+  * @brief  FIFO decoder handler feeding a decompressor, to be installed
+  *         for all the accelerometer and gyroscope tags of a decoder
+  *         whose argument is the decompressor.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_ths_y in reg TAP_CFG2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  arg    FIFO decompressor.(ptr)
+  * @param  word   Decoded FIFO word.(ptr)
   *
   */
-int32_t ism330dhcx_tap_threshold_y_set(const stmdev_ctx_t *ctx, uint8_t val)
+void ism330dhcx_fifo_decomp_handler(void *arg,
+                                    const ism330dhcx_fifo_word_t *word)
 {
-  ism330dhcx_tap_cfg2_t tap_cfg2;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
-                            (uint8_t *)&tap_cfg2, 1);
-
-  if (ret == 0)
-  {
-    tap_cfg2.tap_ths_y = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_CFG2,
-                               (uint8_t *)&tap_cfg2, 1);
-  }
-
-  return ret;
+  (void)ism330dhcx_fifo_decompress((ism330dhcx_fifo_decomp_t *)arg, word);
 }
 
 /**
-  * @brief  Y-axis tap recognition threshold.[get]
+  * @brief  Initialize a FIFO timestamp reconstruction. Both the timestamp
+  *         counter (25 us typ.) and the ODR follow the internal
+  *         oscillator, whose deviation is given by odr_cal_reg_get in
+  *         0.15 % steps.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_ths_y in reg TAP_CFG2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ts     FIFO timestamp reconstruction.(ptr)
+  * @param  odr    Highest batch data rate in FIFO [Hz], it sets the
+  *                tag counter time slot
+  * @param  dec    Timestamp decimation (fifo_timestamp_decimation_set)
+  * @param  fine   Oscillator trim read with odr_cal_reg_get
   *
   */
-int32_t ism330dhcx_tap_threshold_y_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
+void ism330dhcx_fifo_ts_init(ism330dhcx_fifo_ts_t *ts, float_t odr,
+                             ism330dhcx_odr_ts_batch_t dec, int8_t fine)
 {
-  ism330dhcx_tap_cfg2_t tap_cfg2;
-  int32_t ret;
+  float_t trim = 1.0f + (0.0015f * (float_t)fine);
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG2,
-                            (uint8_t *)&tap_cfg2, 1);
-  *val = tap_cfg2.tap_ths_y;
+  ts->tick_ps = (uint32_t)((25000000.0f / trim) + 0.5f);
+  ism330dhcx_fifo_ts_rate_set(ts, odr);
 
-  return ret;
+  switch (dec)
+  {
+    case ISM330DHCX_DEC_1:
+      ts->dec = 1;
+      break;
+
+    case ISM330DHCX_DEC_8:
+      ts->dec = 8;
+      break;
+
+    case ISM330DHCX_DEC_32:
+      ts->dec = 32;
+      break;
+
+    default:
+      ts->dec = 0;
+      break;
+  }
+
+  ts->ns = 0;
+  ts->ps = 0;
+  ts->raw = 0;
+  ts->slot = 0;
+  ts->cnt = 0;
+  ts->synced = PROPERTY_DISABLE;
+  ts->rollover = 0;
+  ts->slot_pre = 0;
+  ts->lost = 0;
+  ts->lost_total = 0;
+  ts->resync = 0;
+  ts->gap = PROPERTY_DISABLE;
 }
 
 /**
-  * @brief  Z-axis recognition threshold.[set]
+  * @brief  Track the time slots of a FIFO stream. To be called for every
+  *         decoded FIFO word, in FIFO order: the tag counter changes at
+  *         each time slot and TIMESTAMP words re-anchor the time base.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_ths_z in reg TAP_THS_6D
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ts     FIFO timestamp reconstruction.(ptr)
+  * @param  word   Decoded FIFO word.(ptr)
   *
   */
-int32_t ism330dhcx_tap_threshold_z_set(const stmdev_ctx_t *ctx, uint8_t val)
+void ism330dhcx_fifo_ts_word(ism330dhcx_fifo_ts_t *ts,
+                             const ism330dhcx_fifo_word_t *word)
 {
-  ism330dhcx_tap_ths_6d_t tap_ths_6d;
-  int32_t ret;
+  const uint8_t *d = word->data;
+  uint64_t delta;
+  uint32_t raw;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                            (uint8_t *)&tap_ths_6d, 1);
+  if (ts->resync == 1U)
+  {
+    /* tag counter not contiguous across the gap */
+    ts->slot_pre = ts->slot;
+    ts->slot = 0;
+    ts->resync = 2;
+  }
 
-  if (ret == 0)
+  else
   {
-    tap_ths_6d.tap_ths_z = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                               (uint8_t *)&tap_ths_6d, 1);
+    ts->slot += (uint32_t)((word->cnt - ts->cnt) & 0x03U);
+  }
+
+  ts->cnt = word->cnt;
+
+  if (word->tag != ISM330DHCX_TIMESTAMP_TAG)
+  {
+    return;
+  }
+
+  raw = (uint32_t)d[3];
+  raw = (raw * 256U) + (uint32_t)d[2];
+  raw = (raw * 256U) + (uint32_t)d[1];
+  raw = (raw * 256U) + (uint32_t)d[0];
+
+  if (ts->synced == PROPERTY_DISABLE)
+  {
+    delta = (uint64_t)raw * ts->tick_ps;
+  }
+
+  else
+  {
+    if (raw < ts->raw)
+    {
+      ts->rollover++;
+    }
+
+    /* modulo 2^32: the 32-bit counter rollover is absorbed here */
+    delta = (uint64_t)(uint32_t)(raw - ts->raw) * ts->tick_ps;
+
+    if ((ts->resync != 0U) && (ts->slot_ps != 0U))
+    {
+      /*
+       * slots elapsed minus the slot steps seen on both sides of the
+       * gap and the step across it
+       */
+      ts->lost = (uint32_t)((delta + (ts->slot_ps / 2U)) / ts->slot_ps);
+      ts->lost = (ts->lost > (ts->slot_pre + ts->slot + 1U)) ?
+                 ts->lost - (ts->slot_pre + ts->slot + 1U) : 0U;
+      ts->lost_total += ts->lost;
+      ts->gap = PROPERTY_ENABLE;
+    }
+
+    /* measured slot period, when no time slot was lost */
+    else if ((ts->dec != 0U) && (ts->slot == ts->dec))
+    {
+      ts->slot_ps = delta / ts->dec;
+    }
+
+    else
+    {
+      /* slot period kept */
+    }
   }
 
-  return ret;
+  ts->resync = 0;
+
+  delta += ts->ps;
+  ts->ns += delta / 1000U;
+  ts->ps = (uint32_t)(delta % 1000U);
+  ts->raw = raw;
+  ts->slot = 0;
+  ts->synced = PROPERTY_ENABLE;
 }
 
 /**
-  * @brief  Z-axis recognition threshold.[get]
+  * @brief  Timestamp of a sample of the current FIFO stream position.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tap_ths_z in reg TAP_THS_6D
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ts     FIFO timestamp reconstruction.(ptr)
+  * @param  cnt    Tag counter of the sample time slot, e.g.
+  *                ism330dhcx_fifo_sample_t.cnt
+  * @param  val    Sample time [ns] since the timestamp counter reset.(ptr)
+  * @retval        0 -> valid, -1 -> no TIMESTAMP word received yet
   *
   */
-int32_t ism330dhcx_tap_threshold_z_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
+int32_t ism330dhcx_fifo_ts_get(const ism330dhcx_fifo_ts_t *ts, uint8_t cnt,
+                               uint64_t *val)
 {
-  ism330dhcx_tap_ths_6d_t tap_ths_6d;
-  int32_t ret;
+  int64_t slot;
+  int64_t ps;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                            (uint8_t *)&tap_ths_6d, 1);
-  *val = tap_ths_6d.tap_ths_z;
+  if ((ts->synced == PROPERTY_DISABLE) || (ts->resync != 0U))
+  {
+    return -1;
+  }
 
-  return ret;
+  /* samples of slots t-1, t-2 can follow the current position */
+  slot = (int64_t)ts->slot - (int64_t)((ts->cnt - cnt) & 0x03U);
+  ps = (slot * (int64_t)ts->slot_ps) + (int64_t)ts->ps;
+  *val = (uint64_t)((int64_t)ts->ns + (ps / 1000));
+
+  return 0;
 }
 
 /**
-  * @brief  Maximum duration is the maximum time of an overthreshold signal
-  *         detection to be recognized as a tap event. The default value of
-  *         these bits is 00b which corresponds to 4*ODR_XL time.
-  *         If the SHOCK[1:0] bits are set to a different value, 1LSB
-  *         corresponds to 8*ODR_XL time.[set]
+  * @brief  Declare a gap in the FIFO stream (overrun): samples have no
+  *         time until the next TIMESTAMP word, which also estimates the
+  *         number of time slots lost (lost, gap).
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of shock in reg INT_DUR2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ts     FIFO timestamp reconstruction.(ptr)
   *
   */
-int32_t ism330dhcx_tap_shock_set(const stmdev_ctx_t *ctx, uint8_t val)
+void ism330dhcx_fifo_ts_resync(ism330dhcx_fifo_ts_t *ts)
 {
-  ism330dhcx_int_dur2_t int_dur2;
-  int32_t ret;
+  if (ts->synced == PROPERTY_ENABLE)
+  {
+    ts->resync = 1;
+  }
+}
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
-                            (uint8_t *)&int_dur2, 1);
+/**
+  * @brief  Change the nominal time slot rate, e.g. after a batch data
+  *         rate change. The oscillator trim given at init is kept.
+  *
+  * @param  ts     FIFO timestamp reconstruction.(ptr)
+  * @param  odr    Highest batch data rate in FIFO [Hz], 1 Hz to 10 kHz
+  *                (0 -> unknown, measured from the TIMESTAMP words)
+  *
+  */
+void ism330dhcx_fifo_ts_rate_set(ism330dhcx_fifo_ts_t *ts, float_t odr)
+{
+  uint64_t odr_mhz;
 
-  if (ret == 0)
+  if ((odr >= 1.0f) && (odr <= 10000.0f))
   {
-    int_dur2.shock = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_DUR2,
-                               (uint8_t *)&int_dur2, 1);
+    /*
+     * slot = 1 / odr, scaled by tick_ps / 25 us (trimmed oscillator
+     * period ratio): tick_ps * 4e4 / odr, with odr in mHz
+     */
+    odr_mhz = (uint64_t)((odr * 1000.0f) + 0.5f);
+    ts->slot_ps = (((uint64_t)ts->tick_ps * 40000000U) + (odr_mhz / 2U)) /
+                  odr_mhz;
   }
 
-  return ret;
+  else
+  {
+    ts->slot_ps = 0;
+  }
 }
 
 /**
-  * @brief  Maximum duration is the maximum time of an overthreshold signal
-  *         detection to be recognized as a tap event. The default value of
-  *         these bits is 00b which corresponds to 4*ODR_XL time.
-  *         If the SHOCK[1:0] bits are set to a different value, 1LSB
-  *         corresponds to 8*ODR_XL time.[get]
+  * @brief  Output settings from CTRL1_XL, CTRL2_G and FIFO_CTRL3 values.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of shock in reg INT_DUR2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  buff   CTRL1_XL, CTRL2_G, FIFO_CTRL3.(ptr)
+  * @param  val    Output settings.(ptr)
   *
   */
-int32_t ism330dhcx_tap_shock_get(const stmdev_ctx_t *ctx, uint8_t *val)
+static void ism330dhcx_fifo_cfg_decode(const uint8_t *buff,
+                                       ism330dhcx_fifo_cfg_t *val)
 {
-  ism330dhcx_int_dur2_t int_dur2;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
-                            (uint8_t *)&int_dur2, 1);
-  *val = int_dur2.shock;
+  const ism330dhcx_ctrl1_xl_t *ctrl1_xl =
+    (const ism330dhcx_ctrl1_xl_t *)&buff[0];
+  const ism330dhcx_ctrl2_g_t *ctrl2_g =
+    (const ism330dhcx_ctrl2_g_t *)&buff[1];
+  const ism330dhcx_fifo_ctrl3_t *fifo_ctrl3 =
+    (const ism330dhcx_fifo_ctrl3_t *)&buff[2];
 
-  return ret;
+  val->xl_odr = (ism330dhcx_odr_xl_t)ctrl1_xl->odr_xl;
+  val->xl_fs = (ism330dhcx_fs_xl_t)ctrl1_xl->fs_xl;
+  val->gy_odr = (ism330dhcx_odr_g_t)ctrl2_g->odr_g;
+  val->gy_fs = (ism330dhcx_fs_g_t)ctrl2_g->fs_g;
+  val->xl_bdr = (ism330dhcx_bdr_xl_t)fifo_ctrl3->bdr_xl;
+  val->gy_bdr = (ism330dhcx_bdr_gy_t)fifo_ctrl3->bdr_gy;
 }
 
 /**
-  * @brief  Quiet time is the time after the first detected tap in which
-  *         there must not be any overthreshold event.
-  *         The default value of these bits is 00b which corresponds to
-  *         2*ODR_XL time. If the QUIET[1:0] bits are set to a different
-  *         value, 1LSB corresponds to 4*ODR_XL time.[set]
+  * @brief  Read the output settings that apply to the FIFO stream:
+  *         data rate and full scale of both sensors and their batch
+  *         data rates.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of quiet in reg INT_DUR2
+  * @param  val    Output settings.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tap_quiet_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_fifo_cfg_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_fifo_cfg_t *val)
 {
-  ism330dhcx_int_dur2_t int_dur2;
+  uint8_t buff[3];
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
-                            (uint8_t *)&int_dur2, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL1_XL, buff, 2);
 
   if (ret == 0)
   {
-    int_dur2.quiet = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_DUR2,
-                               (uint8_t *)&int_dur2, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3, &buff[2], 1);
+  }
+
+  if (ret == 0)
+  {
+    ism330dhcx_fifo_cfg_decode(buff, val);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Quiet time is the time after the first detected tap in which
-  *         there must not be any overthreshold event.
-  *         The default value of these bits is 00b which corresponds to
-  *         2*ODR_XL time. If the QUIET[1:0] bits are set to a different
-  *         value, 1LSB corresponds to 4*ODR_XL time.[get]
+  * @brief  Output settings carried by a CFG_CHANGE word: CTRL1_XL,
+  *         CTRL2_G and FIFO_CTRL3 values in data bytes 0 to 2.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of quiet in reg INT_DUR2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  word   Decoded CFG_CHANGE FIFO word.(ptr)
+  * @param  val    Output settings in force from this word on.(ptr)
   *
   */
-int32_t ism330dhcx_tap_quiet_get(const stmdev_ctx_t *ctx, uint8_t *val)
+void ism330dhcx_fifo_cfg_change_get(const ism330dhcx_fifo_word_t *word,
+                                    ism330dhcx_fifo_cfg_t *val)
 {
-  ism330dhcx_int_dur2_t int_dur2;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
-                            (uint8_t *)&int_dur2, 1);
-  *val = int_dur2.quiet;
-
-  return ret;
+  ism330dhcx_fifo_cfg_decode(word->data, val);
 }
 
 /**
-  * @brief  When double tap recognition is enabled, this register expresses
-  *         the maximum time between two consecutive detected taps to
-  *         determine a double tap event.
-  *         The default value of these bits is 0000b which corresponds to
-  *         16*ODR_XL time.
-  *         If the DUR[3:0] bits are set to a different value, 1LSB
-  *         corresponds to 32*ODR_XL time.[set]
+  * @brief  Time slot rate of a FIFO configuration: the highest of the
+  *         accelerometer and gyroscope batch data rates.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of dur in reg INT_DUR2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  val    Output settings.(ptr)
+  * @retval        Time slot rate [Hz], 0 if nothing is batched
   *
   */
-int32_t ism330dhcx_tap_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+float_t ism330dhcx_fifo_cfg_slot_rate_get(const ism330dhcx_fifo_cfg_t *val)
 {
-  ism330dhcx_int_dur2_t int_dur2;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
-                            (uint8_t *)&int_dur2, 1);
-
-  if (ret == 0)
+  /* BDR_XL / BDR_GY codes, 11 -> 6.5 Hz */
+  static const float_t bdr_hz[16] =
   {
-    int_dur2.dur = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_INT_DUR2,
-                               (uint8_t *)&int_dur2, 1);
-  }
+    0.0f, 12.5f, 26.0f, 52.0f, 104.0f, 208.0f, 417.0f, 833.0f,
+    1667.0f, 3333.0f, 6667.0f, 6.5f, 0.0f, 0.0f, 0.0f, 0.0f,
+  };
+  float_t xl = bdr_hz[(uint8_t)val->xl_bdr & 0x0FU];
+  float_t gy = bdr_hz[(uint8_t)val->gy_bdr & 0x0FU];
 
-  return ret;
+  return (xl > gy) ? xl : gy;
 }
 
 /**
-  * @brief  When double tap recognition is enabled, this register expresses the
-  *         maximum time between two consecutive detected taps to determine
-  *         a double tap event. The default value of these bits is 0000b which
-  *         corresponds to 16*ODR_XL time. If the DUR[3:0] bits are set to
-  *         a different value, 1LSB corresponds to 32*ODR_XL time.[get]
+  * @brief  Initialize an adaptive FIFO watermark controller. The
+  *         watermark starts at wtm_min and must be programmed by the
+  *         first ism330dhcx_wtm_ctrl_update.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of dur in reg INT_DUR2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ctrl     Watermark controller.(ptr)
+  * @param  rate     FIFO words written per second, all batched sensors
+  * @param  budget   Latency budget of the oldest sample [us]
+  * @param  wtm_min  Lowest watermark allowed [words]
+  * @param  wtm_max  Highest watermark allowed [words]
   *
   */
-int32_t ism330dhcx_tap_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+void ism330dhcx_wtm_ctrl_init(ism330dhcx_wtm_ctrl_t *ctrl, uint32_t rate,
+                              uint32_t budget, uint16_t wtm_min,
+                              uint16_t wtm_max)
 {
-  ism330dhcx_int_dur2_t int_dur2;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_INT_DUR2,
-                            (uint8_t *)&int_dur2, 1);
-  *val = int_dur2.dur;
-
-  return ret;
+  ctrl->rate = rate;
+  ctrl->budget = budget;
+  ctrl->wtm_min = (wtm_min == 0U) ? 1U : wtm_min;
+  ctrl->wtm_max = (wtm_max > ISM330DHCX_FIFO_WORDS) ?
+                  ISM330DHCX_FIFO_WORDS : wtm_max;
+  ctrl->wtm = ctrl->wtm_min;
+  ctrl->drain = 0;
+  ctrl->excess = 0;
+  ctrl->changes = 0;
+  ctrl->programmed = PROPERTY_DISABLE;
 }
 
 /**
-  * @brief  Single/double-tap event enable.[set]
+  * @brief  Adapt the FIFO watermark after a watermark interrupt.
+  *         The oldest sample waits wtm / rate in FIFO plus the drain
+  *         time: the watermark is raised (fewer interrupts) as long as
+  *         this stays within the latency budget, and lowered when the
+  *         words written while waiting for and serving the interrupt
+  *         would not fit in the FIFO any more.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of single_double_tap in reg WAKE_UP_THS
+  * @param  ctrl   Watermark controller.(ptr)
+  * @param  level  FIFO level read at interrupt time (fifo_data_level_get)
+  * @param  drain  Time from the interrupt to the end of the drain [us]
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tap_mode_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_single_double_tap_t val)
+int32_t ism330dhcx_wtm_ctrl_update(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_wtm_ctrl_t *ctrl,
+                                   uint16_t level, uint32_t drain)
 {
-  ism330dhcx_wake_up_ths_t wake_up_ths;
-  int32_t ret;
+  uint32_t excess;
+  uint32_t headroom;
+  uint32_t limit;
+  uint32_t target;
+  uint32_t wtm;
+  int32_t ret = 0;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                            (uint8_t *)&wake_up_ths, 1);
+  /* smoothed drain time, peak of the words beyond the watermark */
+  ctrl->drain = ((3U * ctrl->drain) + drain + 3U) / 4U;
+  excess = (level > ctrl->wtm) ? (uint32_t)level - ctrl->wtm : 0U;
+  /* decay by 1/8, at least one word so that it settles to 0 */
+  ctrl->excess -= (ctrl->excess + 7U) / 8U;
+  ctrl->excess = (excess > ctrl->excess) ? excess : ctrl->excess;
 
-  if (ret == 0)
+  if (ctrl->budget > ctrl->drain)
   {
-    wake_up_ths.single_double_tap = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                               (uint8_t *)&wake_up_ths, 1);
+    target = (uint32_t)(((uint64_t)(ctrl->budget - ctrl->drain) *
+                         ctrl->rate) / 1000000U);
   }
 
-  return ret;
-}
+  else
+  {
+    target = 0;
+  }
 
-/**
-  * @brief  Single/double-tap event enable.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of single_double_tap in reg WAKE_UP_THS
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_tap_mode_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_single_double_tap_t *val)
-{
-  ism330dhcx_wake_up_ths_t wake_up_ths;
-  int32_t ret;
+  /* twice the words observed beyond the watermark, kept free */
+  headroom = (uint32_t)(((uint64_t)ctrl->drain * ctrl->rate) / 1000000U);
+  headroom = 2U * (headroom + ctrl->excess);
+  limit = (headroom < ISM330DHCX_FIFO_WORDS) ?
+          ISM330DHCX_FIFO_WORDS - headroom : 0U;
+  limit = (limit > ctrl->wtm_max) ? ctrl->wtm_max : limit;
+  target = (target > limit) ? limit : target;
+  target = (target < ctrl->wtm_min) ? ctrl->wtm_min : target;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_THS,
-                            (uint8_t *)&wake_up_ths, 1);
+  /* move half way: the next interrupts measure the new setting */
+  wtm = ctrl->wtm;
 
-  switch (wake_up_ths.single_double_tap)
+  if (target > wtm)
   {
-    case ISM330DHCX_ONLY_SINGLE:
-      *val = ISM330DHCX_ONLY_SINGLE;
-      break;
+    wtm += (target - wtm + 1U) / 2U;
+  }
 
-    case ISM330DHCX_BOTH_SINGLE_DOUBLE:
-      *val = ISM330DHCX_BOTH_SINGLE_DOUBLE;
-      break;
+  else
+  {
+    wtm -= (wtm - target + 1U) / 2U;
+  }
 
-    default:
-      *val = ISM330DHCX_ONLY_SINGLE;
-      break;
+  if ((wtm != ctrl->wtm) || (ctrl->programmed == PROPERTY_DISABLE))
+  {
+    ret = ism330dhcx_fifo_watermark_set(ctx, (uint16_t)wtm);
+
+    if (ret == 0)
+    {
+      ctrl->wtm = (uint16_t)wtm;
+      ctrl->changes++;
+      ctrl->programmed = PROPERTY_ENABLE;
+    }
   }
 
   return ret;
 }
 
 /**
-  * @}
+  * @brief  Initialize a pool with the batches provided by the caller.
   *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_ Six_position_detection(6D/4D)
-  * @brief      This section groups all the functions concerning six
-  *             position detection (6D).
-  * @{
+  * @param  pool   Batch pool.(ptr)
+  * @param  batch  Array of len batches.(ptr)
+  * @param  len    Number of batches, at most ISM330DHCX_BATCH_POOL_LEN
   *
   */
+void ism330dhcx_batch_pool_init(ism330dhcx_batch_pool_t *pool,
+                                ism330dhcx_batch_t *batch, uint16_t len)
+{
+  uint16_t i;
+
+  pool->head = 0;
+  pool->tail = 0;
+  pool->empty = 0;
+
+  for (i = 0; (i < len) && (i < ISM330DHCX_BATCH_POOL_LEN); i++)
+  {
+    ism330dhcx_batch_put(pool, &batch[i]);
+  }
+}
 
 /**
-  * @brief  Threshold for 4D/6D function.[set]
+  * @brief  Take an empty batch from the pool, FIFO drain context only.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sixd_ths in reg TAP_THS_6D
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  pool   Batch pool.(ptr)
+  * @retval        Batch, NULL if the pool is empty
   *
   */
-int32_t ism330dhcx_6d_threshold_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sixd_ths_t val)
+ism330dhcx_batch_t *ism330dhcx_batch_get(ism330dhcx_batch_pool_t *pool)
 {
-  ism330dhcx_tap_ths_6d_t tap_ths_6d;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                            (uint8_t *)&tap_ths_6d, 1);
+  ism330dhcx_batch_t *batch;
+  uint32_t tail = pool->tail;
 
-  if (ret == 0)
+  if (tail == pool->head)
   {
-    tap_ths_6d.sixd_ths = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                               (uint8_t *)&tap_ths_6d, 1);
+    pool->empty++;
+
+    return NULL;
   }
 
-  return ret;
+  /* head read before the slot */
+  ISM330DHCX_RING_BARRIER();
+  batch = pool->slot[tail & (ISM330DHCX_BATCH_POOL_LEN - 1U)];
+
+  /* slot read before it is released */
+  ISM330DHCX_RING_BARRIER();
+  pool->tail = tail + 1U;
+  batch->len = 0;
+
+  return batch;
 }
 
 /**
-  * @brief  Threshold for 4D/6D function.[get]
+  * @brief  Give a consumed batch back to the pool, batch consumer
+  *         context only. Batches beyond the pool capacity are not
+  *         stored.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sixd_ths in reg TAP_THS_6D
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  pool   Batch pool.(ptr)
+  * @param  batch  Batch.(ptr)
   *
   */
-int32_t ism330dhcx_6d_threshold_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sixd_ths_t *val)
+void ism330dhcx_batch_put(ism330dhcx_batch_pool_t *pool,
+                          ism330dhcx_batch_t *batch)
 {
-  ism330dhcx_tap_ths_6d_t tap_ths_6d;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                            (uint8_t *)&tap_ths_6d, 1);
+  uint32_t head = pool->head;
 
-  switch (tap_ths_6d.sixd_ths)
+  if ((head - pool->tail) >= ISM330DHCX_BATCH_POOL_LEN)
   {
-    case ISM330DHCX_DEG_80:
-      *val = ISM330DHCX_DEG_80;
-      break;
-
-    case ISM330DHCX_DEG_70:
-      *val = ISM330DHCX_DEG_70;
-      break;
-
-    case ISM330DHCX_DEG_60:
-      *val = ISM330DHCX_DEG_60;
-      break;
-
-    case ISM330DHCX_DEG_50:
-      *val = ISM330DHCX_DEG_50;
-      break;
-
-    default:
-      *val = ISM330DHCX_DEG_80;
-      break;
+    return;
   }
 
-  return ret;
+  pool->slot[head & (ISM330DHCX_BATCH_POOL_LEN - 1U)] = batch;
+
+  /* slot visible before the new head */
+  ISM330DHCX_RING_BARRIER();
+  pool->head = head + 1U;
 }
 
 /**
-  * @brief  4D orientation detection enable.[set]
+  * @brief  Initialize a batcher: decoded FIFO words in, one batch
+  *         stream per channel out. Install ism330dhcx_batcher_word as
+  *         handler of every tag of a decoder whose argument is bt;
+  *         compressed words are expanded on the way.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of d4d_en in reg TAP_THS_6D
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  bt     Batcher.(ptr)
+  * @param  pool   Pool providing the batches.(ptr)
+  * @param  ts     Timestamp reconstruction fed by the batcher, or NULL.(ptr)
+  * @param  ready  Routine receiving every full batch; it must give the
+  *                batch back with ism330dhcx_batch_put once consumed.(ptr)
+  * @param  arg    Argument of ready.(ptr)
   *
   */
-int32_t ism330dhcx_4d_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+void ism330dhcx_batcher_init(ism330dhcx_batcher_t *bt,
+                             ism330dhcx_batch_pool_t *pool,
+                             ism330dhcx_fifo_ts_t *ts,
+                             ism330dhcx_batch_ready_ptr ready, void *arg)
 {
-  ism330dhcx_tap_ths_6d_t tap_ths_6d;
-  int32_t ret;
+  uint8_t i;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                            (uint8_t *)&tap_ths_6d, 1);
+  bt->pool = pool;
+  bt->ready = ready;
+  bt->arg = arg;
+  bt->ts = ts;
+  bt->cfg_changes = 0;
+  bt->gap = NULL;
+  bt->gap_pending = 0;
+  bt->overruns = 0;
+  bt->counter_bdr = 0;
+  bt->dropped = 0;
+  bt->cfg.xl_odr = ISM330DHCX_XL_ODR_OFF;
+  bt->cfg.xl_fs = ISM330DHCX_2g;
+  bt->cfg.gy_odr = ISM330DHCX_GY_ODR_OFF;
+  bt->cfg.gy_fs = ISM330DHCX_250dps;
+  bt->cfg.xl_bdr = ISM330DHCX_XL_NOT_BATCHED;
+  bt->cfg.gy_bdr = ISM330DHCX_GY_NOT_BATCHED;
 
-  if (ret == 0)
+  for (i = 0; i < (uint8_t)ISM330DHCX_BATCH_CH; i++)
   {
-    tap_ths_6d.d4d_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                               (uint8_t *)&tap_ths_6d, 1);
+    bt->cur[i] = NULL;
   }
 
-  return ret;
+  ism330dhcx_fifo_decomp_init(&bt->decomp, ism330dhcx_batcher_sample, bt);
 }
 
 /**
-  * @brief  4D orientation detection enable.[get]
+  * @brief  Append a sample to the batch of a channel, handing the batch
+  *         over when full.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of d4d_en in reg TAP_THS_6D
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  bt     Batcher.(ptr)
+  * @param  ch     Channel
+  * @param  cnt    Tag counter of the sample time slot
+  * @param  val    x, y, z.(ptr)
   *
   */
-int32_t ism330dhcx_4d_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+static void ism330dhcx_batcher_add(ism330dhcx_batcher_t *bt,
+                                   ism330dhcx_batch_ch_t ch, uint8_t cnt,
+                                   const int16_t *val)
 {
-  ism330dhcx_tap_ths_6d_t tap_ths_6d;
-  int32_t ret;
+  ism330dhcx_batch_t *batch = bt->cur[ch];
+  uint64_t ns = 0;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_THS_6D,
-                            (uint8_t *)&tap_ths_6d, 1);
-  *val = tap_ths_6d.d4d_en;
+  if (batch == NULL)
+  {
+    batch = ism330dhcx_batch_get(bt->pool);
 
-  return ret;
+    if (batch == NULL)
+    {
+      bt->dropped++;
+
+      return;
+    }
+
+    batch->ch = ch;
+    batch->cfg = bt->cfg;
+    batch->gap = ((bt->gap_pending & (1U << (uint8_t)ch)) != 0U) ?
+                 PROPERTY_ENABLE : PROPERTY_DISABLE;
+    bt->gap_pending &= (uint8_t)~(1U << (uint8_t)ch);
+    bt->cur[ch] = batch;
+  }
+
+  if (bt->ts != NULL)
+  {
+    (void)ism330dhcx_fifo_ts_get(bt->ts, cnt, &ns);
+  }
+
+  batch->x[batch->len] = val[0];
+  batch->y[batch->len] = val[1];
+  batch->z[batch->len] = val[2];
+  batch->ns[batch->len] = ns;
+  batch->len++;
+
+  if (batch->len == ISM330DHCX_BATCH_LEN)
+  {
+    bt->cur[ch] = NULL;
+    bt->ready(bt->arg, batch);
+  }
 }
 
 /**
-  * @}
+  * @brief  Decompressor output routine of the batcher.
   *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_free_fall
-  * @brief      This section group all the functions concerning the free
-  *             fall detection.
-  * @{
+  * @param  arg    Batcher.(ptr)
+  * @param  val    Accelerometer or gyroscope sample.(ptr)
   *
   */
+void ism330dhcx_batcher_sample(void *arg,
+                               const ism330dhcx_fifo_sample_t *val)
+{
+  ism330dhcx_batcher_add((ism330dhcx_batcher_t *)arg,
+                         (val->tag == ISM330DHCX_GYRO_NC_TAG) ?
+                         ISM330DHCX_BATCH_GY : ISM330DHCX_BATCH_XL,
+                         val->cnt, val->val);
+}
 
 /**
-  * @brief  Free fall threshold setting.[set]
+  * @brief  Apply the settings carried by a CFG_CHANGE word: batches in
+  *         progress are handed over so that every batch holds samples
+  *         of a single configuration.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ff_ths in reg FREE_FALL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  bt     Batcher.(ptr)
+  * @param  word   CFG_CHANGE word.(ptr)
   *
   */
-int32_t ism330dhcx_ff_threshold_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_ff_ths_t val)
+static void ism330dhcx_batcher_cfg_change(ism330dhcx_batcher_t *bt,
+                                          const ism330dhcx_fifo_word_t *word)
 {
-  ism330dhcx_free_fall_t free_fall;
-  int32_t ret;
+  ism330dhcx_batcher_flush(bt);
+  bt->cfg_changes++;
+  ism330dhcx_fifo_cfg_change_get(word, &bt->cfg);
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
-                            (uint8_t *)&free_fall, 1);
-
-  if (ret == 0)
+  if (bt->ts != NULL)
   {
-    free_fall.ff_ths = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FREE_FALL,
-                               (uint8_t *)&free_fall, 1);
+    ism330dhcx_fifo_ts_rate_set(bt->ts,
+                                ism330dhcx_fifo_cfg_slot_rate_get(&bt->cfg));
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Free fall threshold setting.[get]
+  * @brief  FIFO decoder handler of the batcher.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ff_ths in reg FREE_FALL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  arg    Batcher.(ptr)
+  * @param  word   Decoded FIFO word.(ptr)
   *
   */
-int32_t ism330dhcx_ff_threshold_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_ff_ths_t *val)
+void ism330dhcx_batcher_word(void *arg, const ism330dhcx_fifo_word_t *word)
 {
-  ism330dhcx_free_fall_t free_fall;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
-                            (uint8_t *)&free_fall, 1);
+  ism330dhcx_batcher_t *bt = (ism330dhcx_batcher_t *)arg;
+  ism330dhcx_batch_ch_t ch;
+  int16_t val[3];
+  uint8_t i;
 
-  switch (free_fall.ff_ths)
+  if (bt->ts != NULL)
   {
-    case ISM330DHCX_FF_TSH_156mg:
-      *val = ISM330DHCX_FF_TSH_156mg;
-      break;
+    ism330dhcx_fifo_ts_word(bt->ts, word);
 
-    case ISM330DHCX_FF_TSH_219mg:
-      *val = ISM330DHCX_FF_TSH_219mg;
-      break;
+    if (bt->ts->gap == PROPERTY_ENABLE)
+    {
+      bt->ts->gap = PROPERTY_DISABLE;
 
-    case ISM330DHCX_FF_TSH_250mg:
-      *val = ISM330DHCX_FF_TSH_250mg;
-      break;
+      if (bt->gap != NULL)
+      {
+        bt->gap(bt->arg, bt->ts->lost, bt->ts->ns);
+      }
+    }
+  }
 
-    case ISM330DHCX_FF_TSH_312mg:
-      *val = ISM330DHCX_FF_TSH_312mg;
+  switch (word->tag)
+  {
+    case ISM330DHCX_CFG_CHANGE_TAG:
+      ism330dhcx_batcher_cfg_change(bt, word);
+      return;
+
+    case ISM330DHCX_TEMPERATURE_TAG:
+      ch = ISM330DHCX_BATCH_TEMP;
       break;
 
-    case ISM330DHCX_FF_TSH_344mg:
-      *val = ISM330DHCX_FF_TSH_344mg;
+    case ISM330DHCX_SENSORHUB_SLAVE0_TAG:
+      ch = ISM330DHCX_BATCH_SH0;
       break;
 
-    case ISM330DHCX_FF_TSH_406mg:
-      *val = ISM330DHCX_FF_TSH_406mg;
+    case ISM330DHCX_SENSORHUB_SLAVE1_TAG:
+      ch = ISM330DHCX_BATCH_SH1;
       break;
 
-    case ISM330DHCX_FF_TSH_469mg:
-      *val = ISM330DHCX_FF_TSH_469mg;
+    case ISM330DHCX_SENSORHUB_SLAVE2_TAG:
+      ch = ISM330DHCX_BATCH_SH2;
       break;
 
-    case ISM330DHCX_FF_TSH_500mg:
-      *val = ISM330DHCX_FF_TSH_500mg;
+    case ISM330DHCX_SENSORHUB_SLAVE3_TAG:
+      ch = ISM330DHCX_BATCH_SH3;
       break;
 
     default:
-      *val = ISM330DHCX_FF_TSH_156mg;
-      break;
+      /* accelerometer / gyroscope words, others ignored */
+      (void)ism330dhcx_fifo_decompress(&bt->decomp, word);
+      return;
   }
 
-  return ret;
+  for (i = 0; i < 3U; i++)
+  {
+    val[i] = (int16_t)word->data[(2U * i) + 1U];
+    val[i] = (val[i] * 256) + (int16_t)word->data[2U * i];
+  }
+
+  if (ch == ISM330DHCX_BATCH_TEMP)
+  {
+    val[1] = 0;
+    val[2] = 0;
+  }
+
+  ism330dhcx_batcher_add(bt, ch, word->cnt, val);
 }
 
 /**
-  * @brief  Free-fall duration event(1LSb = 1 / ODR).[set]
+  * @brief  Hand over the partially filled batches, e.g. at the end of a
+  *         FIFO drain.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ff_dur in reg FREE_FALL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  bt     Batcher.(ptr)
   *
   */
-int32_t ism330dhcx_ff_dur_set(const stmdev_ctx_t *ctx, uint8_t val)
+void ism330dhcx_batcher_flush(ism330dhcx_batcher_t *bt)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
-  ism330dhcx_free_fall_t free_fall;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
-
-  if (ret == 0)
-  {
-    wake_up_dur.ff_dur = (val & 0x20U) >> 5;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                               (uint8_t *)&wake_up_dur, 1);
-  }
+  ism330dhcx_batch_t *batch;
+  uint8_t i;
 
-  if (ret == 0)
+  for (i = 0; i < (uint8_t)ISM330DHCX_BATCH_CH; i++)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
-                              (uint8_t *)&free_fall, 1);
-  }
+    batch = bt->cur[i];
 
-  if (ret == 0)
-  {
-    free_fall.ff_dur = val & 0x1FU;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FREE_FALL,
-                               (uint8_t *)&free_fall, 1);
+    if (batch != NULL)
+    {
+      bt->cur[i] = NULL;
+      bt->ready(bt->arg, batch);
+    }
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Free-fall duration event(1LSb = 1 / ODR).[get]
+  * @brief  Set the settings in force, e.g. before starting the FIFO.
+  *         Later changes are taken from the CFG_CHANGE words of the
+  *         stream when fifo_virtual_sens_odr_chg_set is enabled.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of ff_dur in reg FREE_FALL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  bt     Batcher.(ptr)
+  * @param  val    Output settings, see fifo_cfg_get.(ptr)
   *
   */
-int32_t ism330dhcx_ff_dur_get(const stmdev_ctx_t *ctx, uint8_t *val)
+void ism330dhcx_batcher_cfg_set(ism330dhcx_batcher_t *bt,
+                                const ism330dhcx_fifo_cfg_t *val)
 {
-  ism330dhcx_wake_up_dur_t wake_up_dur;
-  ism330dhcx_free_fall_t free_fall;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_WAKE_UP_DUR,
-                            (uint8_t *)&wake_up_dur, 1);
+  ism330dhcx_batcher_flush(bt);
+  bt->cfg = *val;
 
-  if (ret == 0)
+  if (bt->ts != NULL)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FREE_FALL,
-                              (uint8_t *)&free_fall, 1);
+    ism330dhcx_fifo_ts_rate_set(bt->ts,
+                                ism330dhcx_fifo_cfg_slot_rate_get(val));
   }
-
-  *val = (wake_up_dur.ff_dur << 5) + free_fall.ff_dur;
-
-  return ret;
 }
 
 /**
-  * @}
+  * @brief  Set the routine receiving the lost samples estimates.
+  *
+  * @param  bt     Batcher.(ptr)
+  * @param  gap    Routine, called with the batcher argument.(ptr)
   *
   */
+void ism330dhcx_batcher_gap_set(ism330dhcx_batcher_t *bt,
+                                ism330dhcx_fifo_gap_ptr gap)
+{
+  bt->gap = gap;
+}
 
 /**
-  * @defgroup   ISM330DHCX_fifo
-  * @brief      This section group all the functions concerning
-  *             the fifo usage
-  * @{
+  * @brief  Record a FIFO overrun before decoding the words that follow
+  *         it (continuous mode: the oldest words were overwritten).
+  *         Batches in progress are handed over, the next batch of each
+  *         channel is marked with gap, the decompressor waits for new
+  *         reference samples and the timestamps resync on the next
+  *         TIMESTAMP word, without resetting the FIFO.
+  *
+  * @param  bt     Batcher.(ptr)
   *
   */
+void ism330dhcx_batcher_overrun(ism330dhcx_batcher_t *bt)
+{
+  ism330dhcx_batcher_flush(bt);
+  bt->gap_pending = (uint8_t)((1U << (uint8_t)ISM330DHCX_BATCH_CH) - 1U);
+  bt->decomp.valid[0] = PROPERTY_DISABLE;
+  bt->decomp.valid[1] = PROPERTY_DISABLE;
+  bt->overruns++;
+
+  if (bt->ts != NULL)
+  {
+    ism330dhcx_fifo_ts_resync(bt->ts);
+  }
+}
 
 /**
-  * @brief  FIFO watermark level selection.[set]
+  * @brief  One FIFO drain cycle: FIFO_STATUS1/2 read once, overrun
+  *         recorded, then the unread words read in bursts and decoded.
+  *         Decoder handlers run with the interface lock taken.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wtm in reg FIFO_CTRL1
+  * @param  dec    FIFO decoder.(ptr)
+  * @param  bt     Batcher fed by dec, or NULL.(ptr)
+  * @param  buff   Burst buffer of len FIFO words.(ptr)
+  * @param  len    Words per burst
+  * @param  val    FIFO level and flags read at the start of the cycle.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_watermark_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t ism330dhcx_fifo_drain(const stmdev_ctx_t *ctx,
+                              ism330dhcx_fifo_decoder_t *dec,
+                              ism330dhcx_batcher_t *bt,
+                              uint8_t *buff, uint16_t len,
+                              ism330dhcx_fifo_state_t *val)
 {
-  ism330dhcx_fifo_ctrl1_t fifo_ctrl1;
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  uint16_t left;
+  uint16_t num;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
-  ret += ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_fifo_state_get(ctx, val);
 
-  if (ret == 0)
+  if ((ret == 0) && (bt != NULL))
+  {
+    /* FIFO_OVR_IA clears on the first read after the overrun */
+    if ((val->ovr == PROPERTY_ENABLE) ||
+        (val->ovr_latched == PROPERTY_ENABLE))
+    {
+      ism330dhcx_batcher_overrun(bt);
+    }
+
+    if (val->counter_bdr == PROPERTY_ENABLE)
+    {
+      bt->counter_bdr++;
+    }
+  }
+
+  left = (ret == 0) ? val->level : 0U;
+
+  while ((left > 0U) && (len > 0U) && (ret == 0))
   {
-    fifo_ctrl1.wtm = (uint8_t)(val  & 0xFFU);
-    fifo_ctrl2.wtm = (uint8_t)(val / 256U) & 0x01U;
+    num = (left > len) ? len : left;
+    ret = ism330dhcx_fifo_out_multi_raw_get(ctx, buff, num);
 
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
-    ret += ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+    if (ret == 0)
+    {
+      (void)ism330dhcx_fifo_decode(dec, buff, num);
+    }
+
+    left -= num;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark level selection.[get]
+  * @brief  Convert a batch to engineering units with the full scale it
+  *         was recorded with: mg, mdps, degC (x only); sensor hub
+  *         channels are copied unscaled.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of wtm in reg FIFO_CTRL1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  batch  Batch.(ptr)
+  * @param  x      batch->len converted x values.(ptr)
+  * @param  y      batch->len converted y values, unused for TEMP.(ptr)
+  * @param  z      batch->len converted z values, unused for TEMP.(ptr)
   *
   */
-int32_t ism330dhcx_fifo_watermark_get(const stmdev_ctx_t *ctx,
-                                      uint16_t *val)
+void ism330dhcx_batch_to_unit(const ism330dhcx_batch_t *batch,
+                              float_t *x, float_t *y, float_t *z)
 {
-  ism330dhcx_fifo_ctrl1_t fifo_ctrl1;
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
-  int32_t ret;
+  float_t sens = 1.0f;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
-  ret += ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  switch (batch->ch)
+  {
+    case ISM330DHCX_BATCH_TEMP:
+      ism330dhcx_from_lsb_to_celsius_array(batch->x, x, batch->len);
+      return;
 
-  *val = fifo_ctrl2.wtm;
-  *val = (*val * 256U) +  fifo_ctrl1.wtm;;
+    case ISM330DHCX_BATCH_XL:
+      sens = ism330dhcx_xl_sensitivity_get(batch->cfg.xl_fs);
+      break;
 
-  return ret;
+    case ISM330DHCX_BATCH_GY:
+      sens = ism330dhcx_gy_sensitivity_get(batch->cfg.gy_fs);
+      break;
+
+    default:
+      sens = 1.0f;
+      break;
+  }
+
+  ism330dhcx_from_lsb_to_unit_array(batch->x, x, batch->len, sens);
+  ism330dhcx_from_lsb_to_unit_array(batch->y, y, batch->len, sens);
+  ism330dhcx_from_lsb_to_unit_array(batch->z, z, batch->len, sens);
 }
 
 /**
-  * @brief  FIFO compression feature initialization request.[set].
+  * @brief  Enable FIFO batching of pedometer embedded function values.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of FIFO_COMPR_INIT in reg EMB_FUNC_INIT_B
+  * @param  val    Change the values of gbias_fifo_en in
+  *                reg ISM330DHCX_EMB_FUNC_FIFO_CFG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_compression_algo_init_set(const stmdev_ctx_t *ctx,
-                                             uint8_t val)
+int32_t ism330dhcx_fifo_pedo_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  ism330dhcx_emb_func_fifo_cfg_t emb_func_fifo_cfg;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                              (uint8_t *)&emb_func_init_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG,
+                              (uint8_t *)&emb_func_fifo_cfg, 1);
   }
 
   if (ret == 0)
   {
-    emb_func_init_b.fifo_compr_init = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                               (uint8_t *)&emb_func_init_b, 1);
+    emb_func_fifo_cfg.pedo_fifo_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG,
+                               (uint8_t *)&emb_func_fifo_cfg, 1);
   }
 
   if (ret == 0)
@@ -6748,69 +10844,74 @@ int32_t ism330dhcx_compression_algo_init_set(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FIFO compression feature initialization request.[get].
+  * @brief  Enable FIFO batching of pedometer embedded function values.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    change the values of FIFO_COMPR_INIT in
-  *                reg EMB_FUNC_INIT_B
+  * @param  val    Change the values of pedo_fifo_en in reg
+  *                ISM330DHCX_EMB_FUNC_FIFO_CFG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_compression_algo_init_get(const stmdev_ctx_t *ctx,
-                                             uint8_t *val)
+int32_t ism330dhcx_fifo_pedo_batch_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
 {
-  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  ism330dhcx_emb_func_fifo_cfg_t emb_func_fifo_cfg;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                              (uint8_t *)&emb_func_init_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG,
+                              (uint8_t *)&emb_func_fifo_cfg, 1);
+    *val = emb_func_fifo_cfg.pedo_fifo_en;
   }
 
   if (ret == 0)
   {
-    *val = emb_func_init_b.fifo_compr_init;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable and configure compression algo.[set]
+  * @brief  Enable FIFO batching data of first slave.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of uncoptr_rate in reg FIFO_CTRL2
+  * @param  val    Change the values of  batch_ext_sens_0_en in reg SLV0_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_compression_algo_set(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_uncoptr_rate_t val)
+int32_t ism330dhcx_sh_batch_slave_0_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
 {
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
-  ism330dhcx_emb_func_en_b_t emb_func_en_b;
+  ism330dhcx_slv0_config_t slv0_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                              (uint8_t *)&emb_func_en_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                              (uint8_t *)&slv0_config, 1);
   }
 
   if (ret == 0)
   {
-    emb_func_en_b.fifo_compr_en = ((uint8_t)val & 0x04U) >> 2;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                               (uint8_t *)&emb_func_en_b, 1);
+    slv0_config. batch_ext_sens_0_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                               (uint8_t *)&slv0_config, 1);
   }
 
   if (ret == 0)
@@ -6818,423 +10919,358 @@ int32_t ism330dhcx_compression_algo_set(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                              (uint8_t *)&fifo_ctrl2, 1);
-  }
-
-  if (ret == 0)
-  {
-    fifo_ctrl2.fifo_compr_rt_en = ((uint8_t)val & 0x04U) >> 2;
-    fifo_ctrl2.uncoptr_rate = (uint8_t)val & 0x03U;
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                               (uint8_t *)&fifo_ctrl2, 1);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Enable and configure compression algo.[get]
+  * @brief  Enable FIFO batching data of first slave.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of uncoptr_rate in reg FIFO_CTRL2
+  * @param  val    Change the values of  batch_ext_sens_0_en in
+  *                reg SLV0_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_compression_algo_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_uncoptr_rate_t *val)
+int32_t ism330dhcx_sh_batch_slave_0_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
 {
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  ism330dhcx_slv0_config_t slv0_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
-  switch ((fifo_ctrl2.fifo_compr_rt_en << 2) +
-          fifo_ctrl2.uncoptr_rate)
+  if (ret == 0)
   {
-    case ISM330DHCX_CMP_DISABLE:
-      *val = ISM330DHCX_CMP_DISABLE;
-      break;
-
-    case ISM330DHCX_CMP_ALWAYS:
-      *val = ISM330DHCX_CMP_ALWAYS;
-      break;
-
-    case ISM330DHCX_CMP_8_TO_1:
-      *val = ISM330DHCX_CMP_8_TO_1;
-      break;
-
-    case ISM330DHCX_CMP_16_TO_1:
-      *val = ISM330DHCX_CMP_16_TO_1;
-      break;
-
-    case ISM330DHCX_CMP_32_TO_1:
-      *val = ISM330DHCX_CMP_32_TO_1;
-      break;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                              (uint8_t *)&slv0_config, 1);
+  }
 
-    default:
-      *val = ISM330DHCX_CMP_DISABLE;
-      break;
+  if (ret == 0)
+  {
+    *val = slv0_config. batch_ext_sens_0_en;
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[set]
+  * @brief  Enable FIFO batching data of second slave.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of odrchg_en in reg FIFO_CTRL2
+  * @param  val    Change the values of  batch_ext_sens_1_en in
+  *                reg SLV1_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_virtual_sens_odr_chg_set(const stmdev_ctx_t *ctx,
-                                                 uint8_t val)
+int32_t ism330dhcx_sh_batch_slave_1_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
 {
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  ism330dhcx_slv1_config_t slv1_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    fifo_ctrl2.odrchg_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                               (uint8_t *)&fifo_ctrl2, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV1_CONFIG,
+                              (uint8_t *)&slv1_config, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    slv1_config. batch_ext_sens_1_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_CONFIG,
+                               (uint8_t *)&slv1_config, 1);
+  }
 
-/**
-  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of odrchg_en in reg FIFO_CTRL2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_fifo_virtual_sens_odr_chg_get(const stmdev_ctx_t *ctx,
-                                                 uint8_t *val)
-{
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
-  int32_t ret;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
-  *val = fifo_ctrl2.odrchg_en;
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Enables/Disables compression algorithm runtime[set]
+  * @brief  Enable FIFO batching data of second slave.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fifo_compr_rt_en in reg FIFO_CTRL2
+  * @param  val    Change the values of  batch_ext_sens_1_en in
+  *                reg SLV1_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_compression_algo_real_time_set(const stmdev_ctx_t *ctx,
-                                                  uint8_t val)
+int32_t ism330dhcx_sh_batch_slave_1_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
 {
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  ism330dhcx_slv1_config_t slv1_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    fifo_ctrl2.fifo_compr_rt_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                               (uint8_t *)&fifo_ctrl2, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV1_CONFIG,
+                              (uint8_t *)&slv1_config, 1);
+    *val = slv1_config. batch_ext_sens_1_en;
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Enables/Disables compression algorithm runtime.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fifo_compr_rt_en in reg FIFO_CTRL2
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_compression_algo_real_time_get(const stmdev_ctx_t *ctx,
-                                                  uint8_t *val)
-{
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
-  int32_t ret;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
-  *val = fifo_ctrl2.fifo_compr_rt_en;
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Sensing chain FIFO stop values memorization at threshold
-  *         level.[set]
+  * @brief  Enable FIFO batching data of third slave.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of stop_on_wtm in reg FIFO_CTRL2
+  * @param  val    Change the values of  batch_ext_sens_2_en in
+  *                reg SLV2_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_stop_on_wtm_set(const stmdev_ctx_t *ctx,
+int32_t ism330dhcx_sh_batch_slave_2_set(const stmdev_ctx_t *ctx,
                                         uint8_t val)
 {
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  ism330dhcx_slv2_config_t slv2_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    fifo_ctrl2.stop_on_wtm = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                               (uint8_t *)&fifo_ctrl2, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV2_CONFIG,
+                              (uint8_t *)&slv2_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    slv2_config. batch_ext_sens_2_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_CONFIG,
+                               (uint8_t *)&slv2_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Sensing chain FIFO stop values memorization at threshold
-  *         level.[get]
+  * @brief  Enable FIFO batching data of third slave.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of stop_on_wtm in reg FIFO_CTRL2
+  * @param  val    Change the values of  batch_ext_sens_2_en in
+  *                reg SLV2_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_stop_on_wtm_get(const stmdev_ctx_t *ctx,
+int32_t ism330dhcx_sh_batch_slave_2_get(const stmdev_ctx_t *ctx,
                                         uint8_t *val)
 {
-  ism330dhcx_fifo_ctrl2_t fifo_ctrl2;
+  ism330dhcx_slv2_config_t slv2_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL2,
-                            (uint8_t *)&fifo_ctrl2, 1);
-  *val = fifo_ctrl2.stop_on_wtm;
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV2_CONFIG,
+                              (uint8_t *)&slv2_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = slv2_config. batch_ext_sens_2_en;
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
-  *         for accelerometer data.[set]
+  * @brief  Enable FIFO batching data of fourth slave.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of bdr_xl in reg FIFO_CTRL3
+  * @param  val    Change the values of  batch_ext_sens_3_en in
+  *                reg SLV3_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_xl_batch_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_bdr_xl_t val)
+int32_t ism330dhcx_sh_batch_slave_3_set(const stmdev_ctx_t *ctx,
+                                        uint8_t val)
 {
-  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
+  ism330dhcx_slv3_config_t slv3_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
-                            (uint8_t *)&fifo_ctrl3, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    fifo_ctrl3.bdr_xl = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL3,
-                               (uint8_t *)&fifo_ctrl3, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV3_CONFIG,
+                              (uint8_t *)&slv3_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    slv3_config. batch_ext_sens_3_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_CONFIG,
+                               (uint8_t *)&slv3_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
-  *         for accelerometer data.[get]
+  * @brief  Enable FIFO batching data of fourth slave.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of bdr_xl in reg FIFO_CTRL3
+  * @param  val    Change the values of  batch_ext_sens_3_en in
+  *                reg SLV3_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_xl_batch_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_bdr_xl_t *val)
+int32_t ism330dhcx_sh_batch_slave_3_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
 {
-  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
+  ism330dhcx_slv3_config_t slv3_config;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
-                            (uint8_t *)&fifo_ctrl3, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
-  switch (fifo_ctrl3.bdr_xl)
+  if (ret == 0)
   {
-    case ISM330DHCX_XL_NOT_BATCHED:
-      *val = ISM330DHCX_XL_NOT_BATCHED;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_12Hz5:
-      *val = ISM330DHCX_XL_BATCHED_AT_12Hz5;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_26Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_26Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_52Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_52Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_104Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_104Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_208Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_208Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_417Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_417Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_833Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_833Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_1667Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_1667Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_3333Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_3333Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_6667Hz:
-      *val = ISM330DHCX_XL_BATCHED_AT_6667Hz;
-      break;
-
-    case ISM330DHCX_XL_BATCHED_AT_6Hz5:
-      *val = ISM330DHCX_XL_BATCHED_AT_6Hz5;
-      break;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV3_CONFIG,
+                              (uint8_t *)&slv3_config, 1);
+    *val = slv3_config. batch_ext_sens_3_en;
+  }
 
-    default:
-      *val = ISM330DHCX_XL_NOT_BATCHED;
-      break;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
-  *         for gyroscope data.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_DEN_functionality
+  * @brief      This section groups all the functions concerning
+  *             DEN functionality.
+  * @{
+  *
+  */
+
+/**
+  * @brief  DEN functionality marking mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of bdr_gy in reg FIFO_CTRL3
+  * @param  val    Change the values of den_mode in reg CTRL6_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_gy_batch_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_bdr_gy_t val)
+int32_t ism330dhcx_den_mode_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_den_mode_t val)
 {
-  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
+  ism330dhcx_ctrl6_c_t ctrl6_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
-                            (uint8_t *)&fifo_ctrl3, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
+                            (uint8_t *)&ctrl6_c, 1);
 
   if (ret == 0)
   {
-    fifo_ctrl3.bdr_gy = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL3,
-                               (uint8_t *)&fifo_ctrl3, 1);
+    ctrl6_c.den_mode = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL6_C,
+                               (uint8_t *)&ctrl6_c, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
-  *         for gyroscope data.[get]
+  * @brief  DEN functionality marking mode.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of bdr_gy in reg FIFO_CTRL3
+  * @param  val    Get the values of den_mode in reg CTRL6_C
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_gy_batch_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_bdr_gy_t *val)
+int32_t ism330dhcx_den_mode_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_den_mode_t *val)
 {
-  ism330dhcx_fifo_ctrl3_t fifo_ctrl3;
+  ism330dhcx_ctrl6_c_t ctrl6_c;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL3,
-                            (uint8_t *)&fifo_ctrl3, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
+                            (uint8_t *)&ctrl6_c, 1);
 
-  switch (fifo_ctrl3.bdr_gy)
+  switch (ctrl6_c.den_mode)
   {
-    case ISM330DHCX_GY_NOT_BATCHED:
-      *val = ISM330DHCX_GY_NOT_BATCHED;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_12Hz5:
-      *val = ISM330DHCX_GY_BATCHED_AT_12Hz5;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_26Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_26Hz;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_52Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_52Hz;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_104Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_104Hz;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_208Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_208Hz;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_417Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_417Hz;
-      break;
-
-    case ISM330DHCX_GY_BATCHED_AT_833Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_833Hz;
+    case ISM330DHCX_DEN_DISABLE:
+      *val = ISM330DHCX_DEN_DISABLE;
       break;
 
-    case ISM330DHCX_GY_BATCHED_AT_1667Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_1667Hz;
+    case ISM330DHCX_LEVEL_FIFO:
+      *val = ISM330DHCX_LEVEL_FIFO;
       break;
 
-    case ISM330DHCX_GY_BATCHED_AT_3333Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_3333Hz;
+    case ISM330DHCX_LEVEL_LETCHED:
+      *val = ISM330DHCX_LEVEL_LETCHED;
       break;
 
-    case ISM330DHCX_GY_BATCHED_AT_6667Hz:
-      *val = ISM330DHCX_GY_BATCHED_AT_6667Hz;
+    case ISM330DHCX_LEVEL_TRIGGER:
+      *val = ISM330DHCX_LEVEL_TRIGGER;
       break;
 
-    case ISM330DHCX_GY_BATCHED_6Hz5:
-      *val = ISM330DHCX_GY_BATCHED_6Hz5;
+    case ISM330DHCX_EDGE_TRIGGER:
+      *val = ISM330DHCX_EDGE_TRIGGER;
       break;
 
     default:
-      *val = ISM330DHCX_GY_NOT_BATCHED;
+      *val = ISM330DHCX_DEN_DISABLE;
       break;
   }
 
@@ -7242,77 +11278,64 @@ int32_t ism330dhcx_fifo_gy_batch_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  FIFO mode selection.[set]
+  * @brief  DEN active level configuration.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fifo_mode in reg FIFO_CTRL4
+  * @param  val    Change the values of den_lh in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_mode_set(const stmdev_ctx_t *ctx,
-                                 ism330dhcx_fifo_mode_t val)
+int32_t ism330dhcx_den_polarity_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_den_lh_t val)
 {
-  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                            (uint8_t *)&fifo_ctrl4, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
 
   if (ret == 0)
   {
-    fifo_ctrl4.fifo_mode = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                               (uint8_t *)&fifo_ctrl4, 1);
+    ctrl9_xl.den_lh = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
+                               (uint8_t *)&ctrl9_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FIFO mode selection.[get]
+  * @brief  DEN active level configuration.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fifo_mode in reg FIFO_CTRL4
+  * @param  val    Get the values of den_lh in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_mode_get(const stmdev_ctx_t *ctx,
-                                 ism330dhcx_fifo_mode_t *val)
+int32_t ism330dhcx_den_polarity_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_den_lh_t *val)
 {
-  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                            (uint8_t *)&fifo_ctrl4, 1);
-
-  switch (fifo_ctrl4.fifo_mode)
-  {
-    case ISM330DHCX_BYPASS_MODE:
-      *val = ISM330DHCX_BYPASS_MODE;
-      break;
-
-    case ISM330DHCX_FIFO_MODE:
-      *val = ISM330DHCX_FIFO_MODE;
-      break;
-
-    case ISM330DHCX_STREAM_TO_FIFO_MODE:
-      *val = ISM330DHCX_STREAM_TO_FIFO_MODE;
-      break;
-
-    case ISM330DHCX_BYPASS_TO_STREAM_MODE:
-      *val = ISM330DHCX_BYPASS_TO_STREAM_MODE;
-      break;
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
 
-    case ISM330DHCX_STREAM_MODE:
-      *val = ISM330DHCX_STREAM_MODE;
+  switch (ctrl9_xl.den_lh)
+  {
+    case ISM330DHCX_DEN_ACT_LOW:
+      *val = ISM330DHCX_DEN_ACT_LOW;
       break;
 
-    case ISM330DHCX_BYPASS_TO_FIFO_MODE:
-      *val = ISM330DHCX_BYPASS_TO_FIFO_MODE;
+    case ISM330DHCX_DEN_ACT_HIGH:
+      *val = ISM330DHCX_DEN_ACT_HIGH;
       break;
 
     default:
-      *val = ISM330DHCX_BYPASS_MODE;
+      *val = ISM330DHCX_DEN_ACT_LOW;
       break;
   }
 
@@ -7320,71 +11343,68 @@ int32_t ism330dhcx_fifo_mode_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
-  *         for temperature data.[set]
+  * @brief  DEN configuration.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of odr_t_batch in reg FIFO_CTRL4
+  * @param  val    Change the values of den_xl_g in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_temp_batch_set(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_odr_t_batch_t val)
+int32_t ism330dhcx_den_enable_set(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_den_xl_g_t val)
 {
-  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                            (uint8_t *)&fifo_ctrl4, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
 
   if (ret == 0)
   {
-    fifo_ctrl4.odr_t_batch = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                               (uint8_t *)&fifo_ctrl4, 1);
+    ctrl9_xl.den_xl_g = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
+                               (uint8_t *)&ctrl9_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects Batching Data Rate (writing frequency in FIFO)
-  *         for temperature data.[get]
+  * @brief  DEN configuration.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of odr_t_batch in reg FIFO_CTRL4
+  * @param  val    Get the values of den_xl_g in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_temp_batch_get(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_odr_t_batch_t *val)
+int32_t ism330dhcx_den_enable_get(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_den_xl_g_t *val)
 {
-  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                            (uint8_t *)&fifo_ctrl4, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
 
-  switch (fifo_ctrl4.odr_t_batch)
+  switch (ctrl9_xl.den_xl_g)
   {
-    case ISM330DHCX_TEMP_NOT_BATCHED:
-      *val = ISM330DHCX_TEMP_NOT_BATCHED;
-      break;
-
-    case ISM330DHCX_TEMP_BATCHED_AT_52Hz:
-      *val = ISM330DHCX_TEMP_BATCHED_AT_52Hz;
+    case ISM330DHCX_STAMP_IN_GY_DATA:
+      *val = ISM330DHCX_STAMP_IN_GY_DATA;
       break;
 
-    case ISM330DHCX_TEMP_BATCHED_AT_12Hz5:
-      *val = ISM330DHCX_TEMP_BATCHED_AT_12Hz5;
+    case ISM330DHCX_STAMP_IN_XL_DATA:
+      *val = ISM330DHCX_STAMP_IN_XL_DATA;
       break;
 
-    case ISM330DHCX_TEMP_BATCHED_AT_1Hz6:
-      *val = ISM330DHCX_TEMP_BATCHED_AT_1Hz6;
+    case ISM330DHCX_STAMP_IN_GY_XL_DATA:
+      *val = ISM330DHCX_STAMP_IN_GY_XL_DATA;
       break;
 
     default:
-      *val = ISM330DHCX_TEMP_NOT_BATCHED;
+      *val = ISM330DHCX_STAMP_IN_GY_DATA;
       break;
   }
 
@@ -7392,519 +11412,480 @@ int32_t ism330dhcx_fifo_temp_batch_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  Selects decimation for timestamp batching in FIFO.
-  *         Writing rate will be the maximum rate between XL and
-  *         GYRO BDR divided by decimation decoder.[set]
+  * @brief  DEN value stored in LSB of X-axis.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of odr_ts_batch in reg FIFO_CTRL4
+  * @param  val    Change the values of den_z in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_timestamp_decimation_set(const stmdev_ctx_t *ctx,
-                                                 ism330dhcx_odr_ts_batch_t val)
+int32_t ism330dhcx_den_mark_axis_x_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                            (uint8_t *)&fifo_ctrl4, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
 
   if (ret == 0)
   {
-    fifo_ctrl4.odr_ts_batch = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                               (uint8_t *)&fifo_ctrl4, 1);
+    ctrl9_xl.den_z = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
+                               (uint8_t *)&ctrl9_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects decimation for timestamp batching in FIFO.
-  *         Writing rate will be the maximum rate between XL and
-  *         GYRO BDR divided by decimation decoder.[get]
+  * @brief  DEN value stored in LSB of X-axis.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of odr_ts_batch in reg
-  *                                 FIFO_CTRL4
+  * @param  val    Change the values of den_z in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_timestamp_decimation_get(const stmdev_ctx_t *ctx,
-                                                 ism330dhcx_odr_ts_batch_t *val)
+int32_t ism330dhcx_den_mark_axis_x_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
 {
-  ism330dhcx_fifo_ctrl4_t fifo_ctrl4;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_CTRL4,
-                            (uint8_t *)&fifo_ctrl4, 1);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
+  *val = ctrl9_xl.den_z;
 
-  switch (fifo_ctrl4.odr_ts_batch)
+  return ret;
+}
+
+/**
+  * @brief  DEN value stored in LSB of Y-axis.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of den_y in reg CTRL9_XL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_den_mark_axis_y_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
+
+  if (ret == 0)
   {
-    case ISM330DHCX_NO_DECIMATION:
-      *val = ISM330DHCX_NO_DECIMATION;
-      break;
+    ctrl9_xl.den_y = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
+                               (uint8_t *)&ctrl9_xl, 1);
+  }
 
-    case ISM330DHCX_DEC_1:
-      *val = ISM330DHCX_DEC_1;
-      break;
+  ism330dhcx_unlock(ctx);
 
-    case ISM330DHCX_DEC_8:
-      *val = ISM330DHCX_DEC_8;
-      break;
+  return ret;
+}
 
-    case ISM330DHCX_DEC_32:
-      *val = ISM330DHCX_DEC_32;
-      break;
+/**
+  * @brief  DEN value stored in LSB of Y-axis.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of den_y in reg CTRL9_XL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_den_mark_axis_y_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
+{
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  int32_t ret;
 
-    default:
-      *val = ISM330DHCX_NO_DECIMATION;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
+  *val = ctrl9_xl.den_y;
 
   return ret;
 }
 
 /**
-  * @brief  Selects the trigger for the internal counter of batching events
-  *         between XL and gyro.[set]
+  * @brief  DEN value stored in LSB of Z-axis.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of trig_counter_bdr in
-  *                reg COUNTER_BDR_REG1
+  * @param  val    Change the values of den_x in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_cnt_event_batch_set(const stmdev_ctx_t *ctx,
-                                            ism330dhcx_trig_counter_bdr_t val)
+int32_t ism330dhcx_den_mark_axis_z_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
 
   if (ret == 0)
   {
-    counter_bdr_reg1.trig_counter_bdr = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                               (uint8_t *)&counter_bdr_reg1, 1);
+    ctrl9_xl.den_z = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
+                               (uint8_t *)&ctrl9_xl, 1);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Selects the trigger for the internal counter of batching events
-  *          between XL and gyro.[get]
+  * @brief  DEN value stored in LSB of Z-axis.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of trig_counter_bdr
-  *                in reg COUNTER_BDR_REG1
+  * @param  val    Change the values of den_x in reg CTRL9_XL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_cnt_event_batch_get(const stmdev_ctx_t *ctx,
-                                            ism330dhcx_trig_counter_bdr_t *val)
+int32_t ism330dhcx_den_mark_axis_z_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
 {
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
+  ism330dhcx_ctrl9_xl_t ctrl9_xl;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
-
-  switch (counter_bdr_reg1.trig_counter_bdr)
-  {
-    case ISM330DHCX_XL_BATCH_EVENT:
-      *val = ISM330DHCX_XL_BATCH_EVENT;
-      break;
-
-    case ISM330DHCX_GYRO_BATCH_EVENT:
-      *val = ISM330DHCX_GYRO_BATCH_EVENT;
-      break;
-
-    default:
-      *val = ISM330DHCX_XL_BATCH_EVENT;
-      break;
-  }
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
+                            (uint8_t *)&ctrl9_xl, 1);
+  *val = ctrl9_xl.den_z;
 
   return ret;
 }
 
 /**
-  * @brief  Resets the internal counter of batching events for a single sensor.
-  *         This bit is automatically reset to zero if it was set to '1'.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_Pedometer
+  * @brief      This section groups all the functions that manage pedometer.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enable pedometer algorithm.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of rst_counter_bdr in reg COUNTER_BDR_REG1
+  * @param  val    Change the values of pedo_en in reg EMB_FUNC_EN_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_rst_batch_counter_set(const stmdev_ctx_t *ctx,
-                                         uint8_t val)
+int32_t ism330dhcx_pedo_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
+  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                              (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_en_a.pedo_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                               (uint8_t *)&emb_func_en_a, 1);
+  }
 
   if (ret == 0)
   {
-    counter_bdr_reg1.rst_counter_bdr = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                               (uint8_t *)&counter_bdr_reg1, 1);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Resets the internal counter of batching events for a single sensor.
-  *         This bit is automatically reset to zero if it was set to '1'.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of rst_counter_bdr in reg COUNTER_BDR_REG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_rst_batch_counter_get(const stmdev_ctx_t *ctx,
-                                         uint8_t *val)
-{
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
-  *val = counter_bdr_reg1.rst_counter_bdr;
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Batch data rate counter.[set]
+  * @brief  Enable pedometer algorithm.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of cnt_bdr_th in reg COUNTER_BDR_REG2
-  *                and COUNTER_BDR_REG1.
+  * @param  val    Change the values of pedo_en in reg EMB_FUNC_EN_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_batch_counter_threshold_set(const stmdev_ctx_t *ctx,
-                                               uint16_t val)
+int32_t ism330dhcx_pedo_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_counter_bdr_reg2_t counter_bdr_reg1;
-  ism330dhcx_counter_bdr_reg2_t counter_bdr_reg2;
+  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    counter_bdr_reg1.cnt_bdr_th = (uint8_t)((val / 256U) & 0x07U);
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                               (uint8_t *)&counter_bdr_reg1, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                              (uint8_t *)&emb_func_en_a, 1);
+    *val = emb_func_en_a.pedo_en;
   }
 
   if (ret == 0)
   {
-    counter_bdr_reg2.cnt_bdr_th = (uint8_t)(val -
-                                            (counter_bdr_reg1.cnt_bdr_th * 256U));
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_COUNTER_BDR_REG2,
-                               (uint8_t *)&counter_bdr_reg2, 1);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Batch data rate counter.[get]
+  * @brief  Interrupt status bit for step detection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of cnt_bdr_th in reg COUNTER_BDR_REG2
-  *                and COUNTER_BDR_REG1.
+  * @param  val    Change the values of is_step_det in reg EMB_FUNC_STATUS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_batch_counter_threshold_get(const stmdev_ctx_t *ctx,
-                                               uint16_t *val)
+int32_t ism330dhcx_pedo_step_detect_get(const stmdev_ctx_t *ctx,
+                                        uint8_t *val)
 {
-  ism330dhcx_counter_bdr_reg1_t counter_bdr_reg1;
-  ism330dhcx_counter_bdr_reg2_t counter_bdr_reg2;
+  ism330dhcx_emb_func_status_t emb_func_status;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG1,
-                            (uint8_t *)&counter_bdr_reg1, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_COUNTER_BDR_REG2,
-                              (uint8_t *)&counter_bdr_reg2, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
+                              (uint8_t *)&emb_func_status, 1);
+    *val = emb_func_status.is_step_det;
   }
 
-  *val = counter_bdr_reg1.cnt_bdr_th;
-  *val = (*val * 256U) +  counter_bdr_reg2.cnt_bdr_th;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Number of unread sensor data (TAG + 6 bytes) stored in FIFO.[get]
+  * @brief  Pedometer debounce configuration register (r/w).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read the value of diff_fifo in reg FIFO_STATUS1 and FIFO_STATUS2
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_data_level_get(const stmdev_ctx_t *ctx,
-                                       uint16_t *val)
+int32_t ism330dhcx_pedo_debounce_steps_set(const stmdev_ctx_t *ctx,
+                                           uint8_t *buff)
 {
-  uint8_t reg[2];
-  ism330dhcx_fifo_status1_t *fifo_status1 = (ism330dhcx_fifo_status1_t *)&reg[0];
-  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
-  if (ret == 0)
-  {
-    *val = fifo_status2->diff_fifo;
-    *val = (*val * 256U) + fifo_status1->diff_fifo;
-  }
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_DEB_STEPS_CONF,
+                                    buff);
 
   return ret;
 }
 
 /**
-  * @brief  Smart FIFO status.[get]
+  * @brief  Pedometer debounce configuration register (r/w).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read registers FIFO_STATUS2
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_status_get(const stmdev_ctx_t *ctx,
-                                   ism330dhcx_fifo_status2_t *val)
+int32_t ism330dhcx_pedo_debounce_steps_get(const stmdev_ctx_t *ctx,
+                                           uint8_t *buff)
 {
-  uint8_t reg[2];
-  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
   int32_t ret;
 
-  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
-  if (ret == 0)
-  {
-    *val = *fifo_status2;
-  }
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_DEB_STEPS_CONF,
+                                   buff);
 
   return ret;
 }
 
 /**
-  * @brief  Smart FIFO full status.[get]
+  * @brief  Time period register for step detection on delta time (r/w).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read the values of fifo_full_ia in reg FIFO_STATUS2
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_full_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_pedo_steps_period_set(const stmdev_ctx_t *ctx,
+                                         uint16_t val)
 {
-  uint8_t reg[2];
-  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
+  uint8_t buff[2];
   int32_t ret;
 
-  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
+  ism330dhcx_lock(ctx);
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_L,
+                                    &buff[0]);
+
   if (ret == 0)
   {
-    *val = fifo_status2->fifo_full_ia;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_H,
+                                      &buff[1]);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FIFO overrun status.[get]
+  * @brief  Time period register for step detection on delta time (r/w).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read the values of  fifo_over_run_latched in
-  *                reg FIFO_STATUS2
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_ovr_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_pedo_steps_period_get(const stmdev_ctx_t *ctx,
+                                         uint16_t *val)
 {
-  uint8_t reg[2];
-  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
+  uint8_t buff[2];
   int32_t ret;
 
-  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_L,
+                                   &buff[0]);
+
   if (ret == 0)
   {
-    *val = fifo_status2->fifo_ovr_ia;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_H,
+                                     &buff[1]);
+    *val = buff[1];
+    *val = (*val * 256U) +  buff[0];
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark status.[get]
+  * @brief  Set when user wants to generate interrupt on count overflow
+  *         event/every step.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Read the values of fifo_wtm_ia in reg FIFO_STATUS2
+  * @param  val    Change the values of carry_count_en in reg PEDO_CMD_REG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_wtm_flag_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_pedo_int_mode_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_carry_count_en_t val)
 {
-  uint8_t reg[2];
-  ism330dhcx_fifo_status2_t *fifo_status2 = (ism330dhcx_fifo_status2_t *)&reg[1];
+  ism330dhcx_pedo_cmd_reg_t pedo_cmd_reg;
   int32_t ret;
 
-  /* read both FIFO_STATUS1 + FIFO_STATUS2 regs */
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_STATUS1, (uint8_t *)reg, 2);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_CMD_REG,
+                                   (uint8_t *)&pedo_cmd_reg);
+
   if (ret == 0)
   {
-    *val = fifo_status2->fifo_wtm_ia;
+    pedo_cmd_reg.carry_count_en = (uint8_t)val;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_CMD_REG,
+                                      (uint8_t *)&pedo_cmd_reg);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Identifies the sensor in FIFO_DATA_OUT.[get]
+  * @brief  Set when user wants to generate interrupt on count overflow
+  *         event/every step.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tag_sensor in reg FIFO_DATA_OUT_TAG
+  * @param  val    Get the values of carry_count_en in reg PEDO_CMD_REG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_sensor_tag_get(const stmdev_ctx_t *ctx,
-                                       ism330dhcx_fifo_tag_t *val)
+int32_t ism330dhcx_pedo_int_mode_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_carry_count_en_t *val)
 {
-  ism330dhcx_fifo_data_out_tag_t fifo_data_out_tag;
+  ism330dhcx_pedo_cmd_reg_t pedo_cmd_reg;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FIFO_DATA_OUT_TAG,
-                            (uint8_t *)&fifo_data_out_tag, 1);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_CMD_REG,
+                                   (uint8_t *)&pedo_cmd_reg);
 
-  switch (fifo_data_out_tag.tag_sensor)
+  switch (pedo_cmd_reg.carry_count_en)
   {
-    case ISM330DHCX_GYRO_NC_TAG:
-      *val = ISM330DHCX_GYRO_NC_TAG;
-      break;
-
-    case ISM330DHCX_XL_NC_TAG:
-      *val = ISM330DHCX_XL_NC_TAG;
-      break;
-
-    case ISM330DHCX_TEMPERATURE_TAG:
-      *val = ISM330DHCX_TEMPERATURE_TAG;
-      break;
-
-    case ISM330DHCX_TIMESTAMP_TAG:
-      *val = ISM330DHCX_TIMESTAMP_TAG;
-      break;
-
-    case ISM330DHCX_CFG_CHANGE_TAG:
-      *val = ISM330DHCX_CFG_CHANGE_TAG;
-      break;
-
-    case ISM330DHCX_XL_NC_T_2_TAG:
-      *val = ISM330DHCX_XL_NC_T_2_TAG;
-      break;
-
-    case ISM330DHCX_XL_NC_T_1_TAG:
-      *val = ISM330DHCX_XL_NC_T_1_TAG;
-      break;
-
-    case ISM330DHCX_XL_2XC_TAG:
-      *val = ISM330DHCX_XL_2XC_TAG;
-      break;
-
-    case ISM330DHCX_XL_3XC_TAG:
-      *val = ISM330DHCX_XL_3XC_TAG;
-      break;
-
-    case ISM330DHCX_GYRO_NC_T_2_TAG:
-      *val = ISM330DHCX_GYRO_NC_T_2_TAG;
-      break;
-
-    case ISM330DHCX_GYRO_NC_T_1_TAG:
-      *val = ISM330DHCX_GYRO_NC_T_1_TAG;
-      break;
-
-    case ISM330DHCX_GYRO_2XC_TAG:
-      *val = ISM330DHCX_GYRO_2XC_TAG;
-      break;
-
-    case ISM330DHCX_GYRO_3XC_TAG:
-      *val = ISM330DHCX_GYRO_3XC_TAG;
-      break;
-
-    case ISM330DHCX_SENSORHUB_SLAVE0_TAG:
-      *val = ISM330DHCX_SENSORHUB_SLAVE0_TAG;
-      break;
-
-    case ISM330DHCX_SENSORHUB_SLAVE1_TAG:
-      *val = ISM330DHCX_SENSORHUB_SLAVE1_TAG;
-      break;
-
-    case ISM330DHCX_SENSORHUB_SLAVE2_TAG:
-      *val = ISM330DHCX_SENSORHUB_SLAVE2_TAG;
-      break;
-
-    case ISM330DHCX_SENSORHUB_SLAVE3_TAG:
-      *val = ISM330DHCX_SENSORHUB_SLAVE3_TAG;
-      break;
-
-    case ISM330DHCX_STEP_CPUNTER_TAG:
-      *val = ISM330DHCX_STEP_CPUNTER_TAG;
+    case ISM330DHCX_EVERY_STEP:
+      *val = ISM330DHCX_EVERY_STEP;
       break;
 
-    case ISM330DHCX_SENSORHUB_NACK_TAG:
-      *val = ISM330DHCX_SENSORHUB_NACK_TAG;
+    case ISM330DHCX_COUNT_OVERFLOW:
+      *val = ISM330DHCX_COUNT_OVERFLOW;
       break;
 
     default:
-      *val = ISM330DHCX_SENSORHUB_NACK_TAG;
+      *val = ISM330DHCX_EVERY_STEP;
       break;
   }
 
-  return ret;
-}
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_significant_motion
+  * @brief      This section groups all the functions that manage the
+  *             significant motion detection.
+  * @{
+  *
+  */
 
 /**
-  * @brief  Enable FIFO batching of pedometer embedded function values.[set]
+  * @brief  Enable significant motion detection function.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of gbias_fifo_en in
-  *                reg ISM330DHCX_EMB_FUNC_FIFO_CFG
+  * @param  val    Change the values of sign_motion_en in reg EMB_FUNC_EN_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_pedo_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_motion_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_emb_func_fifo_cfg_t emb_func_fifo_cfg;
+  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG,
-                              (uint8_t *)&emb_func_fifo_cfg, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                              (uint8_t *)&emb_func_en_a, 1);
   }
 
   if (ret == 0)
   {
-    emb_func_fifo_cfg.pedo_fifo_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG,
-                               (uint8_t *)&emb_func_fifo_cfg, 1);
+    emb_func_en_a.sign_motion_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                               (uint8_t *)&emb_func_en_a, 1);
   }
 
   if (ret == 0)
@@ -7912,529 +11893,705 @@ int32_t ism330dhcx_fifo_pedo_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching of pedometer embedded function values.[get]
+  * @brief  Enable significant motion detection function.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pedo_fifo_en in reg
-  *                ISM330DHCX_EMB_FUNC_FIFO_CFG
+  * @param  val    Change the values of sign_motion_en in reg EMB_FUNC_EN_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fifo_pedo_batch_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
+int32_t ism330dhcx_motion_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_emb_func_fifo_cfg_t emb_func_fifo_cfg;
+  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_FIFO_CFG,
-                              (uint8_t *)&emb_func_fifo_cfg, 1);
-    *val = emb_func_fifo_cfg.pedo_fifo_en;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                              (uint8_t *)&emb_func_en_a, 1);
   }
 
   if (ret == 0)
   {
+    *val = emb_func_en_a.sign_motion_en;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of first slave.[set]
+  * @brief  Interrupt status bit for significant motion detection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_0_en in reg SLV0_CONFIG
+  * @param  val    Change the values of is_sigmot in reg EMB_FUNC_STATUS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_0_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
+int32_t ism330dhcx_motion_flag_data_ready_get(const stmdev_ctx_t *ctx,
+                                              uint8_t *val)
 {
-  ism330dhcx_slv0_config_t slv0_config;
+  ism330dhcx_emb_func_status_t emb_func_status;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                              (uint8_t *)&slv0_config, 1);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    slv0_config. batch_ext_sens_0_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                               (uint8_t *)&slv0_config, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
+                              (uint8_t *)&emb_func_status, 1);
   }
 
   if (ret == 0)
   {
+    *val = emb_func_status.is_sigmot;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of first slave.[get]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_tilt_detection
+  * @brief      This section groups all the functions that manage the tilt
+  *             event detection.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enable tilt calculation.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_0_en in
-  *                reg SLV0_CONFIG
+  * @param  val    Change the values of tilt_en in reg EMB_FUNC_EN_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_0_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
+int32_t ism330dhcx_tilt_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_slv0_config_t slv0_config;
+  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                              (uint8_t *)&slv0_config, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                              (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_en_a.tilt_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                               (uint8_t *)&emb_func_en_a, 1);
   }
 
   if (ret == 0)
   {
-    *val = slv0_config. batch_ext_sens_0_en;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of second slave.[set]
+  * @brief  Enable tilt calculation.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_1_en in
-  *                reg SLV1_CONFIG
+  * @param  val    Change the values of tilt_en in reg EMB_FUNC_EN_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_1_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
+int32_t ism330dhcx_tilt_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_slv1_config_t slv1_config;
+  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV1_CONFIG,
-                              (uint8_t *)&slv1_config, 1);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    slv1_config. batch_ext_sens_1_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_CONFIG,
-                               (uint8_t *)&slv1_config, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
+                              (uint8_t *)&emb_func_en_a, 1);
   }
 
   if (ret == 0)
   {
+    *val = emb_func_en_a.tilt_en;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of second slave.[get]
+  * @brief  Interrupt status bit for tilt detection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_1_en in
-  *                reg SLV1_CONFIG
+  * @param  val    Change the values of is_tilt in reg EMB_FUNC_STATUS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_1_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
+int32_t ism330dhcx_tilt_flag_data_ready_get(const stmdev_ctx_t *ctx,
+                                            uint8_t *val)
 {
-  ism330dhcx_slv1_config_t slv1_config;
+  ism330dhcx_emb_func_status_t emb_func_status;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV1_CONFIG,
-                              (uint8_t *)&slv1_config, 1);
-    *val = slv1_config. batch_ext_sens_1_en;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
+                              (uint8_t *)&emb_func_status, 1);
   }
 
   if (ret == 0)
   {
+    *val = emb_func_status.is_tilt;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of third slave.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_ magnetometer_sensor
+  * @brief      This section groups all the functions that manage additional
+  *             magnetometer sensor.
+  * @{
+  *
+  */
+
+/**
+  * @brief  External magnetometer sensitivity value register.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_2_en in
-  *                reg SLV2_CONFIG
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_2_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
+int32_t ism330dhcx_mag_sensitivity_set(const stmdev_ctx_t *ctx,
+                                       uint16_t val)
 {
-  ism330dhcx_slv2_config_t slv2_config;
+  uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_lock(ctx);
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_L,
+                                    &buff[0]);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV2_CONFIG,
-                              (uint8_t *)&slv2_config, 1);
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_H,
+                                      &buff[1]);
   }
 
-  if (ret == 0)
-  {
-    slv2_config. batch_ext_sens_2_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_CONFIG,
-                               (uint8_t *)&slv2_config, 1);
-  }
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  External magnetometer sensitivity value register.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  buff   Buffer that stores data read
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_mag_sensitivity_get(const stmdev_ctx_t *ctx,
+                                       uint16_t *val)
+{
+  uint8_t buff[2];
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_L,
+                                   &buff[0]);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_H,
+                                     &buff[1]);
+    *val = buff[1];
+    *val = (*val * 256U) + buff[0];
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of third slave.[get]
+  * @brief  Offset for hard-iron compensation register (r/w).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_2_en in
-  *                reg SLV2_CONFIG
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_2_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
+int32_t ism330dhcx_mag_offset_set(const stmdev_ctx_t *ctx, int16_t *val)
 {
-  ism330dhcx_slv2_config_t slv2_config;
+  uint8_t buff[6];
   int32_t ret;
+  uint8_t i;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_lock(ctx);
+  buff[1] = (uint8_t)((uint16_t)val[0] / 256U);
+  buff[0] = (uint8_t)((uint16_t)val[0] - (buff[1] * 256U));
+  buff[3] = (uint8_t)((uint16_t)val[1] / 256U);
+  buff[2] = (uint8_t)((uint16_t)val[1] - (buff[3] * 256U));
+  buff[5] = (uint8_t)((uint16_t)val[2] / 256U);
+  buff[4] = (uint8_t)((uint16_t)val[2] - (buff[5] * 256U));
+  i = 0x00U;
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFX_L, &buff[i]);
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFX_H, &buff[i]);
+  }
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFY_L, &buff[i]);
+  }
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFY_H, &buff[i]);
+  }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV2_CONFIG,
-                              (uint8_t *)&slv2_config, 1);
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFZ_L, &buff[i]);
   }
 
   if (ret == 0)
   {
-    *val = slv2_config. batch_ext_sens_2_en;
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFZ_H, &buff[i]);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable FIFO batching data of fourth slave.[set]
+  * @brief  Offset for hard-iron compensation register (r/w).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_3_en in
-  *                reg SLV3_CONFIG
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_batch_slave_3_set(const stmdev_ctx_t *ctx,
-                                        uint8_t val)
+int32_t ism330dhcx_mag_offset_get(const stmdev_ctx_t *ctx, int16_t *val)
 {
-  ism330dhcx_slv3_config_t slv3_config;
+  uint8_t buff[6];
   int32_t ret;
+  uint8_t i;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_lock(ctx);
+  i = 0x00U;
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFX_L, &buff[i]);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV3_CONFIG,
-                              (uint8_t *)&slv3_config, 1);
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFX_H, &buff[i]);
   }
 
   if (ret == 0)
   {
-    slv3_config. batch_ext_sens_3_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_CONFIG,
-                               (uint8_t *)&slv3_config, 1);
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFY_L, &buff[i]);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFY_H, &buff[i]);
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Enable FIFO batching data of fourth slave.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of  batch_ext_sens_3_en in
-  *                reg SLV3_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_sh_batch_slave_3_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
-{
-  ism330dhcx_slv3_config_t slv3_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV3_CONFIG,
-                              (uint8_t *)&slv3_config, 1);
-    *val = slv3_config. batch_ext_sens_3_en;
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFZ_L, &buff[i]);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFZ_H, &buff[i]);
+
+    val[0] = (int16_t)buff[1];
+    val[0] = (val[0] * 256) + (int16_t)buff[0];
+    val[1] = (int16_t)buff[3];
+    val[1] = (val[1] * 256) + (int16_t)buff[2];
+    val[2] = (int16_t)buff[5];
+    val[2] = (val[2] * 256) + (int16_t)buff[4];
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_DEN_functionality
-  * @brief      This section groups all the functions concerning
-  *             DEN functionality.
-  * @{
-  *
-  */
-
-/**
-  * @brief  DEN functionality marking mode.[set]
+  * @brief  Soft-iron (3x3 symmetric) matrix correction register (r/w).
+  *         The value is expressed as half-precision floating-point format:
+  *         SEEEEEFFFFFFFFFF
+  *         S: 1 sign bit;
+  *         E: 5 exponent bits;
+  *         F: 10 fraction bits).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_mode in reg CTRL6_C
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_mode_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_den_mode_t val)
+int32_t ism330dhcx_mag_soft_iron_set(const stmdev_ctx_t *ctx, uint16_t *val)
 {
-  ism330dhcx_ctrl6_c_t ctrl6_c;
+  uint8_t buff[12];
   int32_t ret;
+  uint8_t i;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
-                            (uint8_t *)&ctrl6_c, 1);
+  ism330dhcx_lock(ctx);
+  buff[1] = (uint8_t)(val[0] / 256U);
+  buff[0] = (uint8_t)(val[0] - (buff[1] * 256U));
+  buff[3] = (uint8_t)(val[1] / 256U);
+  buff[2] = (uint8_t)(val[1] - (buff[3] * 256U));
+  buff[5] = (uint8_t)(val[2] / 256U);
+  buff[4] = (uint8_t)(val[2] - (buff[5] * 256U));
+  buff[7] = (uint8_t)(val[3] / 256U);
+  buff[6] = (uint8_t)(val[3] - (buff[1] * 256U));
+  buff[9] = (uint8_t)(val[4] / 256U);
+  buff[8] = (uint8_t)(val[4] - (buff[3] * 256U));
+  buff[11] = (uint8_t)(val[5] / 256U);
+  buff[10] = (uint8_t)(val[5] - (buff[5] * 256U));
+  i = 0x00U;
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XX_L,
+                                    &buff[i]);
 
   if (ret == 0)
   {
-    ctrl6_c.den_mode = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL6_C,
-                               (uint8_t *)&ctrl6_c, 1);
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XX_H,
+                                      &buff[i]);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XY_L,
+                                      &buff[i]);
+  }
 
-/**
-  * @brief  DEN functionality marking mode.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of den_mode in reg CTRL6_C
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_den_mode_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_den_mode_t *val)
-{
-  ism330dhcx_ctrl6_c_t ctrl6_c;
-  int32_t ret;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XY_H,
+                                      &buff[i]);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL6_C,
-                            (uint8_t *)&ctrl6_c, 1);
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XZ_L,
+                                      &buff[i]);
+  }
 
-  switch (ctrl6_c.den_mode)
+  if (ret == 0)
   {
-    case ISM330DHCX_DEN_DISABLE:
-      *val = ISM330DHCX_DEN_DISABLE;
-      break;
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XZ_H,
+                                      &buff[i]);
+  }
 
-    case ISM330DHCX_LEVEL_FIFO:
-      *val = ISM330DHCX_LEVEL_FIFO;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YY_L,
+                                      &buff[i]);
+  }
 
-    case ISM330DHCX_LEVEL_LETCHED:
-      *val = ISM330DHCX_LEVEL_LETCHED;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YY_H,
+                                      &buff[i]);
+  }
 
-    case ISM330DHCX_LEVEL_TRIGGER:
-      *val = ISM330DHCX_LEVEL_TRIGGER;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YZ_L,
+                                      &buff[i]);
+  }
 
-    case ISM330DHCX_EDGE_TRIGGER:
-      *val = ISM330DHCX_EDGE_TRIGGER;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YZ_H,
+                                      &buff[i]);
+  }
 
-    default:
-      *val = ISM330DHCX_DEN_DISABLE;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_ZZ_L,
+                                      &buff[i]);
+  }
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_ZZ_H,
+                                      &buff[i]);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  DEN active level configuration.[set]
+  * @brief  Soft-iron (3x3 symmetric) matrix correction register (r/w).
+  *         The value is expressed as half-precision floating-point format:
+  *         SEEEEEFFFFFFFFFF
+  *         S: 1 sign bit;
+  *         E: 5 exponent bits;
+  *         F: 10 fraction bits).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_lh in reg CTRL9_XL
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_polarity_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_den_lh_t val)
+int32_t ism330dhcx_mag_soft_iron_get(const stmdev_ctx_t *ctx, uint16_t *val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  uint8_t buff[12];
   int32_t ret;
+  uint8_t i;
+
+  ism330dhcx_lock(ctx);
+  i = 0x00U;
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XX_L,
+                                   &buff[i]);
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XX_H,
+                                     &buff[i]);
+  }
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XY_L,
+                                     &buff[i]);
+  }
+
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XY_H,
+                                     &buff[i]);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XZ_L,
+                                     &buff[i]);
+  }
 
   if (ret == 0)
   {
-    ctrl9_xl.den_lh = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
-                               (uint8_t *)&ctrl9_xl, 1);
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XZ_H,
+                                     &buff[i]);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YY_L,
+                                     &buff[i]);
+  }
 
-/**
-  * @brief  DEN active level configuration.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of den_lh in reg CTRL9_XL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_den_polarity_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_den_lh_t *val)
-{
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
-  int32_t ret;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YY_H,
+                                     &buff[i]);
+  }
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YZ_L,
+                                     &buff[i]);
+  }
 
-  switch (ctrl9_xl.den_lh)
+  if (ret == 0)
   {
-    case ISM330DHCX_DEN_ACT_LOW:
-      *val = ISM330DHCX_DEN_ACT_LOW;
-      break;
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YZ_H,
+                                     &buff[i]);
+  }
 
-    case ISM330DHCX_DEN_ACT_HIGH:
-      *val = ISM330DHCX_DEN_ACT_HIGH;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_ZZ_L,
+                                     &buff[i]);
+  }
 
-    default:
-      *val = ISM330DHCX_DEN_ACT_LOW;
-      break;
+  if (ret == 0)
+  {
+    i++;
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_ZZ_H,
+                                     &buff[i]);
   }
 
+  val[0] = buff[1];
+  val[0] = (val[0] * 256U) +  buff[0];
+  val[1] = buff[3];
+  val[1] = (val[1] * 256U) +  buff[2];
+  val[2] = buff[5];
+  val[2] = (val[2] * 256U) +  buff[4];
+  val[3] = buff[7];
+  val[3] = (val[3] * 256U) +  buff[6];
+  val[4] = buff[9];
+  val[4] = (val[4] * 256U) +  buff[8];
+  val[5] = buff[11];
+  val[6] = (val[5] * 256U) +  buff[10];
+
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  DEN configuration.[set]
+  * @brief  Magnetometer Z-axis coordinates rotation (to be aligned to
+  *         accelerometer/gyroscope axes orientation).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_xl_g in reg CTRL9_XL
+  * @param  val    Change the values of mag_z_axis in reg MAG_CFG_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_enable_set(const stmdev_ctx_t *ctx,
-                                  ism330dhcx_den_xl_g_t val)
+int32_t ism330dhcx_mag_z_orient_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_mag_z_axis_t val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  ism330dhcx_mag_cfg_a_t mag_cfg_a;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
+                                   (uint8_t *)&mag_cfg_a);
 
   if (ret == 0)
   {
-    ctrl9_xl.den_xl_g = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
-                               (uint8_t *)&ctrl9_xl, 1);
+    mag_cfg_a.mag_z_axis = (uint8_t)val;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_CFG_A,
+                                      (uint8_t *)&mag_cfg_a);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  DEN configuration.[get]
+  * @brief  Magnetometer Z-axis coordinates rotation (to be aligned to
+  *         accelerometer/gyroscope axes orientation).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of den_xl_g in reg CTRL9_XL
+  * @param  val    Get the values of mag_z_axis in reg MAG_CFG_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_enable_get(const stmdev_ctx_t *ctx,
-                                  ism330dhcx_den_xl_g_t *val)
+int32_t ism330dhcx_mag_z_orient_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_mag_z_axis_t *val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  ism330dhcx_mag_cfg_a_t mag_cfg_a;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
+                                   (uint8_t *)&mag_cfg_a);
 
-  switch (ctrl9_xl.den_xl_g)
+  switch (mag_cfg_a.mag_z_axis)
   {
-    case ISM330DHCX_STAMP_IN_GY_DATA:
-      *val = ISM330DHCX_STAMP_IN_GY_DATA;
+    case ISM330DHCX_Z_EQ_Y:
+      *val = ISM330DHCX_Z_EQ_Y;
       break;
 
-    case ISM330DHCX_STAMP_IN_XL_DATA:
-      *val = ISM330DHCX_STAMP_IN_XL_DATA;
+    case ISM330DHCX_Z_EQ_MIN_Y:
+      *val = ISM330DHCX_Z_EQ_MIN_Y;
       break;
 
-    case ISM330DHCX_STAMP_IN_GY_XL_DATA:
-      *val = ISM330DHCX_STAMP_IN_GY_XL_DATA;
+    case ISM330DHCX_Z_EQ_X:
+      *val = ISM330DHCX_Z_EQ_X;
+      break;
+
+    case ISM330DHCX_Z_EQ_MIN_X:
+      *val = ISM330DHCX_Z_EQ_MIN_X;
+      break;
+
+    case ISM330DHCX_Z_EQ_MIN_Z:
+      *val = ISM330DHCX_Z_EQ_MIN_Z;
+      break;
+
+    case ISM330DHCX_Z_EQ_Z:
+      *val = ISM330DHCX_Z_EQ_Z;
       break;
 
     default:
-      *val = ISM330DHCX_STAMP_IN_GY_DATA;
+      *val = ISM330DHCX_Z_EQ_Y;
       break;
   }
 
@@ -8442,142 +12599,168 @@ int32_t ism330dhcx_den_enable_get(const stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  DEN value stored in LSB of X-axis.[set]
+  * @brief  Magnetometer Y-axis coordinates rotation (to be aligned to
+  *         accelerometer/gyroscope axes orientation).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_z in reg CTRL9_XL
+  * @param  val    Change the values of mag_y_axis in
+  *                               reg MAG_CFG_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_mark_axis_x_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_mag_y_orient_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_mag_y_axis_t val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  ism330dhcx_mag_cfg_a_t mag_cfg_a;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
+                                   (uint8_t *)&mag_cfg_a);
 
   if (ret == 0)
   {
-    ctrl9_xl.den_z = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
-                               (uint8_t *)&ctrl9_xl, 1);
+    mag_cfg_a.mag_y_axis = (uint8_t)val;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_CFG_A,
+                                      (uint8_t *)&mag_cfg_a);
   }
 
-  return ret;
-}
-
-/**
-  * @brief  DEN value stored in LSB of X-axis.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_z in reg CTRL9_XL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_den_mark_axis_x_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
-{
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
-  int32_t ret;
-
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
-  *val = ctrl9_xl.den_z;
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  DEN value stored in LSB of Y-axis.[set]
+  * @brief  Magnetometer Y-axis coordinates rotation (to be aligned to
+  *         accelerometer/gyroscope axes orientation).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_y in reg CTRL9_XL
+  * @param  val    Get the values of mag_y_axis in reg MAG_CFG_A
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_mark_axis_y_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_mag_y_orient_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_mag_y_axis_t *val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  ism330dhcx_mag_cfg_a_t mag_cfg_a;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
+                                   (uint8_t *)&mag_cfg_a);
 
-  if (ret == 0)
+  switch (mag_cfg_a.mag_y_axis)
   {
-    ctrl9_xl.den_y = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
-                               (uint8_t *)&ctrl9_xl, 1);
-  }
+    case ISM330DHCX_Y_EQ_Y:
+      *val = ISM330DHCX_Y_EQ_Y;
+      break;
 
-  return ret;
-}
+    case ISM330DHCX_Y_EQ_MIN_Y:
+      *val = ISM330DHCX_Y_EQ_MIN_Y;
+      break;
 
-/**
-  * @brief  DEN value stored in LSB of Y-axis.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_y in reg CTRL9_XL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_den_mark_axis_y_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
-{
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
-  int32_t ret;
+    case ISM330DHCX_Y_EQ_X:
+      *val = ISM330DHCX_Y_EQ_X;
+      break;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
-  *val = ctrl9_xl.den_y;
+    case ISM330DHCX_Y_EQ_MIN_X:
+      *val = ISM330DHCX_Y_EQ_MIN_X;
+      break;
+
+    case ISM330DHCX_Y_EQ_MIN_Z:
+      *val = ISM330DHCX_Y_EQ_MIN_Z;
+      break;
+
+    case ISM330DHCX_Y_EQ_Z:
+      *val = ISM330DHCX_Y_EQ_Z;
+      break;
+
+    default:
+      *val = ISM330DHCX_Y_EQ_Y;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  DEN value stored in LSB of Z-axis.[set]
+   * @brief  Magnetometer X-axis coordinates rotation (to be aligned to
+  *         accelerometer/gyroscope axes orientation).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_x in reg CTRL9_XL
+  * @param  val    Change the values of mag_x_axis in reg MAG_CFG_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_mark_axis_z_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_mag_x_orient_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_mag_x_axis_t val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  ism330dhcx_mag_cfg_b_t mag_cfg_b;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_B,
+                                   (uint8_t *)&mag_cfg_b);
 
   if (ret == 0)
   {
-    ctrl9_xl.den_z = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_CTRL9_XL,
-                               (uint8_t *)&ctrl9_xl, 1);
+    mag_cfg_b.mag_x_axis = (uint8_t)val;
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_CFG_B,
+                                      (uint8_t *)&mag_cfg_b);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  DEN value stored in LSB of Z-axis.[get]
+  * @brief  Magnetometer X-axis coordinates rotation (to be aligned to
+  *         accelerometer/gyroscope axes orientation).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of den_x in reg CTRL9_XL
+  * @param  val    Get the values of mag_x_axis in reg MAG_CFG_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_den_mark_axis_z_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
+int32_t ism330dhcx_mag_x_orient_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_mag_x_axis_t *val)
 {
-  ism330dhcx_ctrl9_xl_t ctrl9_xl;
+  ism330dhcx_mag_cfg_b_t mag_cfg_b;
   int32_t ret;
 
-  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_CTRL9_XL,
-                            (uint8_t *)&ctrl9_xl, 1);
-  *val = ctrl9_xl.den_z;
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_B,
+                                   (uint8_t *)&mag_cfg_b);
+
+  switch (mag_cfg_b.mag_x_axis)
+  {
+    case ISM330DHCX_X_EQ_Y:
+      *val = ISM330DHCX_X_EQ_Y;
+      break;
+
+    case ISM330DHCX_X_EQ_MIN_Y:
+      *val = ISM330DHCX_X_EQ_MIN_Y;
+      break;
+
+    case ISM330DHCX_X_EQ_X:
+      *val = ISM330DHCX_X_EQ_X;
+      break;
+
+    case ISM330DHCX_X_EQ_MIN_X:
+      *val = ISM330DHCX_X_EQ_MIN_X;
+      break;
+
+    case ISM330DHCX_X_EQ_MIN_Z:
+      *val = ISM330DHCX_X_EQ_MIN_Z;
+      break;
+
+    case ISM330DHCX_X_EQ_Z:
+      *val = ISM330DHCX_X_EQ_Z;
+      break;
+
+    default:
+      *val = ISM330DHCX_X_EQ_Y;
+      break;
+  }
 
   return ret;
 }
@@ -8588,68 +12771,76 @@ int32_t ism330dhcx_den_mark_axis_z_get(const stmdev_ctx_t *ctx,
   */
 
 /**
-  * @defgroup   ISM330DHCX_Pedometer
-  * @brief      This section groups all the functions that manage pedometer.
+  * @defgroup   ISM330DHCX_finite_state_machine
+  * @brief      This section groups all the functions that manage the
+  *             state_machine.
   * @{
   *
   */
 
 /**
-  * @brief  Enable pedometer algorithm.[set]
+  * @brief  Interrupt status bit for FSM long counter timeout interrupt
+  *         event.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pedo_en in reg EMB_FUNC_EN_A
+  * @param  val    Change the values of is_fsm_lc in reg EMB_FUNC_STATUS
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_long_cnt_flag_data_ready_get(const stmdev_ctx_t *ctx,
+                                                uint8_t *val)
 {
-  ism330dhcx_emb_func_en_a_t emb_func_en_a;
+  ism330dhcx_emb_func_status_t emb_func_status;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                              (uint8_t *)&emb_func_en_a, 1);
-  }
-
-  if (ret == 0)
-  {
-    emb_func_en_a.pedo_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                               (uint8_t *)&emb_func_en_a, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
+                              (uint8_t *)&emb_func_status, 1);
   }
 
   if (ret == 0)
   {
+    *val = emb_func_status.is_fsm_lc;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable pedometer algorithm.[get]
+  * @brief  Embedded final state machine functions mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pedo_en in reg EMB_FUNC_EN_A
+  * @param  val    Change the values of fsm_en in reg EMB_FUNC_EN_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_emb_fsm_en_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_emb_func_en_a_t emb_func_en_a;
   int32_t ret;
 
+  ism330dhcx_emb_func_en_b_t emb_func_en_b;
+
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                              (uint8_t *)&emb_func_en_a, 1);
-    *val = emb_func_en_a.pedo_en;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                              (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_en_b.fsm_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                               (uint8_t *)&emb_func_en_b, 1);
   }
 
   if (ret == 0)
@@ -8657,30 +12848,38 @@ int32_t ism330dhcx_pedo_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Interrupt status bit for step detection.[get]
+  * @brief  Embedded final state machine functions mode.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of is_step_det in reg EMB_FUNC_STATUS
+  * @param  val    Get the values of fsm_en in reg EMB_FUNC_EN_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_step_detect_get(const stmdev_ctx_t *ctx,
-                                        uint8_t *val)
+int32_t ism330dhcx_emb_fsm_en_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_emb_func_status_t emb_func_status;
   int32_t ret;
+  ism330dhcx_emb_func_en_b_t emb_func_en_b;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
-                              (uint8_t *)&emb_func_status, 1);
-    *val = emb_func_status.is_step_det;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                              (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_en_b.fsm_en;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                               (uint8_t *)&emb_func_en_b, 1);
   }
 
   if (ret == 0)
@@ -8688,206 +12887,372 @@ int32_t ism330dhcx_pedo_step_detect_get(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Pedometer debounce configuration register (r/w).[set]
+  * @brief  Embedded final state machine functions mode.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
+  * @param  val    Structure of registers from FSM_ENABLE_A to FSM_ENABLE_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_debounce_steps_set(const stmdev_ctx_t *ctx,
-                                           uint8_t *buff)
+int32_t ism330dhcx_fsm_enable_set(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_emb_fsm_enable_t *val)
 {
+  ism330dhcx_emb_func_en_b_t emb_func_en_b;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_DEB_STEPS_CONF,
-                                    buff);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_ENABLE_A,
+                               (uint8_t *)&val->fsm_enable_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_ENABLE_B,
+                               (uint8_t *)&val->fsm_enable_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                              (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    if ((val->fsm_enable_a.fsm1_en |
+         val->fsm_enable_a.fsm2_en |
+         val->fsm_enable_a.fsm3_en |
+         val->fsm_enable_a.fsm4_en |
+         val->fsm_enable_a.fsm5_en |
+         val->fsm_enable_a.fsm6_en |
+         val->fsm_enable_a.fsm7_en |
+         val->fsm_enable_a.fsm8_en |
+         val->fsm_enable_b.fsm9_en |
+         val->fsm_enable_b.fsm10_en |
+         val->fsm_enable_b.fsm11_en |
+         val->fsm_enable_b.fsm12_en |
+         val->fsm_enable_b.fsm13_en |
+         val->fsm_enable_b.fsm14_en |
+         val->fsm_enable_b.fsm15_en |
+         val->fsm_enable_b.fsm16_en) != PROPERTY_DISABLE)
+    {
+      emb_func_en_b.fsm_en = PROPERTY_ENABLE;
+    }
+
+    else
+    {
+      emb_func_en_b.fsm_en = PROPERTY_DISABLE;
+    }
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                               (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Pedometer debounce configuration register (r/w).[get]
+  * @brief  Embedded final state machine functions mode.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
+  * @param  val    Structure of registers from FSM_ENABLE_A to FSM_ENABLE_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_debounce_steps_get(const stmdev_ctx_t *ctx,
-                                           uint8_t *buff)
+int32_t ism330dhcx_fsm_enable_get(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_emb_fsm_enable_t *val)
 {
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_DEB_STEPS_CONF,
-                                   buff);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_ENABLE_A,
+                              (uint8_t *)&val->fsm_enable_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_ENABLE_B,
+                              (uint8_t *)&val->fsm_enable_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Time period register for step detection on delta time (r/w).[set]
+  * @brief  FSM long counter status register. Long counter value is an
+  *         unsigned integer value (16-bit format).[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
   * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_steps_period_set(const stmdev_ctx_t *ctx,
-                                         uint16_t val)
+int32_t ism330dhcx_long_cnt_set(const stmdev_ctx_t *ctx, uint16_t val)
 {
   uint8_t buff[2];
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   buff[1] = (uint8_t)(val / 256U);
   buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_L,
-                                    &buff[0]);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_L, buff,
+                               2);
+  }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_H,
-                                      &buff[1]);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Time period register for step detection on delta time (r/w).[get]
+  * @brief  FSM long counter status register. Long counter value is an
+  *         unsigned integer value (16-bit format).[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
   * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_steps_period_get(const stmdev_ctx_t *ctx,
-                                         uint16_t *val)
+int32_t ism330dhcx_long_cnt_get(const stmdev_ctx_t *ctx, uint16_t *val)
 {
   uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_L,
-                                   &buff[0]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_SC_DELTAT_H,
-                                     &buff[1]);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_L, buff,
+                              2);
     *val = buff[1];
     *val = (*val * 256U) +  buff[0];
   }
 
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Set when user wants to generate interrupt on count overflow
-  *         event/every step.[set]
+  * @brief  Clear FSM long counter value.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of carry_count_en in reg PEDO_CMD_REG
+  * @param  val    Change the values of fsm_lc_clr in reg
+  *                FSM_LONG_COUNTER_CLEAR
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_int_mode_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_carry_count_en_t val)
+int32_t ism330dhcx_long_clr_set(const stmdev_ctx_t *ctx,
+                                ism330dhcx_fsm_lc_clr_t val)
 {
-  ism330dhcx_pedo_cmd_reg_t pedo_cmd_reg;
+  ism330dhcx_fsm_long_counter_clear_t fsm_long_counter_clear;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_CMD_REG,
-                                   (uint8_t *)&pedo_cmd_reg);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    pedo_cmd_reg.carry_count_en = (uint8_t)val;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_PEDO_CMD_REG,
-                                      (uint8_t *)&pedo_cmd_reg);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_CLEAR,
+                              (uint8_t *)&fsm_long_counter_clear, 1);
+  }
+
+  if (ret == 0)
+  {
+    fsm_long_counter_clear.fsm_lc_clr = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_CLEAR,
+                               (uint8_t *)&fsm_long_counter_clear, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Set when user wants to generate interrupt on count overflow
-  *         event/every step.[get]
+  * @brief  Clear FSM long counter value.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of carry_count_en in reg PEDO_CMD_REG
+  * @param  val    Get the values of fsm_lc_clr in reg  FSM_LONG_COUNTER_CLEAR
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_pedo_int_mode_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_carry_count_en_t *val)
+int32_t ism330dhcx_long_clr_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_fsm_lc_clr_t *val)
 {
-  ism330dhcx_pedo_cmd_reg_t pedo_cmd_reg;
+  ism330dhcx_fsm_long_counter_clear_t fsm_long_counter_clear;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_PEDO_CMD_REG,
-                                   (uint8_t *)&pedo_cmd_reg);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
-  switch (pedo_cmd_reg.carry_count_en)
+  if (ret == 0)
   {
-    case ISM330DHCX_EVERY_STEP:
-      *val = ISM330DHCX_EVERY_STEP;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_CLEAR,
+                              (uint8_t *)&fsm_long_counter_clear, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  switch (fsm_long_counter_clear.fsm_lc_clr)
+  {
+    case ISM330DHCX_LC_NORMAL:
+      *val = ISM330DHCX_LC_NORMAL;
       break;
 
-    case ISM330DHCX_COUNT_OVERFLOW:
-      *val = ISM330DHCX_COUNT_OVERFLOW;
+    case ISM330DHCX_LC_CLEAR:
+      *val = ISM330DHCX_LC_CLEAR;
+      break;
+
+    case ISM330DHCX_LC_CLEAR_DONE:
+      *val = ISM330DHCX_LC_CLEAR_DONE;
       break;
 
     default:
-      *val = ISM330DHCX_EVERY_STEP;
+      *val = ISM330DHCX_LC_NORMAL;
       break;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @}
+  * @brief  FSM output registers.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Structure of registers from FSM_OUTS1 to FSM_OUTS16
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t ism330dhcx_fsm_out_get(const stmdev_ctx_t *ctx,
+                               ism330dhcx_fsm_out_t *val)
+{
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_emb_session_start(ctx);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_fsm_out_emb_get(ctx, val);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_emb_session_stop(ctx);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
 
 /**
-  * @defgroup   ISM330DHCX_significant_motion
-  * @brief      This section groups all the functions that manage the
-  *             significant motion detection.
-  * @{
+  * @brief  FSM output registers, to be used inside an embedded functions
+  *         bank session.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Structure of registers from FSM_OUTS1 to FSM_OUTS16
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t ism330dhcx_fsm_out_emb_get(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_fsm_out_t *val)
+{
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_OUTS1,
+                            (uint8_t *)&val->fsm_outs1, 16);
+
+  return ret;
+}
 
 /**
-  * @brief  Enable significant motion detection function.[set]
+  * @brief  Finite State Machine ODR configuration.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sign_motion_en in reg EMB_FUNC_EN_A
+  * @param  val    Change the values of fsm_odr in reg EMB_FUNC_ODR_CFG_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_motion_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_fsm_data_rate_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_fsm_odr_t val)
 {
-  ism330dhcx_emb_func_en_a_t emb_func_en_a;
+  ism330dhcx_emb_func_odr_cfg_b_t emb_func_odr_cfg_b;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                              (uint8_t *)&emb_func_en_a, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B,
+                              (uint8_t *)&emb_func_odr_cfg_b, 1);
   }
 
   if (ret == 0)
   {
-    emb_func_en_a.sign_motion_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                               (uint8_t *)&emb_func_en_a, 1);
+    emb_func_odr_cfg_b.not_used_01 = 3; /* set default values */
+    emb_func_odr_cfg_b.not_used_02 = 1; /* set default values */
+    emb_func_odr_cfg_b.fsm_odr = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B,
+                               (uint8_t *)&emb_func_odr_cfg_b, 1);
   }
 
   if (ret == 0)
@@ -8895,905 +13260,931 @@ int32_t ism330dhcx_motion_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Enable significant motion detection function.[get]
+  * @brief  Finite State Machine ODR configuration.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sign_motion_en in reg EMB_FUNC_EN_A
+  * @param  val    Get the values of fsm_odr in reg EMB_FUNC_ODR_CFG_B
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_motion_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_fsm_data_rate_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_fsm_odr_t *val)
 {
-  ism330dhcx_emb_func_en_a_t emb_func_en_a;
+  ism330dhcx_emb_func_odr_cfg_b_t emb_func_odr_cfg_b;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                              (uint8_t *)&emb_func_en_a, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B,
+                              (uint8_t *)&emb_func_odr_cfg_b, 1);
   }
 
   if (ret == 0)
   {
-    *val = emb_func_en_a.sign_motion_en;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  switch (emb_func_odr_cfg_b.fsm_odr)
+  {
+    case ISM330DHCX_ODR_FSM_12Hz5:
+      *val = ISM330DHCX_ODR_FSM_12Hz5;
+      break;
+
+    case ISM330DHCX_ODR_FSM_26Hz:
+      *val = ISM330DHCX_ODR_FSM_26Hz;
+      break;
+
+    case ISM330DHCX_ODR_FSM_52Hz:
+      *val = ISM330DHCX_ODR_FSM_52Hz;
+      break;
+
+    case ISM330DHCX_ODR_FSM_104Hz:
+      *val = ISM330DHCX_ODR_FSM_104Hz;
+      break;
+
+    default:
+      *val = ISM330DHCX_ODR_FSM_12Hz5;
+      break;
+  }
+
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Interrupt status bit for significant motion detection.[get]
+  * @brief  FSM initialization request.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of is_sigmot in reg EMB_FUNC_STATUS
+  * @param  val    Change the values of fsm_init in reg FSM_INIT
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_motion_flag_data_ready_get(const stmdev_ctx_t *ctx,
-                                              uint8_t *val)
+int32_t ism330dhcx_fsm_init_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_emb_func_status_t emb_func_status;
+  ism330dhcx_emb_func_init_b_t emb_func_init_b;
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
-                              (uint8_t *)&emb_func_status, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                              (uint8_t *)&emb_func_init_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_init_b.fsm_init = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                               (uint8_t *)&emb_func_init_b, 1);
   }
 
   if (ret == 0)
   {
-    *val = emb_func_status.is_sigmot;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @}
+  * @brief  FSM initialization request.[get]
   *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_tilt_detection
-  * @brief      This section groups all the functions that manage the tilt
-  *             event detection.
-  * @{
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fsm_init in reg FSM_INIT
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t ism330dhcx_fsm_init_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                              (uint8_t *)&emb_func_init_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_init_b.fsm_init;
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
 
 /**
-  * @brief  Enable tilt calculation.[set]
+  * @brief  FSM long counter timeout register (r/w). The long counter
+  *         timeout value is an unsigned integer value (16-bit format).
+  *         When the long counter value reached this value, the FSM
+  *         generates an interrupt.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tilt_en in reg EMB_FUNC_EN_A
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tilt_sens_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_long_cnt_int_value_set(const stmdev_ctx_t *ctx,
+                                          uint16_t val)
 {
-  ism330dhcx_emb_func_en_a_t emb_func_en_a;
+  uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                              (uint8_t *)&emb_func_en_a, 1);
-  }
+  ism330dhcx_lock(ctx);
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_L,
+                                    &buff[0]);
 
   if (ret == 0)
   {
-    emb_func_en_a.tilt_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                               (uint8_t *)&emb_func_en_a, 1);
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_H,
+                                      &buff[1]);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Enable tilt calculation.[get]
+  * @brief  FSM long counter timeout register (r/w). The long counter
+  *         timeout value is an unsigned integer value (16-bit format).
+  *         When the long counter value reached this value, the FSM generates
+  *         an interrupt.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of tilt_en in reg EMB_FUNC_EN_A
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tilt_sens_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_long_cnt_int_value_get(const stmdev_ctx_t *ctx,
+                                          uint16_t *val)
 {
-  ism330dhcx_emb_func_en_a_t emb_func_en_a;
+  uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_L,
+                                   &buff[0]);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_A,
-                              (uint8_t *)&emb_func_en_a, 1);
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_H,
+                                     &buff[1]);
+    *val = buff[1];
+    *val = (*val * 256U) +  buff[0];
   }
 
-  if (ret == 0)
-  {
-    *val = emb_func_en_a.tilt_en;
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Interrupt status bit for tilt detection.[get]
+  * @brief  FSM number of programs register.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of is_tilt in reg EMB_FUNC_STATUS
+  * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_tilt_flag_data_ready_get(const stmdev_ctx_t *ctx,
-                                            uint8_t *val)
+int32_t ism330dhcx_fsm_number_of_programs_set(const stmdev_ctx_t *ctx,
+                                              uint8_t *buff)
 {
-  ism330dhcx_emb_func_status_t emb_func_status;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_PROGRAMS, buff);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
-                              (uint8_t *)&emb_func_status, 1);
+    ret = ism330dhcx_ln_pg_write_byte(ctx,
+                                      ISM330DHCX_FSM_PROGRAMS + 0x01U,
+                                      buff);
   }
 
-  if (ret == 0)
-  {
-    *val = emb_func_status.is_tilt;
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @}
+  * @brief  FSM number of programs register.[get]
   *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_ magnetometer_sensor
-  * @brief      This section groups all the functions that manage additional
-  *             magnetometer sensor.
-  * @{
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  buff   Buffer that stores data read
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t ism330dhcx_fsm_number_of_programs_get(const stmdev_ctx_t *ctx,
+                                              uint8_t *buff)
+{
+  int32_t ret;
+
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_PROGRAMS, buff);
+
+  return ret;
+}
 
 /**
-  * @brief  External magnetometer sensitivity value register.[set]
+  * @brief  FSM start address register (r/w). First available address is
+  *         0x033C.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
   * @param  buff   Buffer that contains data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_sensitivity_set(const stmdev_ctx_t *ctx,
-                                       uint16_t val)
+int32_t ism330dhcx_fsm_start_address_set(const stmdev_ctx_t *ctx,
+                                         uint16_t val)
 {
   uint8_t buff[2];
   int32_t ret;
 
+  ism330dhcx_lock(ctx);
   buff[1] = (uint8_t)(val / 256U);
   buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_L,
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_START_ADD_L,
                                     &buff[0]);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_H,
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_START_ADD_H,
                                       &buff[1]);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  External magnetometer sensitivity value register.[get]
+  * @brief  FSM start address register (r/w). First available address
+  *         is 0x033C.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
   * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_sensitivity_get(const stmdev_ctx_t *ctx,
-                                       uint16_t *val)
+int32_t ism330dhcx_fsm_start_address_get(const stmdev_ctx_t *ctx,
+                                         uint16_t *val)
 {
   uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_L,
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_START_ADD_L,
                                    &buff[0]);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SENSITIVITY_H,
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_START_ADD_H,
                                      &buff[1]);
     *val = buff[1];
-    *val = (*val * 256U) + buff[0];
+    *val = (*val * 256U) +  buff[0];
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Offset for hard-iron compensation register (r/w).[set]
+  * @}
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  */
+
+/**
+  * @addtogroup  Machine Learning Core
+  * @brief   This section group all the functions concerning the
+  *          usage of Machine Learning Core
+  * @{
   *
   */
-int32_t ism330dhcx_mag_offset_set(const stmdev_ctx_t *ctx, int16_t *val)
+
+/**
+  * @brief  Enable Machine Learning Core.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      change the values of mlc_en in
+  *                  reg EMB_FUNC_EN_B and mlc_init
+  *                  in EMB_FUNC_INIT_B
+  *
+  */
+int32_t ism330dhcx_mlc_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  uint8_t buff[6];
+  ism330dhcx_emb_func_en_b_t reg;
   int32_t ret;
-  uint8_t i;
 
-  buff[1] = (uint8_t)((uint16_t)val[0] / 256U);
-  buff[0] = (uint8_t)((uint16_t)val[0] - (buff[1] * 256U));
-  buff[3] = (uint8_t)((uint16_t)val[1] / 256U);
-  buff[2] = (uint8_t)((uint16_t)val[1] - (buff[3] * 256U));
-  buff[5] = (uint8_t)((uint16_t)val[2] / 256U);
-  buff[4] = (uint8_t)((uint16_t)val[2] - (buff[5] * 256U));
-  i = 0x00U;
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFX_L, &buff[i]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFX_H, &buff[i]);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                              (uint8_t *)&reg, 1);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFY_L, &buff[i]);
+    reg.mlc_en = val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                               (uint8_t *)&reg, 1);
   }
 
-  if (ret == 0)
+  if ((val != PROPERTY_DISABLE) && (ret == 0))
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFY_H, &buff[i]);
-  }
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                              (uint8_t *)&reg, 1);
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFZ_L, &buff[i]);
+    if (ret == 0)
+    {
+      reg.mlc_en = val;
+      ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
+                                 (uint8_t *)&reg, 1);
+    }
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_OFFZ_H, &buff[i]);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Offset for hard-iron compensation register (r/w).[get]
+  * @brief  Enable Machine Learning Core.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ctx      read / write interface definitions
+  * @param  val      Get the values of mlc_en in
+  *                  reg EMB_FUNC_EN_B
   *
   */
-int32_t ism330dhcx_mag_offset_get(const stmdev_ctx_t *ctx, int16_t *val)
+int32_t ism330dhcx_mlc_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  uint8_t buff[6];
+  ism330dhcx_emb_func_en_b_t reg;
   int32_t ret;
-  uint8_t i;
 
-  i = 0x00U;
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFX_L, &buff[i]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFX_H, &buff[i]);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
+                              (uint8_t *)&reg, 1);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFY_L, &buff[i]);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    *val  = reg.mlc_en;
   }
 
+  ism330dhcx_unlock(ctx);
+
+  return ret;
+}
+
+/**
+  * @brief  Machine Learning Core status register[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      register MLC_STATUS_MAINPAGE
+  *
+  */
+int32_t ism330dhcx_mlc_status_get(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_mlc_status_mainpage_t *val)
+{
+  return ism330dhcx_read_reg(ctx, ISM330DHCX_MLC_STATUS_MAINPAGE,
+                             (uint8_t *) val, 1);
+}
+
+/**
+  * @brief  Machine Learning Core data rate selection.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      get the values of mlc_odr in
+  *                  reg EMB_FUNC_ODR_CFG_C
+  *
+  */
+int32_t ism330dhcx_mlc_data_rate_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_mlc_odr_t val)
+{
+  ism330dhcx_emb_func_odr_cfg_c_t reg;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFY_H, &buff[i]);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_C,
+                              (uint8_t *)&reg, 1);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFZ_L, &buff[i]);
+    reg.mlc_odr = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_C,
+                               (uint8_t *)&reg, 1);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_OFFZ_H, &buff[i]);
-
-    val[0] = (int16_t)buff[1];
-    val[0] = (val[0] * 256) + (int16_t)buff[0];
-    val[1] = (int16_t)buff[3];
-    val[1] = (val[1] * 256) + (int16_t)buff[2];
-    val[2] = (int16_t)buff[5];
-    val[2] = (val[2] * 256) + (int16_t)buff[4];
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Soft-iron (3x3 symmetric) matrix correction register (r/w).
-  *         The value is expressed as half-precision floating-point format:
-  *         SEEEEEFFFFFFFFFF
-  *         S: 1 sign bit;
-  *         E: 5 exponent bits;
-  *         F: 10 fraction bits).[set]
+  * @brief  Machine Learning Core data rate selection.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ctx      read / write interface definitions
+  * @param  val      change the values of mlc_odr in
+  *                  reg EMB_FUNC_ODR_CFG_C
   *
   */
-int32_t ism330dhcx_mag_soft_iron_set(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t ism330dhcx_mlc_data_rate_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_mlc_odr_t *val)
 {
-  uint8_t buff[12];
+  ism330dhcx_emb_func_odr_cfg_c_t reg;
   int32_t ret;
-  uint8_t i;
 
-  buff[1] = (uint8_t)(val[0] / 256U);
-  buff[0] = (uint8_t)(val[0] - (buff[1] * 256U));
-  buff[3] = (uint8_t)(val[1] / 256U);
-  buff[2] = (uint8_t)(val[1] - (buff[3] * 256U));
-  buff[5] = (uint8_t)(val[2] / 256U);
-  buff[4] = (uint8_t)(val[2] - (buff[5] * 256U));
-  buff[7] = (uint8_t)(val[3] / 256U);
-  buff[6] = (uint8_t)(val[3] - (buff[1] * 256U));
-  buff[9] = (uint8_t)(val[4] / 256U);
-  buff[8] = (uint8_t)(val[4] - (buff[3] * 256U));
-  buff[11] = (uint8_t)(val[5] / 256U);
-  buff[10] = (uint8_t)(val[5] - (buff[5] * 256U));
-  i = 0x00U;
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XX_L,
-                                    &buff[i]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XX_H,
-                                      &buff[i]);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_C,
+                              (uint8_t *)&reg, 1);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XY_L,
-                                      &buff[i]);
-  }
+    switch (reg.mlc_odr)
+    {
+      case ISM330DHCX_ODR_PRGS_12Hz5:
+        *val = ISM330DHCX_ODR_PRGS_12Hz5;
+        break;
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XY_H,
-                                      &buff[i]);
-  }
+      case ISM330DHCX_ODR_PRGS_26Hz:
+        *val = ISM330DHCX_ODR_PRGS_26Hz;
+        break;
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XZ_L,
-                                      &buff[i]);
-  }
+      case ISM330DHCX_ODR_PRGS_52Hz:
+        *val = ISM330DHCX_ODR_PRGS_52Hz;
+        break;
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_XZ_H,
-                                      &buff[i]);
-  }
+      case ISM330DHCX_ODR_PRGS_104Hz:
+        *val = ISM330DHCX_ODR_PRGS_104Hz;
+        break;
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YY_L,
-                                      &buff[i]);
-  }
+      default:
+        *val = ISM330DHCX_ODR_PRGS_12Hz5;
+        break;
+    }
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YY_H,
-                                      &buff[i]);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YZ_L,
-                                      &buff[i]);
-  }
+  ism330dhcx_unlock(ctx);
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_YZ_H,
-                                      &buff[i]);
-  }
+  return ret;
+}
+
+/**
+  * @brief  prgsens_out: [get] Output value of all MLCx decision trees.
+  *
+  * @param  ctx_t *ctx: read / write interface definitions
+  * @param  uint8_t * : buffer that stores data read
+  *
+  */
+int32_t ism330dhcx_mlc_out_get(const stmdev_ctx_t *ctx, uint8_t *buff)
+{
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_emb_session_start(ctx);
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_ZZ_L,
-                                      &buff[i]);
+    ret = ism330dhcx_mlc_out_emb_get(ctx, buff);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_SI_ZZ_H,
-                                      &buff[i]);
+    ret = ism330dhcx_emb_session_stop(ctx);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Soft-iron (3x3 symmetric) matrix correction register (r/w).
-  *         The value is expressed as half-precision floating-point format:
-  *         SEEEEEFFFFFFFFFF
-  *         S: 1 sign bit;
-  *         E: 5 exponent bits;
-  *         F: 10 fraction bits).[get]
+  * @brief  prgsens_out: [get] Output value of all MLCx decision trees,
+  *         to be used inside an embedded functions bank session.
+  *
+  * @param  ctx_t *ctx: read / write interface definitions
+  * @param  uint8_t * : buffer that stores data read
+  *
+  */
+int32_t ism330dhcx_mlc_out_emb_get(const stmdev_ctx_t *ctx, uint8_t *buff)
+{
+  int32_t ret;
+
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MLC0_SRC, buff, 8);
+
+  return ret;
+}
+
+/**
+  * @brief  Embedded functions status and outputs: EMB_FUNC_STATUS,
+  *         FSM_STATUS_A/B, MLC_STATUS, FSM_OUTS1 - 16, step counter and
+  *         MLC0_SRC - MLC7_SRC, read within a single embedded functions
+  *         bank session.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
+  * @param  val    Embedded functions status and outputs.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_soft_iron_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t ism330dhcx_emb_outputs_get(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_emb_outputs_t *val)
 {
-  uint8_t buff[12];
+  uint8_t buff[4];
   int32_t ret;
-  uint8_t i;
-
-  i = 0x00U;
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XX_L,
-                                   &buff[i]);
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XX_H,
-                                     &buff[i]);
-  }
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_emb_session_start(ctx);
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XY_L,
-                                     &buff[i]);
+    /* EMB_FUNC_STATUS, FSM_STATUS_A, FSM_STATUS_B, MLC_STATUS */
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS, buff, 4);
+    val->emb_func_status = *(ism330dhcx_emb_func_status_t *)&buff[0];
+    val->fsm_status_a = *(ism330dhcx_fsm_status_a_t *)&buff[1];
+    val->fsm_status_b = *(ism330dhcx_fsm_status_b_t *)&buff[2];
+    val->mlc_status = *(ism330dhcx_mlc_status_t *)&buff[3];
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XY_H,
-                                     &buff[i]);
+    ret = ism330dhcx_fsm_out_emb_get(ctx, &val->fsm_out);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XZ_L,
-                                     &buff[i]);
+    ret = ism330dhcx_number_of_steps_emb_get(ctx, &val->step_counter);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_XZ_H,
-                                     &buff[i]);
+    ret = ism330dhcx_mlc_out_emb_get(ctx, val->mlc_src);
   }
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YY_L,
-                                     &buff[i]);
+    ret = ism330dhcx_emb_session_stop(ctx);
   }
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YY_H,
-                                     &buff[i]);
-  }
+  ism330dhcx_unlock(ctx);
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YZ_L,
-                                     &buff[i]);
-  }
+  return ret;
+}
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_YZ_H,
-                                     &buff[i]);
-  }
+/**
+  * @brief  External magnetometer sensitivity value register for
+  *         Machine Learning Core.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  buff     buffer that contains data to write
+  *
+  */
+int32_t ism330dhcx_mlc_mag_sensitivity_set(const stmdev_ctx_t *ctx,
+                                           uint16_t val)
+{
+  uint8_t buff[2];
+  int32_t ret;
 
-  if (ret == 0)
-  {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_ZZ_L,
-                                     &buff[i]);
-  }
+  ism330dhcx_lock(ctx);
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_L,
+                                    &buff[0]);
 
   if (ret == 0)
   {
-    i++;
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_SI_ZZ_H,
-                                     &buff[i]);
+    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_H,
+                                      &buff[1]);
   }
 
-  val[0] = buff[1];
-  val[0] = (val[0] * 256U) +  buff[0];
-  val[1] = buff[3];
-  val[1] = (val[1] * 256U) +  buff[2];
-  val[2] = buff[5];
-  val[2] = (val[2] * 256U) +  buff[4];
-  val[3] = buff[7];
-  val[3] = (val[3] * 256U) +  buff[6];
-  val[4] = buff[9];
-  val[4] = (val[4] * 256U) +  buff[8];
-  val[5] = buff[11];
-  val[6] = (val[5] * 256U) +  buff[10];
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  Magnetometer Z-axis coordinates rotation (to be aligned to
-  *         accelerometer/gyroscope axes orientation).[set]
+  * @brief  External magnetometer sensitivity value register for
+  *         Machine Learning Core.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of mag_z_axis in reg MAG_CFG_A
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  ctx      read / write interface definitions
+  * @param  buff     buffer that stores data read
   *
   */
-int32_t ism330dhcx_mag_z_orient_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_mag_z_axis_t val)
+int32_t ism330dhcx_mlc_mag_sensitivity_get(const stmdev_ctx_t *ctx,
+                                           uint16_t *val)
 {
-  ism330dhcx_mag_cfg_a_t mag_cfg_a;
+  uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
-                                   (uint8_t *)&mag_cfg_a);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_L,
+                                   &buff[0]);
 
   if (ret == 0)
   {
-    mag_cfg_a.mag_z_axis = (uint8_t)val;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_CFG_A,
-                                      (uint8_t *)&mag_cfg_a);
+    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_H,
+                                     &buff[1]);
+    *val = buff[1];
+    *val = (*val * 256U) +  buff[0];
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Magnetometer Z-axis coordinates rotation (to be aligned to
-  *         accelerometer/gyroscope axes orientation).[get]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup   ISM330DHCX_Sensor_hub
+  * @brief      This section groups all the functions that manage the
+  *             sensor hub.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Sensor hub output registers.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of mag_z_axis in reg MAG_CFG_A
+  * @param  val    Structure of registers from SENSOR_HUB_1 to SENSOR_HUB_18
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_z_orient_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_mag_z_axis_t *val)
+int32_t ism330dhcx_sh_read_data_raw_get(const stmdev_ctx_t *ctx,
+                                        ism330dhcx_emb_sh_read_t *val,
+                                        uint8_t len)
 {
-  ism330dhcx_mag_cfg_a_t mag_cfg_a;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
-                                   (uint8_t *)&mag_cfg_a);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
-  switch (mag_cfg_a.mag_z_axis)
+  if (ret == 0)
   {
-    case ISM330DHCX_Z_EQ_Y:
-      *val = ISM330DHCX_Z_EQ_Y;
-      break;
-
-    case ISM330DHCX_Z_EQ_MIN_Y:
-      *val = ISM330DHCX_Z_EQ_MIN_Y;
-      break;
-
-    case ISM330DHCX_Z_EQ_X:
-      *val = ISM330DHCX_Z_EQ_X;
-      break;
-
-    case ISM330DHCX_Z_EQ_MIN_X:
-      *val = ISM330DHCX_Z_EQ_MIN_X;
-      break;
-
-    case ISM330DHCX_Z_EQ_MIN_Z:
-      *val = ISM330DHCX_Z_EQ_MIN_Z;
-      break;
-
-    case ISM330DHCX_Z_EQ_Z:
-      *val = ISM330DHCX_Z_EQ_Z;
-      break;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SENSOR_HUB_1,
+                              (uint8_t *)val, len);
+  }
 
-    default:
-      *val = ISM330DHCX_Z_EQ_Y;
-      break;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Magnetometer Y-axis coordinates rotation (to be aligned to
-  *         accelerometer/gyroscope axes orientation).[set]
+  * @brief  Number of external sensors to be read by the sensor hub.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of mag_y_axis in
-  *                               reg MAG_CFG_A
+  * @param  val    Change the values of aux_sens_on in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_y_orient_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_mag_y_axis_t val)
+int32_t ism330dhcx_sh_slave_connected_set(const stmdev_ctx_t *ctx,
+                                          ism330dhcx_aux_sens_on_t val)
 {
-  ism330dhcx_mag_cfg_a_t mag_cfg_a;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
-                                   (uint8_t *)&mag_cfg_a);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    mag_cfg_a.mag_y_axis = (uint8_t)val;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_CFG_A,
-                                      (uint8_t *)&mag_cfg_a);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    master_config.aux_sens_on = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Magnetometer Y-axis coordinates rotation (to be aligned to
-  *         accelerometer/gyroscope axes orientation).[get]
+  * @brief  Number of external sensors to be read by the sensor hub.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of mag_y_axis in reg MAG_CFG_A
+  * @param  val    Get the values of aux_sens_on in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_y_orient_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_mag_y_axis_t *val)
+int32_t ism330dhcx_sh_slave_connected_get(const stmdev_ctx_t *ctx,
+                                          ism330dhcx_aux_sens_on_t *val)
 {
-  ism330dhcx_mag_cfg_a_t mag_cfg_a;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_A,
-                                   (uint8_t *)&mag_cfg_a);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
-  switch (mag_cfg_a.mag_y_axis)
+  if (ret == 0)
   {
-    case ISM330DHCX_Y_EQ_Y:
-      *val = ISM330DHCX_Y_EQ_Y;
-      break;
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
+  }
 
-    case ISM330DHCX_Y_EQ_MIN_Y:
-      *val = ISM330DHCX_Y_EQ_MIN_Y;
-      break;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
 
-    case ISM330DHCX_Y_EQ_X:
-      *val = ISM330DHCX_Y_EQ_X;
+  switch (master_config.aux_sens_on)
+  {
+    case ISM330DHCX_SLV_0:
+      *val = ISM330DHCX_SLV_0;
       break;
 
-    case ISM330DHCX_Y_EQ_MIN_X:
-      *val = ISM330DHCX_Y_EQ_MIN_X;
+    case ISM330DHCX_SLV_0_1:
+      *val = ISM330DHCX_SLV_0_1;
       break;
 
-    case ISM330DHCX_Y_EQ_MIN_Z:
-      *val = ISM330DHCX_Y_EQ_MIN_Z;
+    case ISM330DHCX_SLV_0_1_2:
+      *val = ISM330DHCX_SLV_0_1_2;
       break;
 
-    case ISM330DHCX_Y_EQ_Z:
-      *val = ISM330DHCX_Y_EQ_Z;
+    case ISM330DHCX_SLV_0_1_2_3:
+      *val = ISM330DHCX_SLV_0_1_2_3;
       break;
 
     default:
-      *val = ISM330DHCX_Y_EQ_Y;
+      *val = ISM330DHCX_SLV_0;
       break;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-   * @brief  Magnetometer X-axis coordinates rotation (to be aligned to
-  *         accelerometer/gyroscope axes orientation).[set]
+  * @brief  Sensor hub I2C master enable.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of mag_x_axis in reg MAG_CFG_B
+  * @param  val    Change the values of master_on in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mag_x_orient_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_mag_x_axis_t val)
+int32_t ism330dhcx_sh_master_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_mag_cfg_b_t mag_cfg_b;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_B,
-                                   (uint8_t *)&mag_cfg_b);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    mag_cfg_b.mag_x_axis = (uint8_t)val;
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MAG_CFG_B,
-                                      (uint8_t *)&mag_cfg_b);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Magnetometer X-axis coordinates rotation (to be aligned to
-  *         accelerometer/gyroscope axes orientation).[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of mag_x_axis in reg MAG_CFG_B
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_mag_x_orient_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_mag_x_axis_t *val)
-{
-  ism330dhcx_mag_cfg_b_t mag_cfg_b;
-  int32_t ret;
-
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MAG_CFG_B,
-                                   (uint8_t *)&mag_cfg_b);
-
-  switch (mag_cfg_b.mag_x_axis)
+  if (ret == 0)
   {
-    case ISM330DHCX_X_EQ_Y:
-      *val = ISM330DHCX_X_EQ_Y;
-      break;
-
-    case ISM330DHCX_X_EQ_MIN_Y:
-      *val = ISM330DHCX_X_EQ_MIN_Y;
-      break;
-
-    case ISM330DHCX_X_EQ_X:
-      *val = ISM330DHCX_X_EQ_X;
-      break;
-
-    case ISM330DHCX_X_EQ_MIN_X:
-      *val = ISM330DHCX_X_EQ_MIN_X;
-      break;
-
-    case ISM330DHCX_X_EQ_MIN_Z:
-      *val = ISM330DHCX_X_EQ_MIN_Z;
-      break;
-
-    case ISM330DHCX_X_EQ_Z:
-      *val = ISM330DHCX_X_EQ_Z;
-      break;
+    master_config.master_on = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
+  }
 
-    default:
-      *val = ISM330DHCX_X_EQ_Y;
-      break;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_finite_state_machine
-  * @brief      This section groups all the functions that manage the
-  *             state_machine.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Interrupt status bit for FSM long counter timeout interrupt
-  *         event.[get]
+  * @brief  Sensor hub I2C master enable.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of is_fsm_lc in reg EMB_FUNC_STATUS
+  * @param  val    Change the values of master_on in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_long_cnt_flag_data_ready_get(const stmdev_ctx_t *ctx,
-                                                uint8_t *val)
+int32_t ism330dhcx_sh_master_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  ism330dhcx_emb_func_status_t emb_func_status;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_STATUS,
-                              (uint8_t *)&emb_func_status, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    *val = emb_func_status.is_fsm_lc;
+    *val = master_config.master_on;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Embedded final state machine functions mode.[set]
+  * @brief  Master I2C pull-up enable.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fsm_en in reg EMB_FUNC_EN_B
+  * @param  val    Change the values of shub_pu_en in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_emb_fsm_en_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_sh_pin_mode_set(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_shub_pu_en_t val)
 {
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ism330dhcx_emb_func_en_b_t emb_func_en_b;
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                              (uint8_t *)&emb_func_en_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    emb_func_en_b.fsm_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                               (uint8_t *)&emb_func_en_b, 1);
+    master_config.shub_pu_en = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
@@ -9801,146 +14192,160 @@ int32_t ism330dhcx_emb_fsm_en_set(const stmdev_ctx_t *ctx, uint8_t val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Embedded final state machine functions mode.[get]
+  * @brief  Master I2C pull-up enable.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fsm_en in reg EMB_FUNC_EN_B
+  * @param  val    Get the values of shub_pu_en in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_emb_fsm_en_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_sh_pin_mode_get(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_shub_pu_en_t *val)
 {
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
-  ism330dhcx_emb_func_en_b_t emb_func_en_b;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                              (uint8_t *)&emb_func_en_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    *val = emb_func_en_b.fsm_en;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                               (uint8_t *)&emb_func_en_b, 1);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  if (ret == 0)
+  switch (master_config.shub_pu_en)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    case ISM330DHCX_EXT_PULL_UP:
+      *val = ISM330DHCX_EXT_PULL_UP;
+      break;
+
+    case ISM330DHCX_INTERNAL_PULL_UP:
+      *val = ISM330DHCX_INTERNAL_PULL_UP;
+      break;
+
+    default:
+      *val = ISM330DHCX_EXT_PULL_UP;
+      break;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Embedded final state machine functions mode.[set]
+  * @brief  I2C interface pass-through.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers from FSM_ENABLE_A to FSM_ENABLE_B
+  * @param  val    Change the values of pass_through_mode in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_enable_set(const stmdev_ctx_t *ctx,
-                                  ism330dhcx_emb_fsm_enable_t *val)
+int32_t ism330dhcx_sh_pass_through_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  ism330dhcx_emb_func_en_b_t emb_func_en_b;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_ENABLE_A,
-                               (uint8_t *)&val->fsm_enable_a, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_ENABLE_B,
-                               (uint8_t *)&val->fsm_enable_b, 1);
+    master_config.pass_through_mode = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                              (uint8_t *)&emb_func_en_b, 1);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  if (ret == 0)
-  {
-    if ((val->fsm_enable_a.fsm1_en |
-         val->fsm_enable_a.fsm2_en |
-         val->fsm_enable_a.fsm3_en |
-         val->fsm_enable_a.fsm4_en |
-         val->fsm_enable_a.fsm5_en |
-         val->fsm_enable_a.fsm6_en |
-         val->fsm_enable_a.fsm7_en |
-         val->fsm_enable_a.fsm8_en |
-         val->fsm_enable_b.fsm9_en |
-         val->fsm_enable_b.fsm10_en |
-         val->fsm_enable_b.fsm11_en |
-         val->fsm_enable_b.fsm12_en |
-         val->fsm_enable_b.fsm13_en |
-         val->fsm_enable_b.fsm14_en |
-         val->fsm_enable_b.fsm15_en |
-         val->fsm_enable_b.fsm16_en) != PROPERTY_DISABLE)
-    {
-      emb_func_en_b.fsm_en = PROPERTY_ENABLE;
-    }
+  ism330dhcx_unlock(ctx);
 
-    else
-    {
-      emb_func_en_b.fsm_en = PROPERTY_DISABLE;
-    }
-  }
+  return ret;
+}
+
+/**
+  * @brief  I2C interface pass-through.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of pass_through_mode in reg MASTER_CONFIG
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_sh_pass_through_get(const stmdev_ctx_t *ctx,
+                                       uint8_t *val)
+{
+  ism330dhcx_master_config_t master_config;
+  int32_t ret;
+
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                               (uint8_t *)&emb_func_en_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
+    *val = master_config.pass_through_mode;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Embedded final state machine functions mode.[get]
+  * @brief  Sensor hub trigger signal selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers from FSM_ENABLE_A to FSM_ENABLE_B
+  * @param  val    Change the values of start_config in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_enable_get(const stmdev_ctx_t *ctx,
-                                  ism330dhcx_emb_fsm_enable_t *val)
+int32_t ism330dhcx_sh_syncro_mode_set(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_start_config_t val)
 {
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_ENABLE_A,
-                              (uint8_t *)&val->fsm_enable_a, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_ENABLE_B,
-                              (uint8_t *)&val->fsm_enable_b, 1);
+    master_config.start_config = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
@@ -9948,31 +14353,32 @@ int32_t ism330dhcx_fsm_enable_get(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM long counter status register. Long counter value is an
-  *         unsigned integer value (16-bit format).[set]
+  * @brief  Sensor hub trigger signal selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
+  * @param  val    Get the values of start_config in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_long_cnt_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t ism330dhcx_sh_syncro_mode_get(const stmdev_ctx_t *ctx,
+                                      ism330dhcx_start_config_t *val)
 {
-  uint8_t buff[2];
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_L, buff,
-                               2);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
@@ -9980,31 +14386,55 @@ int32_t ism330dhcx_long_cnt_set(const stmdev_ctx_t *ctx, uint16_t val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  switch (master_config.start_config)
+  {
+    case ISM330DHCX_EXT_ON_INT2_PIN:
+      *val = ISM330DHCX_EXT_ON_INT2_PIN;
+      break;
+
+    case ISM330DHCX_XL_GY_DRDY:
+      *val = ISM330DHCX_XL_GY_DRDY;
+      break;
+
+    default:
+      *val = ISM330DHCX_EXT_ON_INT2_PIN;
+      break;
+  }
+
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM long counter status register. Long counter value is an
-  *         unsigned integer value (16-bit format).[get]
+  * @brief  Slave 0 write operation is performed only at the first sensor
+  *         hub cycle.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
+  * @param  val    Change the values of write_once in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_long_cnt_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t ism330dhcx_sh_write_mode_set(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_write_once_t val)
 {
-  uint8_t buff[2];
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_L, buff,
-                              2);
-    *val = buff[1];
-    *val = (*val * 256U) +  buff[0];
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    master_config.write_once = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
@@ -10012,115 +14442,126 @@ int32_t ism330dhcx_long_cnt_get(const stmdev_ctx_t *ctx, uint16_t *val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Clear FSM long counter value.[set]
+  * @brief  Slave 0 write operation is performed only at the first sensor
+  *         hub cycle.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fsm_lc_clr in reg
-  *                FSM_LONG_COUNTER_CLEAR
+  * @param  val    Get the values of write_once in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_long_clr_set(const stmdev_ctx_t *ctx,
-                                ism330dhcx_fsm_lc_clr_t val)
+int32_t ism330dhcx_sh_write_mode_get(const stmdev_ctx_t *ctx,
+                                     ism330dhcx_write_once_t *val)
 {
-  ism330dhcx_fsm_long_counter_clear_t fsm_long_counter_clear;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_CLEAR,
-                              (uint8_t *)&fsm_long_counter_clear, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    fsm_long_counter_clear.fsm_lc_clr = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_CLEAR,
-                               (uint8_t *)&fsm_long_counter_clear, 1);
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  switch (master_config.write_once)
+  {
+    case ISM330DHCX_EACH_SH_CYCLE:
+      *val = ISM330DHCX_EACH_SH_CYCLE;
+      break;
+
+    case ISM330DHCX_ONLY_FIRST_CYCLE:
+      *val = ISM330DHCX_ONLY_FIRST_CYCLE;
+      break;
+
+    default:
+      *val = ISM330DHCX_EACH_SH_CYCLE;
+      break;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Clear FSM long counter value.[get]
+  * @brief  Reset Master logic and output registers.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fsm_lc_clr in reg  FSM_LONG_COUNTER_CLEAR
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_long_clr_get(const stmdev_ctx_t *ctx,
-                                ism330dhcx_fsm_lc_clr_t *val)
+int32_t ism330dhcx_sh_reset_set(const stmdev_ctx_t *ctx)
 {
-  ism330dhcx_fsm_long_counter_clear_t fsm_long_counter_clear;
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_LONG_COUNTER_CLEAR,
-                              (uint8_t *)&fsm_long_counter_clear, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    master_config.rst_master_regs = PROPERTY_ENABLE;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
   }
 
-  switch (fsm_long_counter_clear.fsm_lc_clr)
+  if (ret == 0)
   {
-    case ISM330DHCX_LC_NORMAL:
-      *val = ISM330DHCX_LC_NORMAL;
-      break;
-
-    case ISM330DHCX_LC_CLEAR:
-      *val = ISM330DHCX_LC_CLEAR;
-      break;
-
-    case ISM330DHCX_LC_CLEAR_DONE:
-      *val = ISM330DHCX_LC_CLEAR_DONE;
-      break;
+    master_config.rst_master_regs = PROPERTY_DISABLE;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                               (uint8_t *)&master_config, 1);
+  }
 
-    default:
-      *val = ISM330DHCX_LC_NORMAL;
-      break;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM output registers.[get]
+  * @brief  Reset Master logic and output registers.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers from FSM_OUTS1 to FSM_OUTS16
+  * @param  val    Change the values of rst_master_regs in reg MASTER_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_out_get(const stmdev_ctx_t *ctx,
-                               ism330dhcx_fsm_out_t *val)
+int32_t ism330dhcx_sh_reset_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
+  ism330dhcx_master_config_t master_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FSM_OUTS1,
-                              (uint8_t *)&val->fsm_outs1, 16);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
+                              (uint8_t *)&master_config, 1);
+    *val = master_config.rst_master_regs;
   }
 
   if (ret == 0)
@@ -10128,38 +14569,39 @@ int32_t ism330dhcx_fsm_out_get(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Finite State Machine ODR configuration.[set]
+  * @brief  Rate at which the master communicates.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fsm_odr in reg EMB_FUNC_ODR_CFG_B
+  * @param  val    Change the values of shub_odr in reg SLV0_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_data_rate_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_fsm_odr_t val)
+int32_t ism330dhcx_sh_data_rate_set(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_shub_odr_t val)
 {
-  ism330dhcx_emb_func_odr_cfg_b_t emb_func_odr_cfg_b;
+  ism330dhcx_slv0_config_t slv0_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B,
-                              (uint8_t *)&emb_func_odr_cfg_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                              (uint8_t *)&slv0_config, 1);
   }
 
   if (ret == 0)
   {
-    emb_func_odr_cfg_b.not_used_01 = 3; /* set default values */
-    emb_func_odr_cfg_b.not_used_02 = 1; /* set default values */
-    emb_func_odr_cfg_b.fsm_odr = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B,
-                               (uint8_t *)&emb_func_odr_cfg_b, 1);
+    slv0_config.shub_odr = (uint8_t)val;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                               (uint8_t *)&slv0_config, 1);
   }
 
   if (ret == 0)
@@ -10167,29 +14609,32 @@ int32_t ism330dhcx_fsm_data_rate_set(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Finite State Machine ODR configuration.[get]
+  * @brief  Rate at which the master communicates.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fsm_odr in reg EMB_FUNC_ODR_CFG_B
+  * @param  val    Get the values of shub_odr in reg slv1_CONFIG
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_data_rate_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_fsm_odr_t *val)
+int32_t ism330dhcx_sh_data_rate_get(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_shub_odr_t *val)
 {
-  ism330dhcx_emb_func_odr_cfg_b_t emb_func_odr_cfg_b;
+  ism330dhcx_slv0_config_t slv0_config;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_B,
-                              (uint8_t *)&emb_func_odr_cfg_b, 1);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                              (uint8_t *)&slv0_config, 1);
   }
 
   if (ret == 0)
@@ -10197,58 +14642,72 @@ int32_t ism330dhcx_fsm_data_rate_get(const stmdev_ctx_t *ctx,
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
-  switch (emb_func_odr_cfg_b.fsm_odr)
+  switch (slv0_config.shub_odr)
   {
-    case ISM330DHCX_ODR_FSM_12Hz5:
-      *val = ISM330DHCX_ODR_FSM_12Hz5;
+    case ISM330DHCX_SH_ODR_104Hz:
+      *val = ISM330DHCX_SH_ODR_104Hz;
       break;
 
-    case ISM330DHCX_ODR_FSM_26Hz:
-      *val = ISM330DHCX_ODR_FSM_26Hz;
+    case ISM330DHCX_SH_ODR_52Hz:
+      *val = ISM330DHCX_SH_ODR_52Hz;
       break;
 
-    case ISM330DHCX_ODR_FSM_52Hz:
-      *val = ISM330DHCX_ODR_FSM_52Hz;
+    case ISM330DHCX_SH_ODR_26Hz:
+      *val = ISM330DHCX_SH_ODR_26Hz;
       break;
 
-    case ISM330DHCX_ODR_FSM_104Hz:
-      *val = ISM330DHCX_ODR_FSM_104Hz;
+    case ISM330DHCX_SH_ODR_13Hz:
+      *val = ISM330DHCX_SH_ODR_13Hz;
       break;
 
     default:
-      *val = ISM330DHCX_ODR_FSM_12Hz5;
+      *val = ISM330DHCX_SH_ODR_104Hz;
       break;
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM initialization request.[set]
+  * @brief  Configure slave 0 for perform a write.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fsm_init in reg FSM_INIT
+  * @param  val    Structure that contain
+  *                - uint8_t slv0_add;    8 bit i2c device address
+  *                - uint8_t slv0_subadd; 8 bit register device address
+  *                - uint8_t slv0_data;   8 bit data to write
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_init_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_sh_cfg_write(const stmdev_ctx_t *ctx,
+                                ism330dhcx_sh_cfg_write_t *val)
 {
-  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  ism330dhcx_slv0_add_t slv0_add;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                              (uint8_t *)&emb_func_init_b, 1);
+    slv0_add.slave0 = (uint8_t)(val->slv0_add >> 1);
+    slv0_add.rw_0 = 0;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_ADD,
+                               (uint8_t *) & (slv0_add), 1);
   }
 
   if (ret == 0)
   {
-    emb_func_init_b.fsm_init = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                               (uint8_t *)&emb_func_init_b, 1);
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_SUBADD,
+                               (uint8_t *) & (val->slv0_subadd), 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_DATAWRITE_SLV0,
+                               (uint8_t *) & (val->slv0_data), 1);
   }
 
   if (ret == 0)
@@ -10256,199 +14715,272 @@ int32_t ism330dhcx_fsm_init_set(const stmdev_ctx_t *ctx, uint8_t val)
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM initialization request.[get]
+  * @brief Configure slave 0 for perform a write/read.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fsm_init in reg FSM_INIT
+  * @param  val    Structure that contain
+  *                - uint8_t slv_add;    8 bit i2c device address
+  *                - uint8_t slv_subadd; 8 bit register device address
+  *                - uint8_t slv_len;    num of bit to read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_init_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_sh_slv0_cfg_read(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sh_cfg_read_t *val)
 {
-  ism330dhcx_emb_func_init_b_t emb_func_init_b;
+  ism330dhcx_slv0_config_t slv0_config;
+  ism330dhcx_slv0_add_t slv0_add;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                              (uint8_t *)&emb_func_init_b, 1);
+    slv0_add.slave0 = (uint8_t) val->slv_add >> 1;
+    slv0_add.rw_0 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_ADD,
+                               (uint8_t *) & (slv0_add), 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_SUBADD,
+                               &(val->slv_subadd), 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                              (uint8_t *)&slv0_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    slv0_config.slave0_numop = val->slv_len;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_CONFIG,
+                               (uint8_t *)&slv0_config, 1);
   }
 
   if (ret == 0)
   {
-    *val = emb_func_init_b.fsm_init;
     ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM long counter timeout register (r/w). The long counter
-  *         timeout value is an unsigned integer value (16-bit format).
-  *         When the long counter value reached this value, the FSM
-  *         generates an interrupt.[set]
+  * @brief  Configure slave 0 for perform a write/read.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
+  * @param  val    Structure that contain
+  *                - uint8_t slv_add;    8 bit i2c device address
+  *                - uint8_t slv_subadd; 8 bit register device address
+  *                - uint8_t slv_len;    num of bit to read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_long_cnt_int_value_set(const stmdev_ctx_t *ctx,
-                                          uint16_t val)
+int32_t ism330dhcx_sh_slv1_cfg_read(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sh_cfg_read_t *val)
 {
-  uint8_t buff[2];
+  ism330dhcx_slv1_config_t slv1_config;
+  ism330dhcx_slv1_add_t slv1_add;
   int32_t ret;
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_L,
-                                    &buff[0]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_H,
-                                      &buff[1]);
+    slv1_add.slave1_add = (uint8_t)(val->slv_add >> 1);
+    slv1_add.r_1 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_ADD,
+                               (uint8_t *)&slv1_add, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_SUBADD,
+                               &(val->slv_subadd), 1);
+  }
 
-/**
-  * @brief  FSM long counter timeout register (r/w). The long counter
-  *         timeout value is an unsigned integer value (16-bit format).
-  *         When the long counter value reached this value, the FSM generates
-  *         an interrupt.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_long_cnt_int_value_get(const stmdev_ctx_t *ctx,
-                                          uint16_t *val)
-{
-  uint8_t buff[2];
-  int32_t ret;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV1_CONFIG,
+                              (uint8_t *)&slv1_config, 1);
+  }
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_L,
-                                   &buff[0]);
+  if (ret == 0)
+  {
+    slv1_config.slave1_numop = val->slv_len;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_CONFIG,
+                               (uint8_t *)&slv1_config, 1);
+  }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_LC_TIMEOUT_H,
-                                     &buff[1]);
-    *val = buff[1];
-    *val = (*val * 256U) +  buff[0];
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM number of programs register.[set]
+  * @brief  Configure slave 2 for perform a write/read.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
+  * @param  val    Structure that contain
+  *                - uint8_t slv_add;    8 bit i2c device address
+  *                - uint8_t slv_subadd; 8 bit register device address
+  *                - uint8_t slv_len;    num of bit to read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_number_of_programs_set(const stmdev_ctx_t *ctx,
-                                              uint8_t *buff)
+int32_t ism330dhcx_sh_slv2_cfg_read(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sh_cfg_read_t *val)
 {
+  ism330dhcx_slv2_config_t slv2_config;
+  ism330dhcx_slv2_add_t slv2_add;
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_PROGRAMS, buff);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_write_byte(ctx,
-                                      ISM330DHCX_FSM_PROGRAMS + 0x01U,
-                                      buff);
+    slv2_add.slave2_add = (uint8_t)(val->slv_add >> 1);
+    slv2_add.r_2 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_ADD,
+                               (uint8_t *)&slv2_add, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_SUBADD,
+                               (uint8_t *) & (val->slv_subadd), 1);
+  }
 
-/**
-  * @brief  FSM number of programs register.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_fsm_number_of_programs_get(const stmdev_ctx_t *ctx,
-                                              uint8_t *buff)
-{
-  int32_t ret;
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV2_CONFIG,
+                              (uint8_t *)&slv2_config, 1);
+  }
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_PROGRAMS, buff);
+  if (ret == 0)
+  {
+    slv2_config.slave2_numop = val->slv_len;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_CONFIG,
+                               (uint8_t *)&slv2_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+  }
+
+  ism330dhcx_unlock(ctx);
 
   return ret;
 }
 
 /**
-  * @brief  FSM start address register (r/w). First available address is
-  *         0x033C.[set]
+  * @brief  Configure slave 3 for perform a write/read.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that contains data to write
+  * @param  val    Structure that contain
+  *                - uint8_t slv_add;    8 bit i2c device address
+  *                - uint8_t slv_subadd; 8 bit register device address
+  *                - uint8_t slv_len;    num of bit to read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_start_address_set(const stmdev_ctx_t *ctx,
-                                         uint16_t val)
+int32_t ism330dhcx_sh_slv3_cfg_read(const stmdev_ctx_t *ctx,
+                                    ism330dhcx_sh_cfg_read_t *val)
 {
-  uint8_t buff[2];
+  ism330dhcx_slv3_config_t slv3_config;
+  ism330dhcx_slv3_add_t slv3_add;
   int32_t ret;
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_START_ADD_L,
-                                    &buff[0]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_FSM_START_ADD_H,
-                                      &buff[1]);
+    slv3_add.slave3_add = (uint8_t)(val->slv_add >> 1);
+    slv3_add.r_3 = 1;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_ADD,
+                               (uint8_t *)&slv3_add, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_SUBADD,
+                               &(val->slv_subadd), 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV3_CONFIG,
+                              (uint8_t *)&slv3_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    slv3_config.slave3_numop = val->slv_len;
+    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_CONFIG,
+                               (uint8_t *)&slv3_config, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  FSM start address register (r/w). First available address
-  *         is 0x033C.[get]
+  * @brief  Sensor hub source register.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
+  * @param  val    Registers from STATUS_MASTER
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_fsm_start_address_get(const stmdev_ctx_t *ctx,
-                                         uint16_t *val)
+int32_t ism330dhcx_sh_status_get(const stmdev_ctx_t *ctx,
+                                 ism330dhcx_status_master_t *val)
 {
-  uint8_t buff[2];
   int32_t ret;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_START_ADD_L,
-                                   &buff[0]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_FSM_START_ADD_H,
-                                     &buff[1]);
-    *val = buff[1];
-    *val = (*val * 256U) +  buff[0];
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_MASTER,
+                              (uint8_t *)val, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
@@ -10458,1255 +14990,1873 @@ int32_t ism330dhcx_fsm_start_address_get(const stmdev_ctx_t *ctx,
   */
 
 /**
-  * @addtogroup  Machine Learning Core
-  * @brief   This section group all the functions concerning the
-  *          usage of Machine Learning Core
+  * @defgroup   ISM330DHCX_Sample_ring
+  * @brief      This section groups the single-producer / single-consumer
+  *             ring of decoded FIFO samples.
   * @{
   *
   */
 
 /**
-  * @brief  Enable Machine Learning Core.[set]
+  * @brief  Initialize an empty sample ring.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      change the values of mlc_en in
-  *                  reg EMB_FUNC_EN_B and mlc_init
-  *                  in EMB_FUNC_INIT_B
+  * @param  ring   Sample ring.(ptr)
+  * @param  buf    Storage of len samples.(ptr)
+  * @param  len    Ring capacity, power of two
+  * @retval        0 -> no Error, -1 -> len is not a power of two
   *
   */
-int32_t ism330dhcx_mlc_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_ring_init(ism330dhcx_ring_t *ring,
+                             ism330dhcx_fifo_sample_t *buf, uint32_t len)
 {
-  ism330dhcx_emb_func_en_b_t reg;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
-
-  if (ret == 0)
+  if ((len == 0U) || ((len & (len - 1U)) != 0U))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                              (uint8_t *)&reg, 1);
+    return -1;
   }
 
-  if (ret == 0)
-  {
-    reg.mlc_en = val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                               (uint8_t *)&reg, 1);
-  }
+  ring->head = 0;
+  ring->tail = 0;
+  ring->overflow = 0;
+  ring->high_water = 0;
+  ring->buf = buf;
+  ring->mask = len - 1U;
 
-  if ((val != PROPERTY_DISABLE) && (ret == 0))
+  return 0;
+}
+
+/**
+  * @brief  Append a sample, producer side. When the ring is full the
+  *         sample is dropped and counted as overflow.
+  *
+  * @param  ring   Sample ring.(ptr)
+  * @param  val    Sample.(ptr)
+  * @retval        0 -> stored, -1 -> ring full
+  *
+  */
+int32_t ism330dhcx_ring_push(ism330dhcx_ring_t *ring,
+                             const ism330dhcx_fifo_sample_t *val)
+{
+  uint32_t head = ring->head;
+  uint32_t used = head - ring->tail;
+
+  if (used > ring->mask)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                              (uint8_t *)&reg, 1);
+    ring->overflow++;
 
-    if (ret == 0)
-    {
-      reg.mlc_en = val;
-      ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_INIT_B,
-                                 (uint8_t *)&reg, 1);
-    }
+    return -1;
   }
 
-  if (ret == 0)
+  ring->buf[head & ring->mask] = *val;
+  used++;
+
+  if (used > ring->high_water)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ring->high_water = used;
   }
 
-  return ret;
+  /* sample visible before the new head */
+  ISM330DHCX_RING_BARRIER();
+  ring->head = head + 1U;
+
+  return 0;
 }
 
 /**
-  * @brief  Enable Machine Learning Core.[get]
+  * @brief  Remove the oldest sample, consumer side.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Get the values of mlc_en in
-  *                  reg EMB_FUNC_EN_B
+  * @param  ring   Sample ring.(ptr)
+  * @param  val    Sample.(ptr)
+  * @retval        0 -> sample returned, -1 -> ring empty
   *
   */
-int32_t ism330dhcx_mlc_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t ism330dhcx_ring_pop(ism330dhcx_ring_t *ring,
+                            ism330dhcx_fifo_sample_t *val)
 {
-  ism330dhcx_emb_func_en_b_t reg;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  uint32_t tail = ring->tail;
 
-  if (ret == 0)
+  if (tail == ring->head)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B,
-                              (uint8_t *)&reg, 1);
+    return -1;
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-    *val  = reg.mlc_en;
-  }
+  /* head read before the sample */
+  ISM330DHCX_RING_BARRIER();
+  *val = ring->buf[tail & ring->mask];
 
-  return ret;
+  /* sample copied before the slot is released */
+  ISM330DHCX_RING_BARRIER();
+  ring->tail = tail + 1U;
+
+  return 0;
 }
 
 /**
-  * @brief  Machine Learning Core status register[get]
+  * @brief  Number of samples in the ring.[get]
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      register MLC_STATUS_MAINPAGE
+  * @param  ring   Sample ring.(ptr)
+  * @retval        Number of samples
   *
   */
-int32_t ism330dhcx_mlc_status_get(const stmdev_ctx_t *ctx,
-                                  ism330dhcx_mlc_status_mainpage_t *val)
+uint32_t ism330dhcx_ring_level_get(const ism330dhcx_ring_t *ring)
 {
-  return ism330dhcx_read_reg(ctx, ISM330DHCX_MLC_STATUS_MAINPAGE,
-                             (uint8_t *) val, 1);
+  return ring->head - ring->tail;
 }
 
 /**
-  * @brief  Machine Learning Core data rate selection.[set]
+  * @brief  Decompressor output routine storing samples in a ring, see
+  *         fifo_decomp_init.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      get the values of mlc_odr in
-  *                  reg EMB_FUNC_ODR_CFG_C
+  * @param  arg    Sample ring.(ptr)
+  * @param  val    Sample.(ptr)
   *
   */
-int32_t ism330dhcx_mlc_data_rate_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_mlc_odr_t val)
+void ism330dhcx_ring_sample_handler(void *arg,
+                                    const ism330dhcx_fifo_sample_t *val)
 {
-  ism330dhcx_emb_func_odr_cfg_c_t reg;
-  int32_t ret;
+  (void)ism330dhcx_ring_push((ism330dhcx_ring_t *)arg, val);
+}
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+/**
+  * @}
+  *
+  */
 
-  if (ret == 0)
+/**
+  * @defgroup   ISM330DHCX_Capture
+  * @brief      This section groups the functions that record raw FIFO
+  *             streams in the capture format and replay them.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Hand the chunk buffer to the sink, recording its offset.
+  *
+  * @param  cap    Capture writer.(ptr)
+  * @retval        Sink status (0 -> no Error).
+  *
+  */
+static int32_t ism330dhcx_cap_chunk(ism330dhcx_cap_t *cap)
+{
+  int32_t ret = 0;
+
+  if (cap->len == 0U)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_C,
-                              (uint8_t *)&reg, 1);
+    return 0;
   }
 
-  if (ret == 0)
-  {
-    reg.mlc_odr = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_C,
-                               (uint8_t *)&reg, 1);
+  if ((cap->index != NULL) && (cap->index_len < cap->index_max))
+  {
+    cap->index[cap->index_len] = cap->offset;
+    cap->index_len++;
   }
 
-  if (ret == 0)
+  ret = cap->write(cap->handle, cap->buf, cap->len);
+
+  if (ret != 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    cap->errors++;
   }
 
+  cap->offset += cap->len;
+  cap->len = 0;
+
   return ret;
 }
 
 /**
-  * @brief  Machine Learning Core data rate selection.[get]
+  * @brief  Append a record, payload given in two parts.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      change the values of mlc_odr in
-  *                  reg EMB_FUNC_ODR_CFG_C
+  * @param  cap    Capture writer.(ptr)
+  * @param  type   Record type
+  * @param  dev    Device identifier
+  * @param  p0     First part of the payload.(ptr)
+  * @param  l0     Length of p0
+  * @param  p1     Second part of the payload, may be NULL.(ptr)
+  * @param  l1     Length of p1
+  * @retval        Sink status (0 -> no Error).
   *
   */
-int32_t ism330dhcx_mlc_data_rate_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_mlc_odr_t *val)
+static int32_t ism330dhcx_cap_record(ism330dhcx_cap_t *cap,
+                                     ism330dhcx_cap_rec_t type, uint8_t dev,
+                                     const uint8_t *p0, uint16_t l0,
+                                     const uint8_t *p1, uint16_t l1)
 {
-  ism330dhcx_emb_func_odr_cfg_c_t reg;
-  int32_t ret;
+  uint32_t total = ISM330DHCX_CAP_REC_LEN + (uint32_t)l0 + (uint32_t)l1;
+  uint32_t len = (uint32_t)l0 + (uint32_t)l1;
+  uint8_t rec[ISM330DHCX_CAP_REC_LEN];
+  uint16_t i;
+  int32_t ret = 0;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  rec[0] = (uint8_t)type;
+  rec[1] = dev;
+  rec[2] = (uint8_t)(len & 0xFFU);
+  rec[3] = (uint8_t)(len >> 8);
 
-  if (ret == 0)
+  if ((cap->len + total) > cap->size)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_ODR_CFG_C,
-                              (uint8_t *)&reg, 1);
+    ret = ism330dhcx_cap_chunk(cap);
   }
 
-  if (ret == 0)
+  if (total > cap->size)
   {
-    switch (reg.mlc_odr)
+    /* larger than a chunk: a chunk of its own, written in place */
+    if ((cap->index != NULL) && (cap->index_len < cap->index_max))
     {
-      case ISM330DHCX_ODR_PRGS_12Hz5:
-        *val = ISM330DHCX_ODR_PRGS_12Hz5;
-        break;
+      cap->index[cap->index_len] = cap->offset;
+      cap->index_len++;
+    }
 
-      case ISM330DHCX_ODR_PRGS_26Hz:
-        *val = ISM330DHCX_ODR_PRGS_26Hz;
-        break;
+    if (ret == 0)
+    {
+      ret = cap->write(cap->handle, rec, ISM330DHCX_CAP_REC_LEN);
+    }
 
-      case ISM330DHCX_ODR_PRGS_52Hz:
-        *val = ISM330DHCX_ODR_PRGS_52Hz;
-        break;
+    if ((ret == 0) && (l0 != 0U))
+    {
+      ret = cap->write(cap->handle, p0, l0);
+    }
 
-      case ISM330DHCX_ODR_PRGS_104Hz:
-        *val = ISM330DHCX_ODR_PRGS_104Hz;
-        break;
+    if ((ret == 0) && (l1 != 0U))
+    {
+      ret = cap->write(cap->handle, p1, l1);
+    }
 
-      default:
-        *val = ISM330DHCX_ODR_PRGS_12Hz5;
-        break;
+    if (ret != 0)
+    {
+      cap->errors++;
     }
 
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    cap->offset += total;
+
+    return ret;
+  }
+
+  for (i = 0; i < ISM330DHCX_CAP_REC_LEN; i++)
+  {
+    cap->buf[cap->len] = rec[i];
+    cap->len++;
+  }
+
+  for (i = 0; i < l0; i++)
+  {
+    cap->buf[cap->len] = p0[i];
+    cap->len++;
+  }
+
+  for (i = 0; i < l1; i++)
+  {
+    cap->buf[cap->len] = p1[i];
+    cap->len++;
   }
 
   return ret;
 }
 
 /**
-  * @brief  prgsens_out: [get] Output value of all MLCx decision trees.
+  * @brief  Start a capture: the HEADER record opens the stream.
   *
-  * @param  ctx_t *ctx: read / write interface definitions
-  * @param  uint8_t * : buffer that stores data read
+  * @param  cap        Capture writer.(ptr)
+  * @param  write      Sink of the capture bytes.(ptr)
+  * @param  handle     Sink handle, e.g. a file.(ptr)
+  * @param  buf        Chunk buffer; the larger, the fewer sink calls.(ptr)
+  * @param  size       Size of buf, at least ISM330DHCX_CAP_REC_LEN + 8
+  * @param  index      Chunk offsets storage, or NULL for no index.(ptr)
+  * @param  index_max  Number of offsets index can hold; further chunks
+  *                    are not indexed
+  * @retval            0 -> no Error, -1 -> buffer too small
   *
   */
-int32_t ism330dhcx_mlc_out_get(const stmdev_ctx_t *ctx, uint8_t *buff)
+int32_t ism330dhcx_cap_init(ism330dhcx_cap_t *cap,
+                            ism330dhcx_cap_write_ptr write, void *handle,
+                            uint8_t *buf, uint32_t size,
+                            uint32_t *index, uint32_t index_max)
 {
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_EMBEDDED_FUNC_BANK);
+  const uint8_t magic[5] = { 0x49U, 0x53U, 0x4DU, 0x43U,
+                             (uint8_t)ISM330DHCX_CAP_VERSION
+                           };
 
-  if (ret == 0)
+  if (size < (ISM330DHCX_CAP_REC_LEN + 8U))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MLC0_SRC, buff, 8);
+    return -1;
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  cap->write = write;
+  cap->handle = handle;
+  cap->buf = buf;
+  cap->size = size;
+  cap->len = 0;
+  cap->offset = 0;
+  cap->index = index;
+  cap->index_max = index_max;
+  cap->index_len = 0;
+  cap->errors = 0;
 
-  return ret;
+  return ism330dhcx_cap_record(cap, ISM330DHCX_CAP_HEADER, 0, magic, 5,
+                               NULL, 0);
 }
 
 /**
-  * @brief  External magnetometer sensitivity value register for
-  *         Machine Learning Core.[set]
+  * @brief  Append a CONFIG record with a snapshot of the device
+  *         configuration: control registers (ODR, FS, FIFO, batching,
+  *         compression rate, offsets, trim) and EMB_FUNC_EN_B
+  *         (compression enable). Registers with read side effects
+  *         (sources, outputs, FIFO data) are not read.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  buff     buffer that contains data to write
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  cap    Capture writer.(ptr)
+  * @param  dev    Device identifier
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_mlc_mag_sensitivity_set(const stmdev_ctx_t *ctx,
-                                           uint16_t val)
+int32_t ism330dhcx_cap_config(const stmdev_ctx_t *ctx, ism330dhcx_cap_t *cap,
+                              uint8_t dev)
 {
-  uint8_t buff[2];
+  uint8_t buff[ISM330DHCX_CAP_CFG_LEN];
   int32_t ret;
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_L,
-                                    &buff[0]);
+  ism330dhcx_lock(ctx);
+  ret = ism330dhcx_read_reg(ctx, ISM330DHCX_FUNC_CFG_ACCESS, &buff[0], 25);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_ln_pg_write_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_H,
-                                      &buff[1]);
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_TAP_CFG0, &buff[25], 32);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_emb_session_start(ctx);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_EMB_FUNC_EN_B, &buff[57], 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_emb_session_stop(ctx);
+  }
+
+  if (ret == 0)
+  {
+    ret = ism330dhcx_cap_record(cap, ISM330DHCX_CAP_CONFIG, dev, buff,
+                                (uint16_t)ISM330DHCX_CAP_CFG_LEN, NULL, 0);
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  External magnetometer sensitivity value register for
-  *         Machine Learning Core.[get]
+  * @brief  Append raw FIFO words, as read with fifo_out_multi_raw_get.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  buff     buffer that stores data read
+  * @param  cap    Capture writer.(ptr)
+  * @param  dev    Device identifier
+  * @param  buff   FIFO words.(ptr)
+  * @param  num    Number of words
+  * @retval        Sink status (0 -> no Error).
   *
   */
-int32_t ism330dhcx_mlc_mag_sensitivity_get(const stmdev_ctx_t *ctx,
-                                           uint16_t *val)
+int32_t ism330dhcx_cap_words(ism330dhcx_cap_t *cap, uint8_t dev,
+                             const uint8_t *buff, uint16_t num)
 {
-  uint8_t buff[2];
-  int32_t ret;
+  uint16_t left = num;
+  uint16_t n;
+  int32_t ret = 0;
 
-  ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_L,
-                                   &buff[0]);
-
-  if (ret == 0)
+  while ((left > 0U) && (ret == 0))
   {
-    ret = ism330dhcx_ln_pg_read_byte(ctx, ISM330DHCX_MLC_MAG_SENSITIVITY_H,
-                                     &buff[1]);
-    *val = buff[1];
-    *val = (*val * 256U) +  buff[0];
+    n = (left > ISM330DHCX_CAP_WORDS_MAX) ? ISM330DHCX_CAP_WORDS_MAX : left;
+    ret = ism330dhcx_cap_record(cap, ISM330DHCX_CAP_WORDS, dev,
+                                &buff[(uint32_t)(num - left) *
+                                      ISM330DHCX_FIFO_WORD_LEN],
+                                (uint16_t)(n * ISM330DHCX_FIFO_WORD_LEN),
+                                NULL, 0);
+    left -= n;
   }
 
   return ret;
 }
 
 /**
-  * @}
+  * @brief  Hand the buffered records to the sink.
   *
-  */
-
-/**
-  * @defgroup   ISM330DHCX_Sensor_hub
-  * @brief      This section groups all the functions that manage the
-  *             sensor hub.
-  * @{
+  * @param  cap    Capture writer.(ptr)
+  * @retval        Sink status (0 -> no Error).
   *
   */
+int32_t ism330dhcx_cap_flush(ism330dhcx_cap_t *cap)
+{
+  return ism330dhcx_cap_chunk(cap);
+}
 
 /**
-  * @brief  Sensor hub output registers.[get]
+  * @brief  Terminate a capture with the INDEX and END records.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure of registers from SENSOR_HUB_1 to SENSOR_HUB_18
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  cap    Capture writer.(ptr)
+  * @retval        Sink status (0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_read_data_raw_get(const stmdev_ctx_t *ctx,
-                                        ism330dhcx_emb_sh_read_t *val,
-                                        uint8_t len)
+int32_t ism330dhcx_cap_close(ism330dhcx_cap_t *cap)
 {
+  uint8_t off[ISM330DHCX_CAP_REC_LEN + 4U];
+  uint8_t entry[4];
+  uint32_t at;
+  uint32_t i;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ret = ism330dhcx_cap_chunk(cap);
+  at = cap->offset;
 
-  if (ret == 0)
+  /* INDEX record streamed straight to the sink */
+  entry[0] = (uint8_t)ISM330DHCX_CAP_INDEX;
+  entry[1] = 0;
+  entry[2] = (uint8_t)((cap->index_len * 4U) & 0xFFU);
+  entry[3] = (uint8_t)((cap->index_len * 4U) >> 8);
+
+  if (cap->index_len > (0xFFFFU / 4U))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SENSOR_HUB_1,
-                              (uint8_t *)val, len);
+    cap->index_len = 0xFFFFU / 4U;
+    entry[2] = 0xFCU;
+    entry[3] = 0xFFU;
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ret = cap->write(cap->handle, entry, 4);
   }
 
-  return ret;
-}
+  for (i = 0; (i < cap->index_len) && (ret == 0); i++)
+  {
+    entry[0] = (uint8_t)(cap->index[i] & 0xFFU);
+    entry[1] = (uint8_t)((cap->index[i] >> 8) & 0xFFU);
+    entry[2] = (uint8_t)((cap->index[i] >> 16) & 0xFFU);
+    entry[3] = (uint8_t)(cap->index[i] >> 24);
+    ret = cap->write(cap->handle, entry, 4);
+  }
 
-/**
-  * @brief  Number of external sensors to be read by the sensor hub.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of aux_sens_on in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_sh_slave_connected_set(const stmdev_ctx_t *ctx,
-                                          ism330dhcx_aux_sens_on_t val)
-{
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
+  cap->offset += 4U + (cap->index_len * 4U);
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  /* END record streamed too, so that it is not indexed after INDEX */
+  off[0] = (uint8_t)ISM330DHCX_CAP_END;
+  off[1] = 0;
+  off[2] = 4;
+  off[3] = 0;
+  off[4] = (uint8_t)(at & 0xFFU);
+  off[5] = (uint8_t)((at >> 8) & 0xFFU);
+  off[6] = (uint8_t)((at >> 16) & 0xFFU);
+  off[7] = (uint8_t)(at >> 24);
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    ret = cap->write(cap->handle, off, ISM330DHCX_CAP_REC_LEN + 4U);
   }
 
-  if (ret == 0)
-  {
-    master_config.aux_sens_on = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
-  }
+  cap->offset += ISM330DHCX_CAP_REC_LEN + 4U;
 
-  if (ret == 0)
+  if (ret != 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    cap->errors++;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Number of external sensors to be read by the sensor hub.[get]
+  * @brief  Replay a capture held in memory: the WORDS records of a
+  *         device go through the FIFO decoder as if just drained, the
+  *         CONFIG records to cfg. Replay stops at the END record.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of aux_sens_on in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  buff   Capture bytes, from the start or from an index
+  *                offset.(ptr)
+  * @param  len    Number of bytes
+  * @param  dev    Device identifier to replay
+  * @param  dec    FIFO decoder.(ptr)
+  * @param  cfg    Routine receiving device and ISM330DHCX_CAP_CFG_LEN
+  *                configuration bytes, or NULL.(ptr)
+  * @param  arg    Argument of cfg.(ptr)
+  * @retval        0 -> no Error, -1 -> truncated or malformed capture
   *
   */
-int32_t ism330dhcx_sh_slave_connected_get(const stmdev_ctx_t *ctx,
-                                          ism330dhcx_aux_sens_on_t *val)
+int32_t ism330dhcx_cap_replay(const uint8_t *buff, uint32_t len, uint8_t dev,
+                              ism330dhcx_fifo_decoder_t *dec,
+                              ism330dhcx_cap_cfg_ptr cfg, void *arg)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  uint32_t pos = 0;
+  uint32_t size;
+  uint8_t type;
 
-  if (ret == 0)
+  while ((pos + ISM330DHCX_CAP_REC_LEN) <= len)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
-  }
+    type = buff[pos];
+    size = (uint32_t)buff[pos + 3U];
+    size = (size * 256U) + (uint32_t)buff[pos + 2U];
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+    if ((pos + ISM330DHCX_CAP_REC_LEN + size) > len)
+    {
+      return -1;
+    }
 
-  switch (master_config.aux_sens_on)
-  {
-    case ISM330DHCX_SLV_0:
-      *val = ISM330DHCX_SLV_0;
-      break;
+    if (type == (uint8_t)ISM330DHCX_CAP_END)
+    {
+      return 0;
+    }
 
-    case ISM330DHCX_SLV_0_1:
-      *val = ISM330DHCX_SLV_0_1;
-      break;
+    if (buff[pos + 1U] == dev)
+    {
+      if (type == (uint8_t)ISM330DHCX_CAP_WORDS)
+      {
+        (void)ism330dhcx_fifo_decode(dec, &buff[pos + ISM330DHCX_CAP_REC_LEN],
+                                     (uint16_t)(size /
+                                                ISM330DHCX_FIFO_WORD_LEN));
+      }
 
-    case ISM330DHCX_SLV_0_1_2:
-      *val = ISM330DHCX_SLV_0_1_2;
-      break;
+      else if ((type == (uint8_t)ISM330DHCX_CAP_CONFIG) && (cfg != NULL) &&
+               (size == ISM330DHCX_CAP_CFG_LEN))
+      {
+        cfg(arg, dev, &buff[pos + ISM330DHCX_CAP_REC_LEN]);
+      }
 
-    case ISM330DHCX_SLV_0_1_2_3:
-      *val = ISM330DHCX_SLV_0_1_2_3;
-      break;
+      else
+      {
+        /* other records skipped */
+      }
+    }
 
-    default:
-      *val = ISM330DHCX_SLV_0;
-      break;
+    pos += ISM330DHCX_CAP_REC_LEN + size;
   }
 
-  return ret;
+  return (pos == len) ? 0 : -1;
 }
 
 /**
-  * @brief  Sensor hub I2C master enable.[set]
+  * @brief  Refill the replayed FIFO with the next WORDS record of the
+  *         device once the current one is drained and, in real time,
+  *         the record period elapsed. CONFIG records met on the way
+  *         update the register image.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of master_on in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  rp     Replay backend.(ptr)
   *
   */
-int32_t ism330dhcx_sh_master_set(const stmdev_ctx_t *ctx, uint8_t val)
+static void ism330dhcx_replay_load(ism330dhcx_replay_t *rp)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  const uint8_t *rec;
+  uint32_t size;
+  uint8_t i;
 
-  if (ret == 0)
+  if (rp->next < rp->num)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    return;
   }
 
-  if (ret == 0)
+  if (rp->period != 0U)
   {
-    master_config.master_on = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
+    if ((rp->tick_get() - rp->release) < rp->period)
+    {
+      return;
+    }
+
+    rp->release += rp->period;
   }
 
-  if (ret == 0)
+  rp->num = 0;
+  rp->next = 0;
+  rp->byte = 0;
+
+  while (((rp->pos + ISM330DHCX_CAP_REC_LEN) <= rp->len) && (rp->num == 0U))
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+    rec = &rp->buff[rp->pos];
+    size = (uint32_t)rec[3];
+    size = (size * 256U) + (uint32_t)rec[2];
+
+    if ((rec[0] == (uint8_t)ISM330DHCX_CAP_END) ||
+        ((rp->pos + ISM330DHCX_CAP_REC_LEN + size) > rp->len))
+    {
+      rp->pos = rp->len;
+
+      return;
+    }
+
+    if ((rec[1] == rp->dev) && (rec[0] == (uint8_t)ISM330DHCX_CAP_WORDS))
+    {
+      rp->words = &rec[ISM330DHCX_CAP_REC_LEN];
+      rp->num = (uint16_t)(size / ISM330DHCX_FIFO_WORD_LEN);
+    }
+
+    else if ((rec[1] == rp->dev) &&
+             (rec[0] == (uint8_t)ISM330DHCX_CAP_CONFIG) &&
+             (size == ISM330DHCX_CAP_CFG_LEN))
+    {
+      for (i = 0; i < 25U; i++)
+      {
+        rp->reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS + i] =
+          rec[ISM330DHCX_CAP_REC_LEN + i];
+      }
+
+      for (i = 0; i < 32U; i++)
+      {
+        rp->reg[ISM330DHCX_USER_BANK][ISM330DHCX_TAP_CFG0 + i] =
+          rec[ISM330DHCX_CAP_REC_LEN + 25U + i];
+      }
+    }
+
+    else
+    {
+      /* other records skipped */
+    }
 
-  return ret;
+    rp->pos += ISM330DHCX_CAP_REC_LEN + size;
+  }
 }
 
 /**
-  * @brief  Sensor hub I2C master enable.[get]
+  * @brief  Register bank addressed by an access: FUNC_CFG_ACCESS is
+  *         reachable from every bank and kept in the user image.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of master_on in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  rp     Replay backend.(ptr)
+  * @param  addr   Register address
+  * @retval        ism330dhcx_reg_access_t value
   *
   */
-int32_t ism330dhcx_sh_master_get(const stmdev_ctx_t *ctx, uint8_t *val)
+static uint8_t ism330dhcx_replay_bank(const ism330dhcx_replay_t *rp,
+                                      uint8_t addr)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
+  const ism330dhcx_func_cfg_access_t *func_cfg_access =
+    (const ism330dhcx_func_cfg_access_t *)
+    &rp->reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS];
+  uint8_t ret = (uint8_t)ISM330DHCX_SENSOR_HUB_BANK;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  if ((addr == ISM330DHCX_FUNC_CFG_ACCESS) ||
+      (func_cfg_access->reg_access == (uint8_t)ISM330DHCX_USER_BANK))
+  {
+    ret = (uint8_t)ISM330DHCX_USER_BANK;
+  }
 
-  if (ret == 0)
+  else if (func_cfg_access->reg_access ==
+           (uint8_t)ISM330DHCX_EMBEDDED_FUNC_BANK)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    ret = (uint8_t)ISM330DHCX_EMBEDDED_FUNC_BANK;
   }
 
-  if (ret == 0)
+  else
   {
-    *val = master_config.master_on;
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    /* sensor hub bank */
   }
 
   return ret;
 }
 
 /**
-  * @brief  Master I2C pull-up enable.[set]
+  * @brief  Initialize a replay backend over a capture held in memory.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of shub_pu_en in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  rp        Replay backend.(ptr)
+  * @param  buff      Capture bytes.(ptr)
+  * @param  len       Number of bytes
+  * @param  dev       Device identifier to replay
+  * @param  tick_get  Time base for real-time replay, or NULL.(ptr)
+  * @param  period    Ticks between two WORDS records (the drain period
+  *                   of the recording), 0 -> maximum speed
+  * @retval           0 -> no Error
   *
   */
-int32_t ism330dhcx_sh_pin_mode_set(const stmdev_ctx_t *ctx,
-                                   ism330dhcx_shub_pu_en_t val)
+int32_t ism330dhcx_replay_init(ism330dhcx_replay_t *rp, const uint8_t *buff,
+                               uint32_t len, uint8_t dev,
+                               ism330dhcx_tick_get_ptr tick_get,
+                               uint32_t period)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  uint8_t bank;
+  uint8_t i;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+  rp->buff = buff;
+  rp->len = len;
+  rp->pos = 0;
+  rp->words = NULL;
+  rp->num = 0;
+  rp->next = 0;
+  rp->byte = 0;
+  rp->dev = dev;
+  rp->tick_get = tick_get;
+  rp->period = 0;
+  rp->release = (tick_get != NULL) ? tick_get() : 0U;
+  rp->words_out = 0;
+
+  for (bank = 0; bank < 3U; bank++)
+  {
+    for (i = 0; i < 0x80U; i++)
+    {
+      rp->reg[bank][i] = 0;
+    }
   }
 
-  if (ret == 0)
-  {
-    master_config.shub_pu_en = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
-  }
+  rp->reg[ISM330DHCX_USER_BANK][ISM330DHCX_WHO_AM_I] = ISM330DHCX_ID;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  /* leading CONFIG records applied, first record available at once */
+  ism330dhcx_replay_load(rp);
+  rp->period = (tick_get != NULL) ? period : 0U;
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Master I2C pull-up enable.[get]
+  * @brief  Replay backend read routine (stmdev_ctx_t.read_reg).
+  *         In the user bank, FIFO_STATUS1/2 report the words left in
+  *         the current record (the next one is loaded by any status
+  *         read once it is drained) and FIFO_DATA_OUT_TAG..Z_H pop them
+  *         with the device address roll-back; the other registers come
+  *         from the image of the selected bank.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of shub_pu_en in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  handle  Replay backend.(ptr)
+  * @param  reg     First register address
+  * @param  data    Buffer that stores data read.(ptr)
+  * @param  len     Number of consecutive registers to read
+  * @retval         0 -> no Error
   *
   */
-int32_t ism330dhcx_sh_pin_mode_get(const stmdev_ctx_t *ctx,
-                                   ism330dhcx_shub_pu_en_t *val)
+int32_t ism330dhcx_replay_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                   uint16_t len)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
+  ism330dhcx_replay_t *rp = (ism330dhcx_replay_t *)handle;
+  uint16_t level;
+  uint16_t i;
+  uint8_t bank = ism330dhcx_replay_bank(rp, reg);
+  uint8_t fifo;
+  uint8_t addr;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  fifo = ((bank == (uint8_t)ISM330DHCX_USER_BANK) &&
+          (reg >= ISM330DHCX_FIFO_DATA_OUT_TAG)) ? 1U : 0U;
 
-  if (ret == 0)
+  if ((bank == (uint8_t)ISM330DHCX_USER_BANK) &&
+      (reg <= ISM330DHCX_FIFO_STATUS2) &&
+      (((uint16_t)reg + len) > ISM330DHCX_FIFO_STATUS1))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    ism330dhcx_replay_load(rp);
   }
 
-  if (ret == 0)
+  level = rp->num - rp->next;
+
+  if (fifo == 1U)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    rp->byte = (uint8_t)(reg - ISM330DHCX_FIFO_DATA_OUT_TAG) %
+               ISM330DHCX_FIFO_WORD_LEN;
   }
 
-  switch (master_config.shub_pu_en)
+  for (i = 0; i < len; i++)
   {
-    case ISM330DHCX_EXT_PULL_UP:
-      *val = ISM330DHCX_EXT_PULL_UP;
-      break;
+    addr = (uint8_t)((reg + i) & 0x7FU);
 
-    case ISM330DHCX_INTERNAL_PULL_UP:
-      *val = ISM330DHCX_INTERNAL_PULL_UP;
-      break;
+    if (fifo == 1U)
+    {
+      data[i] = 0;
 
-    default:
-      *val = ISM330DHCX_EXT_PULL_UP;
-      break;
+      if (rp->next < rp->num)
+      {
+        data[i] = rp->words[((uint32_t)rp->next * ISM330DHCX_FIFO_WORD_LEN) +
+                            rp->byte];
+      }
+
+      rp->byte++;
+
+      if (rp->byte == ISM330DHCX_FIFO_WORD_LEN)
+      {
+        rp->byte = 0;
+
+        if (rp->next < rp->num)
+        {
+          rp->next++;
+          rp->words_out++;
+        }
+      }
+    }
+
+    else if (bank != (uint8_t)ISM330DHCX_USER_BANK)
+    {
+      data[i] = rp->reg[bank][addr];
+    }
+
+    else if (addr == ISM330DHCX_FIFO_STATUS1)
+    {
+      data[i] = (uint8_t)(level & 0xFFU);
+    }
+
+    else if (addr == ISM330DHCX_FIFO_STATUS2)
+    {
+      /* diff_fifo[9:8], fifo_wtm_ia when words are pending */
+      data[i] = (uint8_t)((level >> 8) & 0x03U);
+      data[i] |= (level != 0U) ? 0x80U : 0x00U;
+    }
+
+    else
+    {
+      data[i] = rp->reg[ISM330DHCX_USER_BANK][addr];
+    }
   }
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  I2C interface pass-through.[set]
+  * @brief  Replay backend write routine (stmdev_ctx_t.write_reg): the
+  *         image of the selected bank is updated, the FIFO content is
+  *         unaffected.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pass_through_mode in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  handle  Replay backend.(ptr)
+  * @param  reg     First register address
+  * @param  data    Data to write.(ptr)
+  * @param  len     Number of consecutive registers to write
+  * @retval         0 -> no Error
   *
   */
-int32_t ism330dhcx_sh_pass_through_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t ism330dhcx_replay_write_reg(void *handle, uint8_t reg,
+                                    const uint8_t *data, uint16_t len)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
-  }
+  ism330dhcx_replay_t *rp = (ism330dhcx_replay_t *)handle;
+  uint16_t i;
+  uint8_t addr;
 
-  if (ret == 0)
+  for (i = 0; i < len; i++)
   {
-    master_config.pass_through_mode = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
+    addr = (uint8_t)((reg + i) & 0x7FU);
+    rp->reg[ism330dhcx_replay_bank(rp, addr)][addr] = data[i];
   }
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  return 0;
+}
 
-  return ret;
+/**
+  * @brief  End of the replayed capture reached.[get]
+  *
+  * @param  rp     Replay backend.(ptr)
+  * @retval        1 -> capture fully drained, 0 -> data left
+  *
+  */
+uint8_t ism330dhcx_replay_done(const ism330dhcx_replay_t *rp)
+{
+  return ((rp->pos >= rp->len) && (rp->next >= rp->num)) ?
+         PROPERTY_ENABLE : PROPERTY_DISABLE;
 }
 
 /**
-  * @brief  I2C interface pass-through.[get]
+  * @brief  Drain a replay backend through the FIFO path until the end
+  *         of the capture. With statistics enabled on ctx
+  *         (ism330dhcx_stats_set), every stage is an entry:
+  *         "fifo_state_get", "fifo_out_multi_raw_get" and "fifo_decode"
+  *         (decoder handlers included: decompression, timestamps,
+  *         batching), whose histograms give the per-stage latency
+  *         percentiles (ism330dhcx_stats_percentile_get). The replay
+  *         backend is private to ctx and the loop may wait on mdelay:
+  *         only the single accesses take the interface lock.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pass_through_mode in reg MASTER_CONFIG
+  * @param  ctx    Interface definitions, handle -> ism330dhcx_replay_t,
+  *                read_reg / write_reg -> replay routines.(ptr)
+  * @param  dec    FIFO decoder.(ptr)
+  * @param  buff   Burst buffer of len FIFO words.(ptr)
+  * @param  len    Words per burst
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_pass_through_get(const stmdev_ctx_t *ctx,
-                                       uint8_t *val)
+int32_t ism330dhcx_replay_run(const stmdev_ctx_t *ctx,
+                              ism330dhcx_fifo_decoder_t *dec,
+                              uint8_t *buff, uint16_t len)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  const ism330dhcx_replay_t *rp = (const ism330dhcx_replay_t *)ctx->handle;
+  ism330dhcx_fifo_state_t state;
+  uint16_t num;
+  int32_t ret = 0;
 
-  if (ret == 0)
+  if (len == 0U)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    return -1;
   }
 
-  if (ret == 0)
+  while ((ret == 0) && (ism330dhcx_replay_done(rp) == PROPERTY_DISABLE))
   {
-    *val = master_config.pass_through_mode;
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ism330dhcx_stats_begin(ctx, "fifo_state_get");
+    ret = ism330dhcx_fifo_state_get(ctx, &state);
+    ism330dhcx_stats_end(ctx);
+
+    if ((ret == 0) && (state.level == 0U) && (ctx->mdelay != NULL))
+    {
+      /* real time: next record not due yet */
+      ctx->mdelay(1);
+    }
+
+    while ((ret == 0) && (state.level > 0U))
+    {
+      num = (state.level > len) ? len : state.level;
+      ism330dhcx_stats_begin(ctx, "fifo_out_multi_raw_get");
+      ret = ism330dhcx_fifo_out_multi_raw_get(ctx, buff, num);
+      ism330dhcx_stats_end(ctx);
+
+      if (ret == 0)
+      {
+        ism330dhcx_stats_begin(ctx, "fifo_decode");
+        (void)ism330dhcx_fifo_decode(dec, buff, num);
+        ism330dhcx_stats_end(ctx);
+      }
+
+      state.level -= num;
+    }
   }
 
   return ret;
 }
 
 /**
-  * @brief  Sensor hub trigger signal selection.[set]
+  * @}
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of start_config in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  */
+
+/**
+  * @defgroup   ISM330DHCX_Calibration
+  * @brief      This section groups the functions that estimate and apply
+  *             the bias, scale factor and misalignment correction.
+  * @{
   *
   */
-int32_t ism330dhcx_sh_syncro_mode_set(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_start_config_t val)
-{
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+/**
+  * @brief  Initialize a calibration to identity matrix and zero bias.
+  *
+  * @param  calib  Calibration.(ptr)
+  *
+  */
+void ism330dhcx_calib_init(ism330dhcx_calib_t *calib)
+{
+  uint8_t i;
+  uint8_t j;
 
-  if (ret == 0)
+  for (i = 0U; i < 3U; i++)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    for (j = 0U; j < 3U; j++)
+    {
+      calib->m[i][j] = (i == j) ? 1.0f : 0.0f;
+    }
+
+    calib->b[i] = 0.0f;
   }
+}
 
-  if (ret == 0)
+/**
+  * @brief  Average a static capture of converted samples.
+  *
+  * @param  x      len x values.(ptr)
+  * @param  y      len y values.(ptr)
+  * @param  z      len z values.(ptr)
+  * @param  len    Number of samples, 0 gives a zero mean
+  * @param  val    Mean of x, y and z (3 values).(ptr)
+  *
+  */
+void ism330dhcx_calib_mean_get(const float_t *x, const float_t *y,
+                               const float_t *z, uint32_t len,
+                               float_t *val)
+{
+  float_t sx = 0.0f;
+  float_t sy = 0.0f;
+  float_t sz = 0.0f;
+  uint32_t i;
+
+  for (i = 0U; i < len; i++)
   {
-    master_config.start_config = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
+    sx += x[i];
+    sy += y[i];
+    sz += z[i];
   }
 
-  if (ret == 0)
+  if (len > 0U)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    sx /= (float_t)len;
+    sy /= (float_t)len;
+    sz /= (float_t)len;
   }
 
-  return ret;
+  val[0] = sx;
+  val[1] = sy;
+  val[2] = sz;
 }
 
 /**
-  * @brief  Sensor hub trigger signal selection.[get]
+  * @brief  Estimate the accelerometer calibration from six static
+  *         positions. With each axis in turn pointing up and down, the
+  *         bias is the mean of the six averages and the column j of the
+  *         sensitivity matrix is half the difference between the two
+  *         positions of axis j over 1 g; the correction matrix is its
+  *         inverse.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of start_config in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  avg    Average acceleration [mg] of each position, indexed
+  *                by ism330dhcx_calib_pos_t.(ptr)
+  * @param  calib  Estimated calibration, unchanged on error.(ptr)
+  * @retval        0 -> estimated, -1 -> degenerate positions
   *
   */
-int32_t ism330dhcx_sh_syncro_mode_get(const stmdev_ctx_t *ctx,
-                                      ism330dhcx_start_config_t *val)
+int32_t ism330dhcx_calib_six_pos_estimate(const float_t avg[6][3],
+                                          ism330dhcx_calib_t *calib)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  float_t s[3][3];
+  float_t det;
+  uint8_t i;
+  uint8_t j;
 
-  if (ret == 0)
+  for (i = 0U; i < 3U; i++)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    for (j = 0U; j < 3U; j++)
+    {
+      s[i][j] = (avg[2U * j][i] - avg[(2U * j) + 1U][i]) / 2000.0f;
+    }
   }
 
-  if (ret == 0)
+  det = (s[0][0] * ((s[1][1] * s[2][2]) - (s[1][2] * s[2][1])))
+        - (s[0][1] * ((s[1][0] * s[2][2]) - (s[1][2] * s[2][0])))
+        + (s[0][2] * ((s[1][0] * s[2][1]) - (s[1][1] * s[2][0])));
+
+  /* each position must see at least a tenth of g on its own axis */
+  if (fabsf(det) < 1.0e-3f)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    return -1;
   }
 
-  switch (master_config.start_config)
+  calib->m[0][0] = ((s[1][1] * s[2][2]) - (s[1][2] * s[2][1])) / det;
+  calib->m[0][1] = ((s[0][2] * s[2][1]) - (s[0][1] * s[2][2])) / det;
+  calib->m[0][2] = ((s[0][1] * s[1][2]) - (s[0][2] * s[1][1])) / det;
+  calib->m[1][0] = ((s[1][2] * s[2][0]) - (s[1][0] * s[2][2])) / det;
+  calib->m[1][1] = ((s[0][0] * s[2][2]) - (s[0][2] * s[2][0])) / det;
+  calib->m[1][2] = ((s[0][2] * s[1][0]) - (s[0][0] * s[1][2])) / det;
+  calib->m[2][0] = ((s[1][0] * s[2][1]) - (s[1][1] * s[2][0])) / det;
+  calib->m[2][1] = ((s[0][1] * s[2][0]) - (s[0][0] * s[2][1])) / det;
+  calib->m[2][2] = ((s[0][0] * s[1][1]) - (s[0][1] * s[1][0])) / det;
+
+  for (i = 0U; i < 3U; i++)
   {
-    case ISM330DHCX_EXT_ON_INT2_PIN:
-      *val = ISM330DHCX_EXT_ON_INT2_PIN;
-      break;
+    calib->b[i] = 0.0f;
 
-    case ISM330DHCX_XL_GY_DRDY:
-      *val = ISM330DHCX_XL_GY_DRDY;
-      break;
+    for (j = 0U; j < 6U; j++)
+    {
+      calib->b[i] += avg[j][i];
+    }
 
-    default:
-      *val = ISM330DHCX_EXT_ON_INT2_PIN;
-      break;
+    calib->b[i] /= 6.0f;
   }
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Slave 0 write operation is performed only at the first sensor
-  *         hub cycle.[set]
+  * @brief  Estimate the bias from a capture at rest, e.g. the gyroscope
+  *         zero-rate level. The correction matrix is left unchanged.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of write_once in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  x      len x values.(ptr)
+  * @param  y      len y values.(ptr)
+  * @param  z      len z values.(ptr)
+  * @param  len    Number of samples
+  * @param  calib  Calibration.(ptr)
+  * @retval        0 -> estimated, -1 -> empty capture
   *
   */
-int32_t ism330dhcx_sh_write_mode_set(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_write_once_t val)
+int32_t ism330dhcx_calib_bias_estimate(const float_t *x, const float_t *y,
+                                       const float_t *z, uint32_t len,
+                                       ism330dhcx_calib_t *calib)
 {
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
-  }
-
-  if (ret == 0)
+  if (len == 0U)
   {
-    master_config.write_once = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
+    return -1;
   }
 
-  if (ret == 0)
+  ism330dhcx_calib_mean_get(x, y, z, len, calib->b);
+
+  return 0;
+}
+
+/**
+  * @brief  Apply a calibration in place to converted samples, e.g. the
+  *         output of ism330dhcx_batch_to_unit(). A plain loop over the
+  *         three component arrays, left to the compiler to vectorize
+  *         for the target.
+  *
+  * @param  calib  Calibration.(ptr)
+  * @param  x      len x values.(ptr)
+  * @param  y      len y values.(ptr)
+  * @param  z      len z values.(ptr)
+  * @param  len    Number of samples
+  *
+  */
+void ism330dhcx_calib_apply(const ism330dhcx_calib_t *calib, float_t *x,
+                            float_t *y, float_t *z, uint32_t len)
+{
+  const float_t m00 = calib->m[0][0];
+  const float_t m01 = calib->m[0][1];
+  const float_t m02 = calib->m[0][2];
+  const float_t m10 = calib->m[1][0];
+  const float_t m11 = calib->m[1][1];
+  const float_t m12 = calib->m[1][2];
+  const float_t m20 = calib->m[2][0];
+  const float_t m21 = calib->m[2][1];
+  const float_t m22 = calib->m[2][2];
+  const float_t bx = calib->b[0];
+  const float_t by = calib->b[1];
+  const float_t bz = calib->b[2];
+  float_t vx;
+  float_t vy;
+  float_t vz;
+  uint32_t i;
+
+  for (i = 0U; i < len; i++)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    vx = x[i] - bx;
+    vy = y[i] - by;
+    vz = z[i] - bz;
+    x[i] = (m00 * vx) + (m01 * vy) + (m02 * vz);
+    y[i] = (m10 * vx) + (m11 * vy) + (m12 * vz);
+    z[i] = (m20 * vx) + (m21 * vy) + (m22 * vz);
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Slave 0 write operation is performed only at the first sensor
-  *         hub cycle.[get]
+  * @brief  Move the accelerometer bias into the user offset registers.
+  *         The finest weight (2^-10 g/LSB) is used when the bias fits,
+  *         2^-6 g/LSB otherwise; the device subtracts the offset from
+  *         the output and FIFO data, so the part absorbed is removed
+  *         from calib->b and the rest is still corrected in software.
+  *         The bias must have been estimated with the offset disabled.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of write_once in reg MASTER_CONFIG
+  * @param  calib  Accelerometer calibration [mg].(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_write_mode_get(const stmdev_ctx_t *ctx,
-                                     ism330dhcx_write_once_t *val)
+int32_t ism330dhcx_calib_xl_offset_write(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_calib_t *calib)
 {
-  ism330dhcx_master_config_t master_config;
+  ism330dhcx_usr_off_w_t weight = ISM330DHCX_LSb_1mg;
+  float_t lsb = 1000.0f / 1024.0f;
+  float_t q[3];
+  uint8_t buff[3];
   int32_t ret;
+  uint8_t i;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
-  if (ret == 0)
+  ism330dhcx_lock(ctx);
+  for (i = 0U; i < 3U; i++)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    if (fabsf(calib->b[i]) > (127.5f * lsb))
+    {
+      weight = ISM330DHCX_LSb_16mg;
+    }
   }
 
-  if (ret == 0)
+  if (weight == ISM330DHCX_LSb_16mg)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    lsb = 1000.0f / 64.0f;
   }
 
-  switch (master_config.write_once)
+  for (i = 0U; i < 3U; i++)
   {
-    case ISM330DHCX_EACH_SH_CYCLE:
-      *val = ISM330DHCX_EACH_SH_CYCLE;
-      break;
-
-    case ISM330DHCX_ONLY_FIRST_CYCLE:
-      *val = ISM330DHCX_ONLY_FIRST_CYCLE;
-      break;
-
-    default:
-      *val = ISM330DHCX_EACH_SH_CYCLE;
-      break;
+    q[i] = calib->b[i] / lsb;
+    q[i] = (q[i] < 0.0f) ? (q[i] - 0.5f) : (q[i] + 0.5f);
+    q[i] = (q[i] > 127.0f) ? 127.0f : q[i];
+    q[i] = (q[i] < -127.0f) ? -127.0f : q[i];
+    q[i] = (float_t)(int32_t)q[i];
+    buff[i] = (uint8_t)(int8_t)q[i];
   }
 
-  return ret;
-}
-
-/**
-  * @brief  Reset Master logic and output registers.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_sh_reset_set(const stmdev_ctx_t *ctx)
-{
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
+  ret = ism330dhcx_xl_offset_weight_set(ctx, weight);
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  if (ret == 0)
+  {
+    ret = ism330dhcx_xl_usr_offset_x_set(ctx, &buff[0]);
+  }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
+    ret = ism330dhcx_xl_usr_offset_y_set(ctx, &buff[1]);
   }
 
   if (ret == 0)
   {
-    master_config.rst_master_regs = PROPERTY_ENABLE;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
+    ret = ism330dhcx_xl_usr_offset_z_set(ctx, &buff[2]);
   }
 
   if (ret == 0)
   {
-    master_config.rst_master_regs = PROPERTY_DISABLE;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                               (uint8_t *)&master_config, 1);
+    ret = ism330dhcx_xl_usr_offset_set(ctx, PROPERTY_ENABLE);
   }
 
   if (ret == 0)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    for (i = 0U; i < 3U; i++)
+    {
+      calib->b[i] -= q[i] * lsb;
+    }
   }
 
+  ism330dhcx_unlock(ctx);
+
   return ret;
 }
 
 /**
-  * @brief  Reset Master logic and output registers.[get]
+  * @}
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of rst_master_regs in reg MASTER_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  */
+
+/**
+  * @defgroup   ISM330DHCX_Device_group
+  * @brief      This section groups the functions that poll the FIFO of
+  *             several devices spread over several buses.
+  * @{
   *
   */
-int32_t ism330dhcx_sh_reset_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  ism330dhcx_master_config_t master_config;
-  int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+/**
+  * @brief  Initialize an empty device group.
+  *
+  * @param  group  Device group.(ptr)
+  * @param  mode   Order in which the devices of a bus are serviced
+  *
+  */
+void ism330dhcx_group_init(ism330dhcx_group_t *group,
+                           ism330dhcx_group_mode_t mode)
+{
+  uint8_t i;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_MASTER_CONFIG,
-                              (uint8_t *)&master_config, 1);
-    *val = master_config.rst_master_regs;
-  }
+  group->len = 0;
+  group->mode = mode;
 
-  if (ret == 0)
+  for (i = 0; i < ISM330DHCX_GROUP_BUS_MAX; i++)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    group->next[i] = 0;
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Rate at which the master communicates.[set]
+  * @brief  Register a device in a group.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of shub_odr in reg SLV0_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  group  Device group.(ptr)
+  * @param  ctx    Read / write interface definitions of the device.(ptr)
+  * @param  bus    Bus the device is connected to, less than
+  *                ISM330DHCX_GROUP_BUS_MAX
+  * @param  sink   Routine receiving every FIFO word (tag and 6 data
+  *                bytes) of the device.(ptr)
+  * @param  arg    Sink argument, e.g. the device stream.(ptr)
+  * @retval        0 -> registered, -1 -> group full or invalid bus
   *
   */
-int32_t ism330dhcx_sh_data_rate_set(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_shub_odr_t val)
+int32_t ism330dhcx_group_add(ism330dhcx_group_t *group,
+                             const stmdev_ctx_t *ctx, uint8_t bus,
+                             ism330dhcx_fifo_sink_ptr sink, void *arg)
 {
-  ism330dhcx_slv0_config_t slv0_config;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_group_dev_t *dev;
 
-  if (ret == 0)
+  if ((group->len >= ISM330DHCX_GROUP_MAX) ||
+      (bus >= ISM330DHCX_GROUP_BUS_MAX))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                              (uint8_t *)&slv0_config, 1);
+    return -1;
   }
 
-  if (ret == 0)
-  {
-    slv0_config.shub_odr = (uint8_t)val;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                               (uint8_t *)&slv0_config, 1);
-  }
+  dev = &group->dev[group->len];
+  dev->ctx = ctx;
+  dev->sink = sink;
+  dev->arg = arg;
+  dev->bus = bus;
+  dev->level = 0;
+  dev->rate = 0;
+  dev->words = 0;
+  dev->overruns = 0;
+  dev->errors = 0;
+  group->len++;
 
-  if (ret == 0)
+  return 0;
+}
+
+/**
+  * @brief  FIFO fill rate of a group device, used by the
+  *         ISM330DHCX_GROUP_DEADLINE_FIRST mode: sum of the batch data
+  *         rates of the batched channels (timestamp and temperature
+  *         words included).[set]
+  *
+  * @param  group  Device group.(ptr)
+  * @param  ctx    Interface definitions the device was added with.(ptr)
+  * @param  rate   Words per second, 0 -> unknown (serviced last)
+  * @retval        0 -> no Error, -1 -> device not in the group
+  *
+  */
+int32_t ism330dhcx_group_rate_set(ism330dhcx_group_t *group,
+                                  const stmdev_ctx_t *ctx, uint32_t rate)
+{
+  int32_t ret = -1;
+  uint8_t i;
+
+  for (i = 0; i < group->len; i++)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    if (group->dev[i].ctx == ctx)
+    {
+      group->dev[i].rate = rate;
+      ret = 0;
+    }
   }
 
   return ret;
 }
 
 /**
-  * @brief  Rate at which the master communicates.[get]
+  * @brief  Servicing order of two group devices in
+  *         ISM330DHCX_GROUP_DEADLINE_FIRST mode.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of shub_odr in reg slv1_CONFIG
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  a      Group device.(ptr)
+  * @param  b      Group device.(ptr)
+  * @retval        1 -> the FIFO of b overruns before the one of a
   *
   */
-int32_t ism330dhcx_sh_data_rate_get(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_shub_odr_t *val)
+static uint8_t ism330dhcx_group_later(const ism330dhcx_group_dev_t *a,
+                                      const ism330dhcx_group_dev_t *b)
 {
-  ism330dhcx_slv0_config_t slv0_config;
-  int32_t ret;
+  uint64_t left_a;
+  uint64_t left_b;
+  uint8_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  left_a = (a->level < ISM330DHCX_FIFO_WORDS) ?
+           (ISM330DHCX_FIFO_WORDS - a->level) : 0U;
+  left_b = (b->level < ISM330DHCX_FIFO_WORDS) ?
+           (ISM330DHCX_FIFO_WORDS - b->level) : 0U;
 
-  if (ret == 0)
+  if (b->rate == 0U)
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                              (uint8_t *)&slv0_config, 1);
+    ret = 0;
   }
 
-  if (ret == 0)
+  else if (a->rate == 0U)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    ret = 1;
   }
 
-  switch (slv0_config.shub_odr)
+  else
   {
-    case ISM330DHCX_SH_ODR_104Hz:
-      *val = ISM330DHCX_SH_ODR_104Hz;
-      break;
+    /* left_b / rate_b < left_a / rate_a, without divisions */
+    ret = ((left_b * a->rate) < (left_a * b->rate)) ? 1U : 0U;
+  }
 
-    case ISM330DHCX_SH_ODR_52Hz:
-      *val = ISM330DHCX_SH_ODR_52Hz;
-      break;
+  return ret;
+}
 
-    case ISM330DHCX_SH_ODR_26Hz:
-      *val = ISM330DHCX_SH_ODR_26Hz;
-      break;
+/**
+  * @brief  Drain up to len words from the FIFO of a group device.
+  *
+  * @param  dev    Group device.(ptr)
+  * @param  len    Number of words to drain
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+static int32_t ism330dhcx_group_drain(ism330dhcx_group_dev_t *dev,
+                                      uint16_t len)
+{
+  ism330dhcx_fifo_tag_t tag;
+  uint8_t buff[ISM330DHCX_GROUP_BURST * ISM330DHCX_FIFO_WORD_LEN];
+  uint16_t num;
+  uint16_t i;
+  int32_t ret = 0;
 
-    case ISM330DHCX_SH_ODR_13Hz:
-      *val = ISM330DHCX_SH_ODR_13Hz;
-      break;
+  while ((len > 0U) && (ret == 0))
+  {
+    num = (len > ISM330DHCX_GROUP_BURST) ? ISM330DHCX_GROUP_BURST : len;
+    ret = ism330dhcx_fifo_out_multi_raw_get(dev->ctx, buff, num);
 
-    default:
-      *val = ISM330DHCX_SH_ODR_104Hz;
-      break;
+    for (i = 0; (i < num) && (ret == 0); i++)
+    {
+      ism330dhcx_fifo_word_tag_get(&buff[i * ISM330DHCX_FIFO_WORD_LEN], &tag);
+      dev->sink(dev->arg, tag, &buff[(i * ISM330DHCX_FIFO_WORD_LEN) + 1U]);
+      dev->words++;
+    }
+
+    len -= num;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Configure slave 0 for perform a write.[set]
+  * @brief  Service once every device of a bus: read its FIFO level and
+  *         drain it to the device sink. To be called periodically, from
+  *         a thread dedicated to the bus when buses work in parallel.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure that contain
-  *                - uint8_t slv0_add;    8 bit i2c device address
-  *                - uint8_t slv0_subadd; 8 bit register device address
-  *                - uint8_t slv0_data;   8 bit data to write
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  group  Device group.(ptr)
+  * @param  bus    Bus to service
+  * @param  budget Maximum number of words drained per device, 0 -> all
+  * @retval        0 -> no Error, otherwise status of the last failure
+  *                (the other devices are serviced anyway)
   *
   */
-int32_t ism330dhcx_sh_cfg_write(const stmdev_ctx_t *ctx,
-                                ism330dhcx_sh_cfg_write_t *val)
+int32_t ism330dhcx_group_poll(ism330dhcx_group_t *group, uint8_t bus,
+                              uint16_t budget)
 {
-  ism330dhcx_slv0_add_t slv0_add;
-  int32_t ret;
-
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  ism330dhcx_group_dev_t *dev;
+  ism330dhcx_fifo_state_t state;
+  uint8_t list[ISM330DHCX_GROUP_MAX];
+  uint8_t order[ISM330DHCX_GROUP_MAX];
+  uint8_t cnt = 0;
+  uint8_t swap;
+  uint8_t tmp;
+  uint8_t i;
+  uint8_t j;
+  uint16_t len;
+  int32_t ret = 0;
+  int32_t err;
 
-  if (ret == 0)
+  if (bus >= ISM330DHCX_GROUP_BUS_MAX)
   {
-    slv0_add.slave0 = (uint8_t)(val->slv0_add >> 1);
-    slv0_add.rw_0 = 0;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_ADD,
-                               (uint8_t *) & (slv0_add), 1);
+    return -1;
   }
 
-  if (ret == 0)
+  /* devices of the bus, rotated by the round-robin cursor of the bus */
+  for (i = 0; i < group->len; i++)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_SUBADD,
-                               (uint8_t *) & (val->slv0_subadd), 1);
+    if (group->dev[i].bus == bus)
+    {
+      list[cnt] = i;
+      cnt++;
+    }
   }
 
-  if (ret == 0)
+  if (cnt == 0U)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_DATAWRITE_SLV0,
-                               (uint8_t *) & (val->slv0_data), 1);
+    return 0;
   }
 
-  if (ret == 0)
+  group->next[bus] = (uint8_t)(group->next[bus] % cnt);
+
+  for (i = 0; i < cnt; i++)
   {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    order[i] = list[(group->next[bus] + i) % cnt];
   }
 
-  return ret;
-}
+  group->next[bus] = (uint8_t)((group->next[bus] + 1U) % cnt);
 
-/**
-  * @brief Configure slave 0 for perform a write/read.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure that contain
-  *                - uint8_t slv_add;    8 bit i2c device address
-  *                - uint8_t slv_subadd; 8 bit register device address
-  *                - uint8_t slv_len;    num of bit to read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t ism330dhcx_sh_slv0_cfg_read(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sh_cfg_read_t *val)
-{
-  ism330dhcx_slv0_config_t slv0_config;
-  ism330dhcx_slv0_add_t slv0_add;
-  int32_t ret;
+  for (i = 0; i < cnt; i++)
+  {
+    dev = &group->dev[order[i]];
+    err = ism330dhcx_fifo_state_get(dev->ctx, &state);
+    dev->level = 0;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+    if (err != 0)
+    {
+      dev->errors++;
+      ret = err;
+    }
 
-  if (ret == 0)
+    else
+    {
+      dev->level = state.level;
+
+      if ((state.ovr == PROPERTY_ENABLE) ||
+          (state.ovr_latched == PROPERTY_ENABLE))
+      {
+        dev->overruns++;
+      }
+    }
+  }
+
+  if (group->mode != ISM330DHCX_GROUP_ROUND_ROBIN)
   {
-    slv0_add.slave0 = (uint8_t) val->slv_add >> 1;
-    slv0_add.rw_0 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_ADD,
-                               (uint8_t *) & (slv0_add), 1);
+    /* few devices per bus: stable insertion sort, ties keep the
+     * round-robin order
+     */
+    for (i = 1; i < cnt; i++)
+    {
+      j = i;
+      swap = 1;
+
+      while ((j > 0U) && (swap == 1U))
+      {
+        if (group->mode == ISM330DHCX_GROUP_FULLEST_FIRST)
+        {
+          swap = (group->dev[order[j - 1U]].level <
+                  group->dev[order[j]].level) ? 1U : 0U;
+        }
+
+        else
+        {
+          swap = ism330dhcx_group_later(&group->dev[order[j - 1U]],
+                                        &group->dev[order[j]]);
+        }
+
+        if (swap == 1U)
+        {
+          tmp = order[j];
+          order[j] = order[j - 1U];
+          order[j - 1U] = tmp;
+          j--;
+        }
+      }
+    }
   }
 
-  if (ret == 0)
+  for (i = 0; i < cnt; i++)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_SUBADD,
-                               &(val->slv_subadd), 1);
-  }
+    dev = &group->dev[order[i]];
+    len = dev->level;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                              (uint8_t *)&slv0_config, 1);
-  }
+    if ((budget != 0U) && (len > budget))
+    {
+      len = budget;
+    }
 
-  if (ret == 0)
-  {
-    slv0_config.slave0_numop = val->slv_len;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV0_CONFIG,
-                               (uint8_t *)&slv0_config, 1);
-  }
+    err = ism330dhcx_group_drain(dev, len);
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
+    if (err != 0)
+    {
+      dev->errors++;
+      ret = err;
+    }
   }
 
   return ret;
 }
 
 /**
-  * @brief  Configure slave 0 for perform a write/read.[get]
+  * @}
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure that contain
-  *                - uint8_t slv_add;    8 bit i2c device address
-  *                - uint8_t slv_subadd; 8 bit register device address
-  *                - uint8_t slv_len;    num of bit to read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  */
+
+/**
+  * @defgroup   ISM330DHCX_Asynchronous_interface
+  * @brief      This section groups the non-blocking versions of the
+  *             most frequently used data read functions.
+  * @{
   *
   */
-int32_t ism330dhcx_sh_slv1_cfg_read(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sh_cfg_read_t *val)
+
+/**
+  * @brief  Submit a request to the asynchronous bus.
+  *
+  * @param  ctx     Asynchronous interface definitions.(ptr)
+  * @param  req     Request, owned by the bus until completion.(ptr)
+  * @param  dir     Transfer direction
+  * @param  reg     First register to access
+  * @param  data    Transfer buffer, NULL to use req->buff.(ptr)
+  * @param  len     Number of consecutive registers
+  * @param  decode  Driver decode step run before complete, may be NULL
+  * @param  out     Decode destination.(ptr)
+  * @retval         Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+static int32_t ism330dhcx_async_submit(const ism330dhcx_async_ctx_t *ctx,
+                                       ism330dhcx_async_req_t *req,
+                                       ism330dhcx_async_dir_t dir,
+                                       uint8_t reg, uint8_t *data,
+                                       uint16_t len,
+                                       ism330dhcx_async_cb_t decode,
+                                       void *out)
 {
-  ism330dhcx_slv1_config_t slv1_config;
-  ism330dhcx_slv1_add_t slv1_add;
   int32_t ret;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
-
-  if (ret == 0)
-  {
-    slv1_add.slave1_add = (uint8_t)(val->slv_add >> 1);
-    slv1_add.r_1 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_ADD,
-                               (uint8_t *)&slv1_add, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_SUBADD,
-                               &(val->slv_subadd), 1);
-  }
-
-  if (ret == 0)
+  if ((ctx == NULL) || (req == NULL))
   {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV1_CONFIG,
-                              (uint8_t *)&slv1_config, 1);
+    return -1;
   }
 
-  if (ret == 0)
-  {
-    slv1_config.slave1_numop = val->slv_len;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV1_CONFIG,
-                               (uint8_t *)&slv1_config, 1);
-  }
+  req->dir = dir;
+  req->reg = reg;
+  req->data = (data != NULL) ? data : req->buff;
+  req->len = len;
+  req->status = 0;
+  req->decode = decode;
+  req->out = out;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+  ret = ctx->submit(ctx->handle, req);
 
   return ret;
 }
 
 /**
-  * @brief  Configure slave 2 for perform a write/read.[get]
+  * @brief  Decode three little-endian 16-bit words in req->out.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure that contain
-  *                - uint8_t slv_add;    8 bit i2c device address
-  *                - uint8_t slv_subadd; 8 bit register device address
-  *                - uint8_t slv_len;    num of bit to read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  req    Completed request.(ptr)
   *
   */
-int32_t ism330dhcx_sh_slv2_cfg_read(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sh_cfg_read_t *val)
+static void ism330dhcx_async_decode_xyz(ism330dhcx_async_req_t *req)
 {
-  ism330dhcx_slv2_config_t slv2_config;
-  ism330dhcx_slv2_add_t slv2_add;
-  int32_t ret;
+  int16_t *val = (int16_t *)req->out;
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+  val[0] = (int16_t)req->buff[1];
+  val[0] = (val[0] * 256) + (int16_t)req->buff[0];
+  val[1] = (int16_t)req->buff[3];
+  val[1] = (val[1] * 256) + (int16_t)req->buff[2];
+  val[2] = (int16_t)req->buff[5];
+  val[2] = (val[2] * 256) + (int16_t)req->buff[4];
+}
 
-  if (ret == 0)
-  {
-    slv2_add.slave2_add = (uint8_t)(val->slv_add >> 1);
-    slv2_add.r_2 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_ADD,
-                               (uint8_t *)&slv2_add, 1);
-  }
+/**
+  * @brief  Decode a little-endian 16-bit word in req->out.
+  *
+  * @param  req    Completed request.(ptr)
+  *
+  */
+static void ism330dhcx_async_decode_temp(ism330dhcx_async_req_t *req)
+{
+  int16_t *val = (int16_t *)req->out;
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_SUBADD,
-                               (uint8_t *) & (val->slv_subadd), 1);
-  }
+  *val = (int16_t)req->buff[1];
+  *val = (*val * 256) + (int16_t)req->buff[0];
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV2_CONFIG,
-                              (uint8_t *)&slv2_config, 1);
-  }
+/**
+  * @brief  Decode STATUS_REG in req->out.
+  *
+  * @param  req    Completed request.(ptr)
+  *
+  */
+static void ism330dhcx_async_decode_status(ism330dhcx_async_req_t *req)
+{
+  ism330dhcx_status_reg_t *val = (ism330dhcx_status_reg_t *)req->out;
 
-  if (ret == 0)
-  {
-    slv2_config.slave2_numop = val->slv_len;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV2_CONFIG,
-                               (uint8_t *)&slv2_config, 1);
-  }
+  *val = *(ism330dhcx_status_reg_t *)&req->buff[0];
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+/**
+  * @brief  Decode diff_fifo from FIFO_STATUS1/2 in req->out.
+  *
+  * @param  req    Completed request.(ptr)
+  *
+  */
+static void ism330dhcx_async_decode_fifo_level(ism330dhcx_async_req_t *req)
+{
+  ism330dhcx_fifo_status1_t *fifo_status1 =
+    (ism330dhcx_fifo_status1_t *)&req->buff[0];
+  ism330dhcx_fifo_status2_t *fifo_status2 =
+    (ism330dhcx_fifo_status2_t *)&req->buff[1];
+  uint16_t *val = (uint16_t *)req->out;
 
-  return ret;
+  *val = fifo_status2->diff_fifo;
+  *val = (*val * 256U) + fifo_status1->diff_fifo;
 }
 
 /**
-  * @brief  Configure slave 3 for perform a write/read.[get]
+  * @brief  Decode the sensor tag of FIFO_DATA_OUT_TAG in req->out.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Structure that contain
-  *                - uint8_t slv_add;    8 bit i2c device address
-  *                - uint8_t slv_subadd; 8 bit register device address
-  *                - uint8_t slv_len;    num of bit to read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  req    Completed request.(ptr)
   *
   */
-int32_t ism330dhcx_sh_slv3_cfg_read(const stmdev_ctx_t *ctx,
-                                    ism330dhcx_sh_cfg_read_t *val)
+static void ism330dhcx_async_decode_tag(ism330dhcx_async_req_t *req)
 {
-  ism330dhcx_slv3_config_t slv3_config;
-  ism330dhcx_slv3_add_t slv3_add;
-  int32_t ret;
+  ism330dhcx_fifo_tag_conv(req->buff[0], (ism330dhcx_fifo_tag_t *)req->out);
+}
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+/**
+  * @brief  Asynchronous transfer completed. To be called by the platform
+  *         when the transfer of a submitted request ends.
+  *
+  * @param  req     Completed request.(ptr)
+  * @param  status  Transfer status (0 -> no Error)
+  *
+  */
+void ism330dhcx_async_complete(ism330dhcx_async_req_t *req, int32_t status)
+{
+  req->status = status;
 
-  if (ret == 0)
+  if ((status == 0) && (req->decode != NULL))
   {
-    slv3_add.slave3_add = (uint8_t)(val->slv_add >> 1);
-    slv3_add.r_3 = 1;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_ADD,
-                               (uint8_t *)&slv3_add, 1);
+    req->decode(req);
   }
 
-  if (ret == 0)
+  if (req->complete != NULL)
   {
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_SUBADD,
-                               &(val->slv_subadd), 1);
+    req->complete(req);
   }
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_SLV3_CONFIG,
-                              (uint8_t *)&slv3_config, 1);
-  }
+/**
+  * @brief  Read generic device register, non-blocking.
+  *
+  * @param  ctx   Asynchronous interface definitions.(ptr)
+  * @param  req   Request, owned by the bus until completion.(ptr)
+  * @param  reg   Register to read
+  * @param  data  Buffer that stores data read, owned by the bus
+  *               until completion.(ptr)
+  * @param  len   Number of consecutive register to read
+  * @retval       Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_async_read_reg(const ism330dhcx_async_ctx_t *ctx,
+                                  ism330dhcx_async_req_t *req, uint8_t reg,
+                                  uint8_t *data, uint16_t len)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ, reg, data,
+                                 len, NULL, NULL);
+}
 
-  if (ret == 0)
-  {
-    slv3_config.slave3_numop = val->slv_len;
-    ret = ism330dhcx_write_reg(ctx, ISM330DHCX_SLV3_CONFIG,
-                               (uint8_t *)&slv3_config, 1);
-  }
+/**
+  * @brief  Write generic device register, non-blocking.
+  *
+  * @param  ctx   Asynchronous interface definitions.(ptr)
+  * @param  req   Request, owned by the bus until completion.(ptr)
+  * @param  reg   Register to write
+  * @param  data  Data to write, owned by the bus until completion.(ptr)
+  * @param  len   Number of consecutive register to write
+  * @retval       Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_async_write_reg(const ism330dhcx_async_ctx_t *ctx,
+                                   ism330dhcx_async_req_t *req, uint8_t reg,
+                                   uint8_t *data, uint16_t len)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_WRITE, reg, data,
+                                 len, NULL, NULL);
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+/**
+  * @brief  The STATUS_REG register, non-blocking.[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  val    Get register STATUS_REG, valid on completion.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_status_reg_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                        ism330dhcx_async_req_t *req,
+                                        ism330dhcx_status_reg_t *val)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_STATUS_REG, NULL, 1,
+                                 ism330dhcx_async_decode_status, val);
+}
 
-  return ret;
+/**
+  * @brief  Temperature data output register, non-blocking.[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  val    Temperature raw value, valid on completion.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_temperature_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                             ism330dhcx_async_req_t *req,
+                                             int16_t *val)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_OUT_TEMP_L, NULL, 2,
+                                 ism330dhcx_async_decode_temp, val);
 }
 
 /**
-  * @brief  Sensor hub source register.[get]
+  * @brief  Angular rate sensor output, non-blocking.[get]
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Registers from STATUS_MASTER
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  val    Angular rate raw values, valid on completion.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t ism330dhcx_sh_status_get(const stmdev_ctx_t *ctx,
-                                 ism330dhcx_status_master_t *val)
+int32_t ism330dhcx_angular_rate_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                              ism330dhcx_async_req_t *req,
+                                              int16_t *val)
 {
-  int32_t ret;
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_OUTX_L_G, NULL, 6,
+                                 ism330dhcx_async_decode_xyz, val);
+}
 
-  ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_SENSOR_HUB_BANK);
+/**
+  * @brief  Linear acceleration output, non-blocking.[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  val    Linear acceleration raw values, valid on completion.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_acceleration_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                              ism330dhcx_async_req_t *req,
+                                              int16_t *val)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_OUTX_L_A, NULL, 6,
+                                 ism330dhcx_async_decode_xyz, val);
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_read_reg(ctx, ISM330DHCX_STATUS_MASTER,
-                              (uint8_t *)val, 1);
-  }
+/**
+  * @brief  Number of unread sensor data (TAG + 6 bytes) stored in FIFO,
+  *         non-blocking.[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  val    diff_fifo of FIFO_STATUS1/2, valid on completion.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_data_level_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                             ism330dhcx_async_req_t *req,
+                                             uint16_t *val)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_FIFO_STATUS1, NULL, 2,
+                                 ism330dhcx_async_decode_fifo_level, val);
+}
 
-  if (ret == 0)
-  {
-    ret = ism330dhcx_mem_bank_set(ctx, ISM330DHCX_USER_BANK);
-  }
+/**
+  * @brief  FIFO data output, non-blocking.[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  buff   Buffer that stores the 6 bytes read, owned by the bus
+  *                until completion.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_out_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                          ism330dhcx_async_req_t *req,
+                                          uint8_t *buff)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_FIFO_DATA_OUT_X_L, buff, 6,
+                                 NULL, NULL);
+}
 
-  return ret;
+/**
+  * @brief  Identifies the sensor in FIFO_DATA_OUT, non-blocking.[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  val    Sensor that produced the word, valid on
+  *                completion.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_fifo_sensor_tag_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                             ism330dhcx_async_req_t *req,
+                                             ism330dhcx_fifo_tag_t *val)
+{
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_FIFO_DATA_OUT_TAG, NULL, 1,
+                                 ism330dhcx_async_decode_tag, val);
 }
 
 /**
-  * @}
+  * @brief  Read several FIFO words (tag and data) in a single burst,
+  *         non-blocking: a full FIFO is drained by one DMA transfer of
+  *         num * 7 bytes, see ism330dhcx_fifo_out_multi_raw_get().[get]
+  *
+  * @param  ctx    Asynchronous interface definitions.(ptr)
+  * @param  req    Request, owned by the bus until completion.(ptr)
+  * @param  buff   Buffer of num * ISM330DHCX_FIFO_WORD_LEN bytes, owned
+  *                by the bus until completion.(ptr)
+  * @param  num    Number of words to read, see fifo_data_level_get
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t ism330dhcx_fifo_out_multi_raw_get_async(
+  const ism330dhcx_async_ctx_t *ctx, ism330dhcx_async_req_t *req,
+  uint8_t *buff, uint16_t num)
+{
+  if ((num == 0U) || (num > ISM330DHCX_FIFO_BURST_MAX))
+  {
+    return -1;
+  }
+
+  return ism330dhcx_async_submit(ctx, req, ISM330DHCX_ASYNC_READ,
+                                 ISM330DHCX_FIFO_DATA_OUT_TAG, buff,
+                                 (uint16_t)(num * ISM330DHCX_FIFO_WORD_LEN),
+                                 NULL, NULL);
+}
 
 /**
   * @}
@@ -2683,6 +2683,25 @@ int32_t ism330dhcx_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
                              uint8_t *data,
                              uint16_t len);
 
+/*
+ * Deferred register writes: ism330dhcx_tx_write() queues the bytes and
+ * ism330dhcx_tx_commit() issues them with ism330dhcx_write_reg(), merging
+ * consecutive queued writes to adjacent addresses into a single
+ * auto-increment burst (CTRL3_C.IF_INC must be set, default).
+ * Writes are issued in queue order; FUNC_CFG_ACCESS is never merged.
+ */
+#define ISM330DHCX_TX_MAX                       16U
+typedef struct
+{
+  uint8_t reg[ISM330DHCX_TX_MAX];
+  uint8_t val[ISM330DHCX_TX_MAX];
+  uint8_t len;
+} ism330dhcx_tx_t;
+void ism330dhcx_tx_init(ism330dhcx_tx_t *tx);
+int32_t ism330dhcx_tx_write(ism330dhcx_tx_t *tx, uint8_t reg,
+                            const uint8_t *data, uint16_t len);
+int32_t ism330dhcx_tx_commit(const stmdev_ctx_t *ctx, ism330dhcx_tx_t *tx);
+
 float_t ism330dhcx_from_fs2g_to_mg(int16_t lsb);
 float_t ism330dhcx_from_fs4g_to_mg(int16_t lsb);
 float_t ism330dhcx_from_fs8g_to_mg(int16_t lsb);
@@ -2764,6 +2783,67 @@ int32_t ism330dhcx_gy_data_rate_set(const stmdev_ctx_t *ctx,
 int32_t ism330dhcx_gy_data_rate_get(const stmdev_ctx_t *ctx,
                                     ism330dhcx_odr_g_t *val);
 
+/*
+ * Sensitivity of a full scale as a constant expression [ug/LSB],
+ * [udps/LSB]: with a constant fs it folds at compile time, so converters
+ * written with it are branch free and inlinable (usable in C++ constexpr
+ * code as well); 0 for codes that are not a full scale.
+ */
+#define ISM330DHCX_XL_SENS_UG(fs) \
+  (((fs) == ISM330DHCX_2g)  ? 61U  : \
+   ((fs) == ISM330DHCX_4g)  ? 122U : \
+   ((fs) == ISM330DHCX_8g)  ? 244U : \
+   ((fs) == ISM330DHCX_16g) ? 488U : 0U)
+
+#define ISM330DHCX_GY_SENS_UDPS(fs) \
+  (((fs) == ISM330DHCX_125dps)  ? 4375U   : \
+   ((fs) == ISM330DHCX_250dps)  ? 8750U   : \
+   ((fs) == ISM330DHCX_500dps)  ? 17500U  : \
+   ((fs) == ISM330DHCX_1000dps) ? 35000U  : \
+   ((fs) == ISM330DHCX_2000dps) ? 70000U  : \
+   ((fs) == ISM330DHCX_4000dps) ? 140000U : 0U)
+
+/* Conversion factors of the full scales in use, rebuilt on change */
+typedef struct
+{
+  ism330dhcx_fs_xl_t xl_fs;
+  ism330dhcx_fs_g_t gy_fs;
+  float_t xl;               /* mg/LSB   */
+  float_t gy;               /* mdps/LSB */
+  uint32_t xl_ug;           /* ug/LSB   */
+  uint32_t gy_udps;         /* udps/LSB */
+} ism330dhcx_conv_t;
+void ism330dhcx_conv_set(ism330dhcx_conv_t *conv, ism330dhcx_fs_xl_t xl_fs,
+                         ism330dhcx_fs_g_t gy_fs);
+int32_t ism330dhcx_conv_get(const stmdev_ctx_t *ctx, ism330dhcx_conv_t *conv);
+
+/* Array conversions, contiguous buffers as in the SoA FIFO batches */
+float_t ism330dhcx_xl_sensitivity_get(ism330dhcx_fs_xl_t fs);
+float_t ism330dhcx_gy_sensitivity_get(ism330dhcx_fs_g_t fs);
+void ism330dhcx_from_lsb_to_unit_array(const int16_t *lsb, float_t *val,
+                                       uint32_t len, float_t sens);
+void ism330dhcx_from_fs_xl_to_mg_array(ism330dhcx_fs_xl_t fs,
+                                       const int16_t *lsb, float_t *val,
+                                       uint32_t len);
+void ism330dhcx_from_fs_g_to_mdps_array(ism330dhcx_fs_g_t fs,
+                                        const int16_t *lsb, float_t *val,
+                                        uint32_t len);
+void ism330dhcx_from_lsb_to_celsius_array(const int16_t *lsb, float_t *val,
+                                          uint32_t len);
+
+/* Fixed-point conversions, same sensitivities, no floating point */
+int32_t ism330dhcx_from_fs_xl_to_g_q16(ism330dhcx_fs_xl_t fs, int16_t lsb);
+int32_t ism330dhcx_from_fs_g_to_dps_q16(ism330dhcx_fs_g_t fs, int16_t lsb);
+int32_t ism330dhcx_from_lsb_to_cdegc(int16_t lsb);
+void ism330dhcx_from_fs_xl_to_g_q16_array(ism330dhcx_fs_xl_t fs,
+                                          const int16_t *lsb, int32_t *val,
+                                          uint32_t len);
+void ism330dhcx_from_fs_g_to_dps_q16_array(ism330dhcx_fs_g_t fs,
+                                           const int16_t *lsb, int32_t *val,
+                                           uint32_t len);
+void ism330dhcx_from_lsb_to_cdegc_array(const int16_t *lsb, int32_t *val,
+                                        uint32_t len);
+
 int32_t ism330dhcx_block_data_update_set(const stmdev_ctx_t *ctx,
                                          uint8_t val);
 int32_t ism330dhcx_block_data_update_get(const stmdev_ctx_t *ctx,
@@ -2879,6 +2959,8 @@ int32_t ism330dhcx_device_conf_get(const stmdev_ctx_t *ctx, uint8_t *val);
 int32_t ism330dhcx_odr_cal_reg_get(const stmdev_ctx_t *ctx, int8_t *val);
 
 int32_t ism330dhcx_number_of_steps_get(const stmdev_ctx_t *ctx, uint16_t *val);
+int32_t ism330dhcx_number_of_steps_emb_get(const stmdev_ctx_t *ctx,
+                                           uint16_t *val);
 
 int32_t ism330dhcx_steps_reset(const stmdev_ctx_t *ctx);
 
@@ -2893,6 +2975,135 @@ int32_t ism330dhcx_mem_bank_set(const stmdev_ctx_t *ctx,
 int32_t ism330dhcx_mem_bank_get(const stmdev_ctx_t *ctx,
                                 ism330dhcx_reg_access_t *val);
 
+/*
+ * Write-through copy of the user bank and embedded functions bank
+ * configuration registers (addresses 0x00 - 0x7F), indexed by
+ * ISM330DHCX_SHADOW_USER / ISM330DHCX_SHADOW_EMB.
+ */
+#define ISM330DHCX_SHADOW_LEN                   0x80U
+#define ISM330DHCX_SHADOW_USER                  0U
+#define ISM330DHCX_SHADOW_EMB                   1U
+typedef struct
+{
+  uint8_t reg[2][ISM330DHCX_SHADOW_LEN];
+  uint8_t valid[2][ISM330DHCX_SHADOW_LEN / 8U];
+} ism330dhcx_shadow_t;
+
+/*
+ * Bus usage statistics, collected by ism330dhcx_read_reg() and
+ * ism330dhcx_write_reg() for every access that reaches the bus (accesses
+ * served by the shadow copy are not counted). Accesses are charged to the
+ * API call wrapped by ISM330DHCX_STATS_CALL() in progress, including the
+ * driver functions it calls internally, or to entry 0 ("other").
+ * Latency is measured with the optional tick_get time base (any unit) and
+ * collected in histogram bins: bin n counts calls lasting less than
+ * 2^n ticks, the last bin collects all the longer ones.
+ * The entry in use is shared by the interface: ism330dhcx_stats_begin()
+ * and ism330dhcx_stats_end() are not serialized against other bus users,
+ * and the interface lock is not held between them. On an interface
+ * shared by several threads, statistics are only meaningful if the
+ * application holds ism330dhcx_lock() around every wrapped call, or if
+ * all the calls are made from a single thread; otherwise the accesses of
+ * one thread may be charged to the call in progress in another one.
+ */
+#define ISM330DHCX_STATS_MAX                    32U
+#define ISM330DHCX_STATS_HIST_LEN               16U
+typedef struct
+{
+  const char *name;
+  uint32_t calls;
+  uint32_t rd_count;
+  uint32_t rd_bytes;
+  uint32_t wr_count;
+  uint32_t wr_bytes;
+  uint32_t errors;
+  uint32_t hist[ISM330DHCX_STATS_HIST_LEN];
+} ism330dhcx_stats_entry_t;
+
+typedef uint32_t (*ism330dhcx_tick_get_ptr)(void);
+typedef void (*ism330dhcx_stats_print_ptr)(const ism330dhcx_stats_entry_t *);
+
+typedef struct
+{
+  /** Optional time base, filled by the application **/
+  ism330dhcx_tick_get_ptr tick_get;
+  /** Driver private fields **/
+  ism330dhcx_stats_entry_t entry[ISM330DHCX_STATS_MAX];
+  uint8_t len;
+  uint8_t cur;
+  uint8_t depth;
+  uint32_t start;
+} ism330dhcx_stats_t;
+
+/*
+ * Driver private data. When used, stmdev_ctx_t::priv_data must point to
+ * an instance of this structure owned by the application and zeroed before
+ * the first call (i.e. all the optional features disabled).
+ */
+typedef void (*ism330dhcx_lock_ptr)(void *);
+
+typedef struct
+{
+  /** Optional recursive lock for shared interfaces, filled by the
+    * application: taken by every driver call for its bus accesses, and
+    * held from the selection of a bank other than the user bank until
+    * the user bank is selected back
+    */
+  ism330dhcx_lock_ptr lock;
+  ism330dhcx_lock_ptr unlock;
+  void *lock_handle;
+  uint8_t lock_held;       /* driver private: the lock owner is in a bank
+                            * sequence, only accessed with the lock taken */
+  uint8_t bank_cache_en;   /* track FUNC_CFG_ACCESS instead of reading it */
+  uint8_t bank_valid;      /* cached bank matches the device              */
+  uint8_t bank;            /* cached ism330dhcx_reg_access_t value        */
+  ism330dhcx_shadow_t *shadow; /* configuration registers copy, optional  */
+  ism330dhcx_stats_t *stats;   /* bus usage statistics, optional          */
+} ism330dhcx_priv_t;
+
+/*
+ * Embedded functions bank session: the *_emb_get functions read embedded
+ * functions registers without switching bank, so that several of them are
+ * run between a single ism330dhcx_emb_session_start() /
+ * ism330dhcx_emb_session_stop() pair. Only *_emb_get functions and direct
+ * register accesses of the embedded functions bank may be used inside.
+ * The interface lock, if any, is held by the calling thread from start
+ * to stop.
+ */
+int32_t ism330dhcx_emb_session_start(const stmdev_ctx_t *ctx);
+int32_t ism330dhcx_emb_session_stop(const stmdev_ctx_t *ctx);
+
+void ism330dhcx_lock(const stmdev_ctx_t *ctx);
+void ism330dhcx_unlock(const stmdev_ctx_t *ctx);
+
+int32_t ism330dhcx_bank_cache_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t ism330dhcx_bank_cache_get(const stmdev_ctx_t *ctx, uint8_t *val);
+
+int32_t ism330dhcx_shadow_set(const stmdev_ctx_t *ctx,
+                              ism330dhcx_shadow_t *val);
+int32_t ism330dhcx_shadow_sync(const stmdev_ctx_t *ctx);
+
+int32_t ism330dhcx_stats_set(const stmdev_ctx_t *ctx,
+                             ism330dhcx_stats_t *val);
+void ism330dhcx_stats_begin(const stmdev_ctx_t *ctx, const char *name);
+void ism330dhcx_stats_end(const stmdev_ctx_t *ctx);
+void ism330dhcx_stats_dump(const stmdev_ctx_t *ctx,
+                           ism330dhcx_stats_print_ptr print);
+uint32_t ism330dhcx_stats_percentile_get(const ism330dhcx_stats_entry_t *val,
+                                         uint8_t pct);
+
+/*
+ * Charge the bus accesses of an API call to its own statistics entry, e.g.
+ * ISM330DHCX_STATS_CALL(&dev_ctx, ret, ism330dhcx_xl_data_rate_set,
+ *                       (&dev_ctx, ISM330DHCX_XL_ODR_104Hz));
+ */
+#define ISM330DHCX_STATS_CALL(ctx, ret, func, args) \
+  do { \
+    ism330dhcx_stats_begin((ctx), #func); \
+    (ret) = func args; \
+    ism330dhcx_stats_end(ctx); \
+  } while (0)
+
 int32_t ism330dhcx_ln_pg_write_byte(const stmdev_ctx_t *ctx, uint16_t address,
                                     uint8_t *val);
 int32_t ism330dhcx_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t address,
@@ -3587,6 +3798,18 @@ int32_t ism330dhcx_fifo_data_level_get(const stmdev_ctx_t *ctx,
 int32_t ism330dhcx_fifo_status_get(const stmdev_ctx_t *ctx,
                                    ism330dhcx_fifo_status2_t *val);
 
+typedef struct
+{
+  uint16_t level;           /* unread FIFO words */
+  uint8_t wtm;
+  uint8_t ovr;
+  uint8_t full;
+  uint8_t counter_bdr;
+  uint8_t ovr_latched;
+} ism330dhcx_fifo_state_t;
+int32_t ism330dhcx_fifo_state_get(const stmdev_ctx_t *ctx,
+                                  ism330dhcx_fifo_state_t *val);
+
 int32_t ism330dhcx_fifo_full_flag_get(const stmdev_ctx_t *ctx,
                                       uint8_t *val);
 
@@ -3619,6 +3842,246 @@ typedef enum
 int32_t ism330dhcx_fifo_sensor_tag_get(const stmdev_ctx_t *ctx,
                                        ism330dhcx_fifo_tag_t *val);
 
+/* FIFO word: FIFO_DATA_OUT_TAG + 6 data bytes, read in bursts of words */
+#define ISM330DHCX_FIFO_WORD_LEN                7U
+#define ISM330DHCX_FIFO_BURST_MAX               (0xFFFFU / ISM330DHCX_FIFO_WORD_LEN)
+int32_t ism330dhcx_fifo_out_multi_raw_get(const stmdev_ctx_t *ctx,
+                                          uint8_t *buff, uint16_t num);
+void ism330dhcx_fifo_word_tag_get(const uint8_t *word,
+                                  ism330dhcx_fifo_tag_t *val);
+
+typedef struct
+{
+  ism330dhcx_fifo_tag_t tag;
+  uint8_t cnt;              /* tag_cnt: words of the same batch share it */
+  const uint8_t *data;      /* FIFO_DATA_OUT_X_L .. FIFO_DATA_OUT_Z_H   */
+} ism330dhcx_fifo_word_t;
+int32_t ism330dhcx_fifo_word_decode(const uint8_t *word,
+                                    ism330dhcx_fifo_word_t *val);
+
+typedef void (*ism330dhcx_fifo_handler_ptr)(void *,
+                                            const ism330dhcx_fifo_word_t *);
+
+typedef struct
+{
+  ism330dhcx_fifo_handler_ptr handler[32];  /* indexed by tag_sensor */
+  void *arg;
+  uint32_t words;
+  uint32_t parity_err;
+  uint32_t unknown;
+} ism330dhcx_fifo_decoder_t;
+void ism330dhcx_fifo_decoder_init(ism330dhcx_fifo_decoder_t *dec, void *arg);
+void ism330dhcx_fifo_decoder_handler_set(ism330dhcx_fifo_decoder_t *dec,
+                                         ism330dhcx_fifo_tag_t tag,
+                                         ism330dhcx_fifo_handler_ptr fn);
+uint16_t ism330dhcx_fifo_decode(ism330dhcx_fifo_decoder_t *dec,
+                                const uint8_t *buff, uint16_t num);
+
+typedef struct
+{
+  ism330dhcx_fifo_tag_t tag; /* ISM330DHCX_XL_NC_TAG / GYRO_NC_TAG   */
+  uint8_t cnt;               /* tag counter of the sample time slot  */
+  int16_t val[3];
+} ism330dhcx_fifo_sample_t;
+
+typedef void (*ism330dhcx_fifo_sample_ptr)(void *,
+                                           const ism330dhcx_fifo_sample_t *);
+
+typedef struct
+{
+  ism330dhcx_fifo_sample_ptr out;
+  void *arg;
+  int16_t last[2][3];       /* reference sample: [0] XL, [1] gyro  */
+  uint8_t valid[2];
+  uint32_t samples;
+  uint32_t dropped;
+} ism330dhcx_fifo_decomp_t;
+void ism330dhcx_fifo_decomp_init(ism330dhcx_fifo_decomp_t *dc,
+                                 ism330dhcx_fifo_sample_ptr out, void *arg);
+uint8_t ism330dhcx_fifo_decompress(ism330dhcx_fifo_decomp_t *dc,
+                                   const ism330dhcx_fifo_word_t *word);
+void ism330dhcx_fifo_decomp_handler(void *arg,
+                                    const ism330dhcx_fifo_word_t *word);
+
+typedef struct
+{
+  uint64_t ns;              /* time of the last TIMESTAMP word       */
+  uint32_t ps;              /* sub-ns remainder of ns                */
+  uint32_t tick_ps;         /* trimmed timestamp LSB                 */
+  uint64_t slot_ps;         /* time slot period, measured when able  */
+  uint32_t raw;             /* last 32-bit timestamp counter         */
+  uint32_t slot;            /* time slots since the TIMESTAMP word   */
+  uint32_t rollover;
+  uint32_t slot_pre;        /* time slots counted before a gap       */
+  uint32_t lost;            /* time slots lost in the last gap       */
+  uint32_t lost_total;
+  uint8_t dec;              /* time slots between TIMESTAMP words    */
+  uint8_t cnt;              /* tag counter of the current time slot  */
+  uint8_t synced;
+  uint8_t resync;           /* 1: gap, 2: waiting for TIMESTAMP word */
+  uint8_t gap;              /* lost is a new estimate                */
+} ism330dhcx_fifo_ts_t;
+void ism330dhcx_fifo_ts_init(ism330dhcx_fifo_ts_t *ts, float_t odr,
+                             ism330dhcx_odr_ts_batch_t dec, int8_t fine);
+void ism330dhcx_fifo_ts_word(ism330dhcx_fifo_ts_t *ts,
+                             const ism330dhcx_fifo_word_t *word);
+int32_t ism330dhcx_fifo_ts_get(const ism330dhcx_fifo_ts_t *ts, uint8_t cnt,
+                               uint64_t *val);
+void ism330dhcx_fifo_ts_resync(ism330dhcx_fifo_ts_t *ts);
+
+/* FIFO capacity: 3 kbyte of 7-byte words */
+#define ISM330DHCX_FIFO_WORDS                   438U
+
+typedef struct
+{
+  uint32_t rate;            /* FIFO words written per second        */
+  uint32_t budget;          /* latency budget of oldest sample [us] */
+  uint32_t drain;           /* smoothed drain time [us]             */
+  uint32_t excess;          /* decaying peak of words beyond wtm    */
+  uint32_t changes;
+  uint16_t wtm;
+  uint16_t wtm_min;
+  uint16_t wtm_max;
+  uint8_t programmed;
+} ism330dhcx_wtm_ctrl_t;
+void ism330dhcx_wtm_ctrl_init(ism330dhcx_wtm_ctrl_t *ctrl, uint32_t rate,
+                              uint32_t budget, uint16_t wtm_min,
+                              uint16_t wtm_max);
+int32_t ism330dhcx_wtm_ctrl_update(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_wtm_ctrl_t *ctrl,
+                                   uint16_t level, uint32_t drain);
+
+/* Output settings in force for a stretch of the FIFO stream */
+typedef struct
+{
+  ism330dhcx_odr_xl_t xl_odr;
+  ism330dhcx_fs_xl_t xl_fs;
+  ism330dhcx_odr_g_t gy_odr;
+  ism330dhcx_fs_g_t gy_fs;
+  ism330dhcx_bdr_xl_t xl_bdr;
+  ism330dhcx_bdr_gy_t gy_bdr;
+} ism330dhcx_fifo_cfg_t;
+int32_t ism330dhcx_fifo_cfg_get(const stmdev_ctx_t *ctx,
+                                ism330dhcx_fifo_cfg_t *val);
+void ism330dhcx_fifo_cfg_change_get(const ism330dhcx_fifo_word_t *word,
+                                    ism330dhcx_fifo_cfg_t *val);
+float_t ism330dhcx_fifo_cfg_slot_rate_get(const ism330dhcx_fifo_cfg_t *val);
+void ism330dhcx_fifo_ts_rate_set(ism330dhcx_fifo_ts_t *ts, float_t odr);
+
+/*
+ * Ordering of the single-producer / single-consumer rings (batch pool,
+ * sample ring). ISM330DHCX_RING_BARRIER defaults to a full memory
+ * barrier; it may be overridden (e.g. with a plain compiler barrier on
+ * single-core targets).
+ */
+#ifndef ISM330DHCX_RING_BARRIER
+#if defined(__ATOMIC_SEQ_CST)
+#define ISM330DHCX_RING_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#elif defined(__CC_ARM)
+#define ISM330DHCX_RING_BARRIER()   __dmb(0xF)   /* armcc intrinsic */
+#elif defined(__ICCARM__)
+#include <intrinsics.h>
+#define ISM330DHCX_RING_BARRIER()   __DMB()
+#elif defined(__GNUC__)
+#define ISM330DHCX_RING_BARRIER()   __asm__ volatile("" ::: "memory")
+#else
+#define ISM330DHCX_RING_BARRIER()
+#endif /* __ATOMIC_SEQ_CST */
+#endif /* ISM330DHCX_RING_BARRIER */
+
+#define ISM330DHCX_RING_CACHE_LINE              64U
+
+/* Structure-of-arrays batches of decoded FIFO samples, one per channel */
+#define ISM330DHCX_BATCH_LEN                    64U
+
+typedef enum
+{
+  ISM330DHCX_BATCH_XL   = 0,
+  ISM330DHCX_BATCH_GY   = 1,
+  ISM330DHCX_BATCH_TEMP = 2, /* x only */
+  ISM330DHCX_BATCH_SH0  = 3, /* sensor hub: 6 bytes as 3 x int16 */
+  ISM330DHCX_BATCH_SH1  = 4,
+  ISM330DHCX_BATCH_SH2  = 5,
+  ISM330DHCX_BATCH_SH3  = 6,
+  ISM330DHCX_BATCH_CH   = 7,
+} ism330dhcx_batch_ch_t;
+
+typedef struct ism330dhcx_batch ism330dhcx_batch_t;
+struct ism330dhcx_batch
+{
+  int16_t x[ISM330DHCX_BATCH_LEN];
+  int16_t y[ISM330DHCX_BATCH_LEN];
+  int16_t z[ISM330DHCX_BATCH_LEN];
+  uint64_t ns[ISM330DHCX_BATCH_LEN];
+  ism330dhcx_fifo_cfg_t cfg; /* settings of all the batch samples */
+  ism330dhcx_batch_ch_t ch;
+  uint16_t len;
+  uint8_t gap;              /* samples were lost before x[0]      */
+};
+
+/*
+ * Pool of empty batches: a single-producer / single-consumer ring of
+ * batch pointers, given back by the batch consumer (ism330dhcx_batch_put)
+ * and taken by the FIFO drain context (ism330dhcx_batch_get).
+ */
+#define ISM330DHCX_BATCH_POOL_LEN               16U   /* power of two */
+
+typedef struct
+{
+  ism330dhcx_batch_t *slot[ISM330DHCX_BATCH_POOL_LEN];
+  volatile uint32_t head;   /* written by batch_put only */
+  uint8_t pad_head[ISM330DHCX_RING_CACHE_LINE - 4U];
+  volatile uint32_t tail;   /* written by batch_get only */
+  uint32_t empty;           /* requests found the pool empty */
+  uint8_t pad_tail[ISM330DHCX_RING_CACHE_LINE - 8U];
+} ism330dhcx_batch_pool_t;
+void ism330dhcx_batch_pool_init(ism330dhcx_batch_pool_t *pool,
+                                ism330dhcx_batch_t *batch, uint16_t len);
+ism330dhcx_batch_t *ism330dhcx_batch_get(ism330dhcx_batch_pool_t *pool);
+void ism330dhcx_batch_put(ism330dhcx_batch_pool_t *pool,
+                          ism330dhcx_batch_t *batch);
+
+typedef void (*ism330dhcx_batch_ready_ptr)(void *, ism330dhcx_batch_t *);
+/* gap estimate: time slots lost, time [ns] the stream resumed from */
+typedef void (*ism330dhcx_fifo_gap_ptr)(void *, uint32_t, uint64_t);
+
+typedef struct
+{
+  ism330dhcx_batch_pool_t *pool;
+  ism330dhcx_batch_ready_ptr ready; /* takes ownership of the batch */
+  void *arg;
+  ism330dhcx_fifo_ts_t *ts;         /* optional, ns = 0 if unknown */
+  ism330dhcx_fifo_decomp_t decomp;
+  ism330dhcx_batch_t *cur[ISM330DHCX_BATCH_CH];
+  ism330dhcx_fifo_cfg_t cfg;        /* settings in force           */
+  uint32_t cfg_changes;
+  ism330dhcx_fifo_gap_ptr gap;      /* optional                    */
+  uint8_t gap_pending;              /* one bit per channel         */
+  uint32_t overruns;
+  uint32_t counter_bdr;
+  uint32_t dropped;
+} ism330dhcx_batcher_t;
+void ism330dhcx_batcher_init(ism330dhcx_batcher_t *bt,
+                             ism330dhcx_batch_pool_t *pool,
+                             ism330dhcx_fifo_ts_t *ts,
+                             ism330dhcx_batch_ready_ptr ready, void *arg);
+void ism330dhcx_batcher_word(void *arg, const ism330dhcx_fifo_word_t *word);
+void ism330dhcx_batcher_sample(void *arg,
+                               const ism330dhcx_fifo_sample_t *val);
+void ism330dhcx_batcher_flush(ism330dhcx_batcher_t *bt);
+void ism330dhcx_batcher_cfg_set(ism330dhcx_batcher_t *bt,
+                                const ism330dhcx_fifo_cfg_t *val);
+void ism330dhcx_batcher_gap_set(ism330dhcx_batcher_t *bt,
+                                ism330dhcx_fifo_gap_ptr gap);
+void ism330dhcx_batcher_overrun(ism330dhcx_batcher_t *bt);
+int32_t ism330dhcx_fifo_drain(const stmdev_ctx_t *ctx,
+                              ism330dhcx_fifo_decoder_t *dec,
+                              ism330dhcx_batcher_t *bt,
+                              uint8_t *buff, uint16_t len,
+                              ism330dhcx_fifo_state_t *val);
+void ism330dhcx_batch_to_unit(const ism330dhcx_batch_t *batch,
+                              float_t *x, float_t *y, float_t *z);
+
 int32_t ism330dhcx_fifo_pedo_batch_set(const stmdev_ctx_t *ctx,
                                        uint8_t val);
 int32_t ism330dhcx_fifo_pedo_batch_get(const stmdev_ctx_t *ctx,
@@ -3837,6 +4300,8 @@ typedef struct
 } ism330dhcx_fsm_out_t;
 int32_t ism330dhcx_fsm_out_get(const stmdev_ctx_t *ctx,
                                ism330dhcx_fsm_out_t *val);
+int32_t ism330dhcx_fsm_out_emb_get(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_fsm_out_t *val);
 
 typedef enum
 {
@@ -3887,6 +4352,20 @@ int32_t ism330dhcx_mlc_data_rate_get(const stmdev_ctx_t *ctx,
                                      ism330dhcx_mlc_odr_t *val);
 
 int32_t ism330dhcx_mlc_out_get(const stmdev_ctx_t *ctx, uint8_t *buff);
+int32_t ism330dhcx_mlc_out_emb_get(const stmdev_ctx_t *ctx, uint8_t *buff);
+
+typedef struct
+{
+  ism330dhcx_emb_func_status_t    emb_func_status;
+  ism330dhcx_fsm_status_a_t       fsm_status_a;
+  ism330dhcx_fsm_status_b_t       fsm_status_b;
+  ism330dhcx_mlc_status_t         mlc_status;
+  ism330dhcx_fsm_out_t            fsm_out;
+  uint16_t                        step_counter;
+  uint8_t                         mlc_src[8];
+} ism330dhcx_emb_outputs_t;
+int32_t ism330dhcx_emb_outputs_get(const stmdev_ctx_t *ctx,
+                                   ism330dhcx_emb_outputs_t *val);
 int32_t ism330dhcx_mlc_mag_sensitivity_set(const stmdev_ctx_t *ctx, uint16_t val);
 int32_t ism330dhcx_mlc_mag_sensitivity_get(const stmdev_ctx_t *ctx, uint16_t *val);
 
@@ -4007,6 +4486,305 @@ int32_t ism330dhcx_sh_slv3_cfg_read(const stmdev_ctx_t *ctx,
 int32_t ism330dhcx_sh_status_get(const stmdev_ctx_t *ctx,
                                  ism330dhcx_status_master_t *val);
 
+/*
+ * Asynchronous (DMA / interrupt driven) interface.
+ * The platform submit routine starts the transfer described by the request
+ * and returns immediately; when the transfer ends, the platform calls
+ * ism330dhcx_async_complete() (e.g. from DMA / worker context), which
+ * decodes the data and invokes the request complete callback.
+ * The request and every buffer it points to are owned by the bus from the
+ * submit until the complete callback is called: they must not be touched
+ * or released meanwhile.
+ */
+typedef enum
+{
+  ISM330DHCX_ASYNC_READ  = 0,
+  ISM330DHCX_ASYNC_WRITE = 1,
+} ism330dhcx_async_dir_t;
+
+typedef struct ism330dhcx_async_req ism330dhcx_async_req_t;
+typedef void (*ism330dhcx_async_cb_t)(ism330dhcx_async_req_t *req);
+typedef int32_t (*stmdev_async_submit_ptr)(void *, ism330dhcx_async_req_t *);
+
+struct ism330dhcx_async_req
+{
+  /** Bus transfer, filled by the driver **/
+  ism330dhcx_async_dir_t dir;
+  uint8_t reg;
+  uint8_t *data;
+  uint16_t len;
+  /** Transfer result, filled by ism330dhcx_async_complete() **/
+  int32_t status;
+  /** Completion callback and argument, filled by the application **/
+  ism330dhcx_async_cb_t complete;
+  void *arg;
+  /** Driver private fields **/
+  ism330dhcx_async_cb_t decode;
+  void *out;
+  uint8_t buff[6];
+};
+
+typedef struct
+{
+  /** Component mandatory fields **/
+  stmdev_async_submit_ptr submit;
+  /** Customizable optional pointer **/
+  void *handle;
+} ism330dhcx_async_ctx_t;
+
+void ism330dhcx_async_complete(ism330dhcx_async_req_t *req, int32_t status);
+
+int32_t ism330dhcx_async_read_reg(const ism330dhcx_async_ctx_t *ctx,
+                                  ism330dhcx_async_req_t *req, uint8_t reg,
+                                  uint8_t *data, uint16_t len);
+int32_t ism330dhcx_async_write_reg(const ism330dhcx_async_ctx_t *ctx,
+                                   ism330dhcx_async_req_t *req, uint8_t reg,
+                                   uint8_t *data, uint16_t len);
+
+int32_t ism330dhcx_status_reg_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                        ism330dhcx_async_req_t *req,
+                                        ism330dhcx_status_reg_t *val);
+int32_t ism330dhcx_temperature_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                             ism330dhcx_async_req_t *req,
+                                             int16_t *val);
+int32_t ism330dhcx_angular_rate_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                              ism330dhcx_async_req_t *req,
+                                              int16_t *val);
+int32_t ism330dhcx_acceleration_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                              ism330dhcx_async_req_t *req,
+                                              int16_t *val);
+int32_t ism330dhcx_fifo_data_level_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                             ism330dhcx_async_req_t *req,
+                                             uint16_t *val);
+int32_t ism330dhcx_fifo_out_raw_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                          ism330dhcx_async_req_t *req,
+                                          uint8_t *buff);
+int32_t ism330dhcx_fifo_sensor_tag_get_async(const ism330dhcx_async_ctx_t *ctx,
+                                             ism330dhcx_async_req_t *req,
+                                             ism330dhcx_fifo_tag_t *val);
+int32_t ism330dhcx_fifo_out_multi_raw_get_async(
+  const ism330dhcx_async_ctx_t *ctx, ism330dhcx_async_req_t *req,
+  uint8_t *buff, uint16_t num);
+
+/*
+ * Single-producer / single-consumer ring of decoded FIFO samples, to hand
+ * samples from the FIFO drain context to a consumer running elsewhere.
+ * The read-only storage descriptor, the producer fields and the consumer
+ * field sit on separate cache lines.
+ */
+typedef struct
+{
+  ism330dhcx_fifo_sample_t *buf;   /* set at init, read-only after */
+  uint32_t mask;
+  uint8_t pad_buf[ISM330DHCX_RING_CACHE_LINE -
+                  sizeof(ism330dhcx_fifo_sample_t *) - 4U];
+  volatile uint32_t head;   /* written by the producer only */
+  uint32_t overflow;
+  uint32_t high_water;
+  uint8_t pad_head[ISM330DHCX_RING_CACHE_LINE - 12U];
+  volatile uint32_t tail;   /* written by the consumer only */
+  uint8_t pad_tail[ISM330DHCX_RING_CACHE_LINE - 4U];
+} ism330dhcx_ring_t;
+
+int32_t ism330dhcx_ring_init(ism330dhcx_ring_t *ring,
+                             ism330dhcx_fifo_sample_t *buf, uint32_t len);
+int32_t ism330dhcx_ring_push(ism330dhcx_ring_t *ring,
+                             const ism330dhcx_fifo_sample_t *val);
+int32_t ism330dhcx_ring_pop(ism330dhcx_ring_t *ring,
+                            ism330dhcx_fifo_sample_t *val);
+uint32_t ism330dhcx_ring_level_get(const ism330dhcx_ring_t *ring);
+void ism330dhcx_ring_sample_handler(void *arg,
+                                    const ism330dhcx_fifo_sample_t *val);
+
+/*
+ * Capture format: append-only little-endian records of raw FIFO words and
+ * configuration snapshots, for offline analysis and replay.
+ *   record  : type (1 byte), device (1 byte), payload length (2 bytes),
+ *             payload
+ *   HEADER  : "ISMC", version
+ *   CONFIG  : registers 0x01..0x19, 0x56..0x75 and EMB_FUNC_EN_B
+ *   WORDS   : raw FIFO words, ISM330DHCX_FIFO_WORD_LEN bytes each
+ *   INDEX   : file offsets of the chunks, 4 bytes each
+ *   END     : file offset of the INDEX record, 4 bytes
+ * Records never span two chunks, so a reader can start at any index
+ * offset.
+ */
+#define ISM330DHCX_CAP_VERSION                  1U
+#define ISM330DHCX_CAP_REC_LEN                  4U
+#define ISM330DHCX_CAP_CFG_LEN                  58U
+#define ISM330DHCX_CAP_WORDS_MAX                (0xFFFFU / ISM330DHCX_FIFO_WORD_LEN)
+
+typedef enum
+{
+  ISM330DHCX_CAP_HEADER = 1,
+  ISM330DHCX_CAP_CONFIG = 2,
+  ISM330DHCX_CAP_WORDS  = 3,
+  ISM330DHCX_CAP_INDEX  = 4,
+  ISM330DHCX_CAP_END    = 5,
+} ism330dhcx_cap_rec_t;
+
+/* sink of the capture bytes, e.g. a file: return 0 -> no Error */
+typedef int32_t (*ism330dhcx_cap_write_ptr)(void *, const uint8_t *,
+                                            uint32_t);
+
+typedef struct
+{
+  ism330dhcx_cap_write_ptr write;
+  void *handle;
+  uint8_t *buf;             /* chunk buffer                  */
+  uint32_t size;
+  uint32_t len;
+  uint32_t offset;          /* bytes handed to write         */
+  uint32_t *index;          /* chunk offsets, may be NULL    */
+  uint32_t index_max;
+  uint32_t index_len;
+  uint32_t errors;
+} ism330dhcx_cap_t;
+
+int32_t ism330dhcx_cap_init(ism330dhcx_cap_t *cap,
+                            ism330dhcx_cap_write_ptr write, void *handle,
+                            uint8_t *buf, uint32_t size,
+                            uint32_t *index, uint32_t index_max);
+int32_t ism330dhcx_cap_config(const stmdev_ctx_t *ctx, ism330dhcx_cap_t *cap,
+                              uint8_t dev);
+int32_t ism330dhcx_cap_words(ism330dhcx_cap_t *cap, uint8_t dev,
+                             const uint8_t *buff, uint16_t num);
+int32_t ism330dhcx_cap_flush(ism330dhcx_cap_t *cap);
+int32_t ism330dhcx_cap_close(ism330dhcx_cap_t *cap);
+
+typedef void (*ism330dhcx_cap_cfg_ptr)(void *, uint8_t, const uint8_t *);
+
+int32_t ism330dhcx_cap_replay(const uint8_t *buff, uint32_t len, uint8_t dev,
+                              ism330dhcx_fifo_decoder_t *dec,
+                              ism330dhcx_cap_cfg_ptr cfg, void *arg);
+
+/*
+ * Replay backend: read_reg / write_reg emulating a device whose FIFO is
+ * fed by the WORDS records of a capture, one record per drain cycle,
+ * so that the whole driver FIFO path (status, tag and data reads) runs
+ * on recorded data. Set stmdev_ctx_t.handle to the ism330dhcx_replay_t.
+ */
+typedef struct
+{
+  const uint8_t *buff;      /* capture                              */
+  uint32_t len;
+  uint32_t pos;             /* next record                          */
+  const uint8_t *words;     /* WORDS record in the FIFO             */
+  uint16_t num;
+  uint16_t next;            /* next word to pop                     */
+  uint8_t byte;             /* next byte of the word                */
+  uint8_t dev;
+  uint8_t reg[3][0x80];     /* indexed by ism330dhcx_reg_access_t   */
+  ism330dhcx_tick_get_ptr tick_get;
+  uint32_t period;          /* ticks per record, 0 -> max speed     */
+  uint32_t release;
+  uint32_t words_out;
+} ism330dhcx_replay_t;
+
+int32_t ism330dhcx_replay_init(ism330dhcx_replay_t *rp, const uint8_t *buff,
+                               uint32_t len, uint8_t dev,
+                               ism330dhcx_tick_get_ptr tick_get,
+                               uint32_t period);
+int32_t ism330dhcx_replay_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                   uint16_t len);
+int32_t ism330dhcx_replay_write_reg(void *handle, uint8_t reg,
+                                    const uint8_t *data, uint16_t len);
+uint8_t ism330dhcx_replay_done(const ism330dhcx_replay_t *rp);
+int32_t ism330dhcx_replay_run(const stmdev_ctx_t *ctx,
+                              ism330dhcx_fifo_decoder_t *dec,
+                              uint8_t *buff, uint16_t len);
+
+/*
+ * Calibration: out = m * (in - b) on converted samples (mg or mdps), so
+ * a single 3x3 matrix corrects scale factor and cross-axis misalignment
+ * and b removes the bias. Estimated from static captures: six positions
+ * (+X, -X, +Y, -Y, +Z, -Z axis pointing up) for the accelerometer, one
+ * position at rest for the gyroscope bias.
+ */
+typedef enum
+{
+  ISM330DHCX_CALIB_POS_XP = 0,
+  ISM330DHCX_CALIB_POS_XN = 1,
+  ISM330DHCX_CALIB_POS_YP = 2,
+  ISM330DHCX_CALIB_POS_YN = 3,
+  ISM330DHCX_CALIB_POS_ZP = 4,
+  ISM330DHCX_CALIB_POS_ZN = 5,
+} ism330dhcx_calib_pos_t;
+
+typedef struct
+{
+  float_t m[3][3];          /* correction matrix                    */
+  float_t b[3];             /* bias, same unit as the samples       */
+} ism330dhcx_calib_t;
+
+void ism330dhcx_calib_init(ism330dhcx_calib_t *calib);
+void ism330dhcx_calib_mean_get(const float_t *x, const float_t *y,
+                               const float_t *z, uint32_t len,
+                               float_t *val);
+int32_t ism330dhcx_calib_six_pos_estimate(const float_t avg[6][3],
+                                          ism330dhcx_calib_t *calib);
+int32_t ism330dhcx_calib_bias_estimate(const float_t *x, const float_t *y,
+                                       const float_t *z, uint32_t len,
+                                       ism330dhcx_calib_t *calib);
+void ism330dhcx_calib_apply(const ism330dhcx_calib_t *calib, float_t *x,
+                            float_t *y, float_t *z, uint32_t len);
+int32_t ism330dhcx_calib_xl_offset_write(const stmdev_ctx_t *ctx,
+                                         ism330dhcx_calib_t *calib);
+
+/*
+ * Device group: many devices, each with its own interface context, spread
+ * over several buses. ism330dhcx_group_poll() services the devices of one
+ * bus only, so the application can run one polling thread per bus; the
+ * FIFO words of every device are delivered to its own sink. In
+ * ISM330DHCX_GROUP_DEADLINE_FIRST mode the device closest to a FIFO
+ * overrun is serviced first: (FIFO size - level) / fill rate, with the
+ * fill rate of each device given by ism330dhcx_group_rate_set().
+ */
+#define ISM330DHCX_GROUP_MAX                    16U
+#define ISM330DHCX_GROUP_BUS_MAX                8U
+#define ISM330DHCX_GROUP_BURST                  32U /* words per bus read */
+
+typedef void (*ism330dhcx_fifo_sink_ptr)(void *, ism330dhcx_fifo_tag_t,
+                                         const uint8_t *);
+
+typedef enum
+{
+  ISM330DHCX_GROUP_ROUND_ROBIN   = 0, /* rotate the first device served  */
+  ISM330DHCX_GROUP_FULLEST_FIRST = 1, /* highest FIFO level served first */
+  ISM330DHCX_GROUP_DEADLINE_FIRST = 2, /* earliest overrun served first  */
+} ism330dhcx_group_mode_t;
+
+typedef struct
+{
+  const stmdev_ctx_t *ctx;
+  ism330dhcx_fifo_sink_ptr sink;
+  void *arg;
+  uint8_t bus;
+  uint16_t level;
+  uint32_t rate;            /* FIFO fill rate [words/s], 0 -> unknown */
+  uint32_t words;
+  uint32_t overruns;
+  uint32_t errors;
+} ism330dhcx_group_dev_t;
+
+typedef struct
+{
+  ism330dhcx_group_dev_t dev[ISM330DHCX_GROUP_MAX];
+  uint8_t len;
+  ism330dhcx_group_mode_t mode;
+  uint8_t next[ISM330DHCX_GROUP_BUS_MAX]; /* rotation among bus devices */
+} ism330dhcx_group_t;
+
+void ism330dhcx_group_init(ism330dhcx_group_t *group,
+                           ism330dhcx_group_mode_t mode);
+int32_t ism330dhcx_group_add(ism330dhcx_group_t *group,
+                             const stmdev_ctx_t *ctx, uint8_t bus,
+                             ism330dhcx_fifo_sink_ptr sink, void *arg);
+int32_t ism330dhcx_group_rate_set(ism330dhcx_group_t *group,
+                                  const stmdev_ctx_t *ctx, uint32_t rate);
+int32_t ism330dhcx_group_poll(ism330dhcx_group_t *group, uint8_t bus,
+                              uint16_t budget);
+
 /**
   *@}
   *
@@ -4016,5 +4794,169 @@ int32_t ism330dhcx_sh_status_get(const stmdev_ctx_t *ctx,
 }
 #endif
 
+#if defined(__cplusplus) && (__cplusplus >= 201103L)
+
+/*
+ * C++ conversions: ism330dhcx::xl<FS> and ism330dhcx::gy<FS> fold the
+ * sensitivity of a full scale known at compile time into branch-free,
+ * inlinable converters; ism330dhcx::converter selects them through a
+ * dispatch table once per full-scale change (set()) for full scales
+ * known only at run time. Results match the C ism330dhcx_from_* path.
+ */
+namespace ism330dhcx
+{
+
+typedef float_t (*conv_ptr)(int16_t);
+typedef void (*conv_array_ptr)(const int16_t *, float_t *, uint32_t);
+
+template <ism330dhcx_fs_xl_t FS>
+struct xl
+{
+  static_assert(ISM330DHCX_XL_SENS_UG(FS) != 0U, "not a full scale");
+
+  /* [mg/LSB] */
+  static constexpr float_t sens = (float_t)ISM330DHCX_XL_SENS_UG(FS) /
+                                  1000.0f;
+
+  static constexpr float_t to_mg(int16_t lsb)
+  {
+    return (float_t)lsb * sens;
+  }
+
+  static void to_mg_array(const int16_t *lsb, float_t *val, uint32_t len)
+  {
+    for (uint32_t i = 0; i < len; i++)
+    {
+      val[i] = (float_t)lsb[i] * sens;
+    }
+  }
+};
+
+template <ism330dhcx_fs_g_t FS>
+struct gy
+{
+  static_assert(ISM330DHCX_GY_SENS_UDPS(FS) != 0U, "not a full scale");
+
+  /* [mdps/LSB] */
+  static constexpr float_t sens = (float_t)ISM330DHCX_GY_SENS_UDPS(FS) /
+                                  1000.0f;
+
+  static constexpr float_t to_mdps(int16_t lsb)
+  {
+    return (float_t)lsb * sens;
+  }
+
+  static void to_mdps_array(const int16_t *lsb, float_t *val, uint32_t len)
+  {
+    for (uint32_t i = 0; i < len; i++)
+    {
+      val[i] = (float_t)lsb[i] * sens;
+    }
+  }
+};
+
+/* reserved full-scale codes convert to 0 */
+inline float_t conv_none(int16_t lsb)
+{
+  (void)lsb;
+  return 0.0f;
+}
+
+inline void conv_none_array(const int16_t *lsb, float_t *val, uint32_t len)
+{
+  (void)lsb;
+
+  for (uint32_t i = 0; i < len; i++)
+  {
+    val[i] = 0.0f;
+  }
+}
+
+struct conv_entry
+{
+  conv_ptr one;
+  conv_array_ptr array;
+};
+
+/* indexed by the FS_XL code */
+inline const conv_entry &xl_conv_select(ism330dhcx_fs_xl_t fs)
+{
+  static const conv_entry table[4] =
+  {
+    { xl<ISM330DHCX_2g>::to_mg,  xl<ISM330DHCX_2g>::to_mg_array },
+    { xl<ISM330DHCX_16g>::to_mg, xl<ISM330DHCX_16g>::to_mg_array },
+    { xl<ISM330DHCX_4g>::to_mg,  xl<ISM330DHCX_4g>::to_mg_array },
+    { xl<ISM330DHCX_8g>::to_mg,  xl<ISM330DHCX_8g>::to_mg_array },
+  };
+
+  return table[(uint8_t)fs & 0x03U];
+}
+
+/* indexed by the fs_4000 + fs_125 + FS_G code */
+inline const conv_entry &gy_conv_select(ism330dhcx_fs_g_t fs)
+{
+  static const conv_entry none = { conv_none, conv_none_array };
+  static const conv_entry table[16] =
+  {
+    { gy<ISM330DHCX_250dps>::to_mdps,  gy<ISM330DHCX_250dps>::to_mdps_array },
+    { gy<ISM330DHCX_4000dps>::to_mdps, gy<ISM330DHCX_4000dps>::to_mdps_array },
+    { gy<ISM330DHCX_125dps>::to_mdps,  gy<ISM330DHCX_125dps>::to_mdps_array },
+    none,
+    { gy<ISM330DHCX_500dps>::to_mdps,  gy<ISM330DHCX_500dps>::to_mdps_array },
+    none, none, none,
+    { gy<ISM330DHCX_1000dps>::to_mdps, gy<ISM330DHCX_1000dps>::to_mdps_array },
+    none, none, none,
+    { gy<ISM330DHCX_2000dps>::to_mdps, gy<ISM330DHCX_2000dps>::to_mdps_array },
+    none, none, none,
+  };
+
+  return table[(uint8_t)fs & 0x0FU];
+}
+
+/* Converters of the full scales in use, set() on every change */
+class converter
+{
+public:
+  converter() :
+    xl_(xl_conv_select(ISM330DHCX_2g)),
+    gy_(gy_conv_select(ISM330DHCX_250dps))
+  {
+  }
+
+  void set(ism330dhcx_fs_xl_t xl_fs, ism330dhcx_fs_g_t gy_fs)
+  {
+    xl_ = xl_conv_select(xl_fs);
+    gy_ = gy_conv_select(gy_fs);
+  }
+
+  float_t xl_mg(int16_t lsb) const
+  {
+    return xl_.one(lsb);
+  }
+
+  float_t gy_mdps(int16_t lsb) const
+  {
+    return gy_.one(lsb);
+  }
+
+  void xl_mg(const int16_t *lsb, float_t *val, uint32_t len) const
+  {
+    xl_.array(lsb, val, len);
+  }
+
+  void gy_mdps(const int16_t *lsb, float_t *val, uint32_t len) const
+  {
+    gy_.array(lsb, val, len);
+  }
+
+private:
+  conv_entry xl_;
+  conv_entry gy_;
+};
+
+} /* namespace ism330dhcx */
+
+#endif /* __cplusplus >= 201103L */
+
 #endif /* ISM330DHCX_REGS_H */
 
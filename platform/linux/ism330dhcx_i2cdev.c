@@ -0,0 +1,160 @@
+/**
+  ******************************************************************************
+  * @file    ism330dhcx_i2cdev.c
+  * @brief   Linux i2c-dev bus functions for the ism330dhcx driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "ism330dhcx_i2cdev.h"
+
+/**
+  * @brief  Default bus call.
+  *
+  * @param  fd     Adapter file descriptor
+  * @param  req    ioctl request
+  * @param  arg    ioctl argument.(ptr)
+  * @retval        ioctl() result
+  *
+  */
+static int ism330dhcx_i2cdev_ioctl(int fd, unsigned long req, void *arg)
+{
+  return ioctl(fd, req, arg);
+}
+
+/**
+  * @brief  Open an i2c-dev adapter.
+  *
+  * @param  dev    Bus definitions.(ptr)
+  * @param  path   Adapter, e.g. "/dev/i2c-1".(ptr)
+  * @param  add    ISM330DHCX_I2C_ADD_L or ISM330DHCX_I2C_ADD_H
+  * @retval        0 -> opened, -1 -> error
+  *
+  */
+int32_t ism330dhcx_i2cdev_open(ism330dhcx_i2cdev_t *dev, const char *path,
+                               uint8_t add)
+{
+  dev->fd = open(path, O_RDWR);
+  dev->addr = (uint16_t)(add >> 1);
+  dev->ioctl = ism330dhcx_i2cdev_ioctl;
+
+  return (dev->fd < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  Close the adapter.
+  *
+  * @param  dev    Bus definitions.(ptr)
+  *
+  */
+void ism330dhcx_i2cdev_close(ism330dhcx_i2cdev_t *dev)
+{
+  if (dev->fd >= 0)
+  {
+    (void)close(dev->fd);
+    dev->fd = -1;
+  }
+}
+
+/**
+  * @brief  Read consecutive registers: address write, repeated start,
+  *         data read, in one I2C_RDWR transaction.
+  *
+  * @param  handle Bus definitions, ism330dhcx_i2cdev_t.(ptr)
+  * @param  reg    First register to read
+  * @param  data   Buffer that stores the data read.(ptr)
+  * @param  len    Number of consecutive registers to read
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_i2cdev_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                   uint16_t len)
+{
+  ism330dhcx_i2cdev_t *dev = (ism330dhcx_i2cdev_t *)handle;
+  struct i2c_msg msgs[2];
+  struct i2c_rdwr_ioctl_data xfer;
+
+  msgs[0].addr = dev->addr;
+  msgs[0].flags = 0;
+  msgs[0].len = 1;
+  msgs[0].buf = &reg;
+  msgs[1].addr = dev->addr;
+  msgs[1].flags = I2C_M_RD;
+  msgs[1].len = len;
+  msgs[1].buf = data;
+  xfer.msgs = msgs;
+  xfer.nmsgs = 2;
+
+  return (dev->ioctl(dev->fd, I2C_RDWR, &xfer) == 2) ? 0 : -1;
+}
+
+/**
+  * @brief  Write consecutive registers: address and data in a single
+  *         message.
+  *
+  * @param  handle Bus definitions, ism330dhcx_i2cdev_t.(ptr)
+  * @param  reg    First register to write
+  * @param  data   Data to write.(ptr)
+  * @param  len    Number of consecutive registers to write, up to
+  *                ISM330DHCX_I2CDEV_WRITE_MAX
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_i2cdev_write_reg(void *handle, uint8_t reg,
+                                    const uint8_t *data, uint16_t len)
+{
+  ism330dhcx_i2cdev_t *dev = (ism330dhcx_i2cdev_t *)handle;
+  uint8_t buf[1U + ISM330DHCX_I2CDEV_WRITE_MAX];
+  struct i2c_msg msg;
+  struct i2c_rdwr_ioctl_data xfer;
+
+  if (len > ISM330DHCX_I2CDEV_WRITE_MAX)
+  {
+    return -1;
+  }
+
+  buf[0] = reg;
+  (void)memcpy(&buf[1], data, len);
+  msg.addr = dev->addr;
+  msg.flags = 0;
+  msg.len = (uint16_t)(len + 1U);
+  msg.buf = buf;
+  xfer.msgs = &msg;
+  xfer.nmsgs = 1;
+
+  return (dev->ioctl(dev->fd, I2C_RDWR, &xfer) == 1) ? 0 : -1;
+}
+
+/**
+  * @brief  Plug the adapter in a device context.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  dev    Bus definitions, opened.(ptr)
+  *
+  */
+void ism330dhcx_i2cdev_ctx_init(stmdev_ctx_t *ctx, ism330dhcx_i2cdev_t *dev)
+{
+  ctx->write_reg = ism330dhcx_i2cdev_write_reg;
+  ctx->read_reg = ism330dhcx_i2cdev_read_reg;
+  ctx->handle = dev;
+}
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    ism330dhcx_i2cdev.h
+  * @brief   Linux i2c-dev bus functions for the ism330dhcx driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISM330DHCX_I2CDEV_H
+#define ISM330DHCX_I2CDEV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ism330dhcx_reg.h"
+
+/*
+ * Register access through /dev/i2c-N: every access is a single I2C_RDWR
+ * ioctl, the register address and the data phase combined in one bus
+ * transaction (write + repeated start + read for the reads).
+ * Set stmdev_ctx_t.handle to the ism330dhcx_i2cdev_t.
+ */
+#define ISM330DHCX_I2CDEV_WRITE_MAX             32U
+
+typedef int (*ism330dhcx_i2cdev_ioctl_ptr)(int, unsigned long, void *);
+
+typedef struct
+{
+  int fd;
+  uint16_t addr;                       /* 7-bit slave address */
+  /** Bus call, ioctl() by default, replaceable for testing **/
+  ism330dhcx_i2cdev_ioctl_ptr ioctl;
+} ism330dhcx_i2cdev_t;
+
+int32_t ism330dhcx_i2cdev_open(ism330dhcx_i2cdev_t *dev, const char *path,
+                               uint8_t add);
+void ism330dhcx_i2cdev_close(ism330dhcx_i2cdev_t *dev);
+int32_t ism330dhcx_i2cdev_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                   uint16_t len);
+int32_t ism330dhcx_i2cdev_write_reg(void *handle, uint8_t reg,
+                                    const uint8_t *data, uint16_t len);
+void ism330dhcx_i2cdev_ctx_init(stmdev_ctx_t *ctx, ism330dhcx_i2cdev_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ISM330DHCX_I2CDEV_H */
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file    ism330dhcx_spidev.c
+  * @brief   Linux spidev bus functions for the ism330dhcx driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+#include "ism330dhcx_spidev.h"
+
+/**
+  * @brief  Default bus call.
+  *
+  * @param  fd     spidev file descriptor
+  * @param  req    ioctl request
+  * @param  arg    ioctl argument.(ptr)
+  * @retval        ioctl() result
+  *
+  */
+static int ism330dhcx_spidev_ioctl(int fd, unsigned long req, void *arg)
+{
+  return ioctl(fd, req, arg);
+}
+
+/**
+  * @brief  Issue the address byte and the data phase in one message.
+  *
+  * @param  dev    Bus definitions.(ptr)
+  * @param  cmd    Address byte, read bit included
+  * @param  rx     Data read, NULL for a write.(ptr)
+  * @param  tx     Data written, NULL for a read.(ptr)
+  * @param  len    Number of data bytes
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+static int32_t ism330dhcx_spidev_xfer(const ism330dhcx_spidev_t *dev,
+                                      uint8_t cmd, uint8_t *rx,
+                                      const uint8_t *tx, uint16_t len)
+{
+  struct spi_ioc_transfer xfer[2];
+
+  (void)memset(xfer, 0, sizeof(xfer));
+  xfer[0].tx_buf = (unsigned long)&cmd;
+  xfer[0].len = 1;
+  xfer[0].speed_hz = dev->speed_hz;
+  xfer[1].rx_buf = (unsigned long)rx;
+  xfer[1].tx_buf = (unsigned long)tx;
+  xfer[1].len = len;
+  xfer[1].speed_hz = dev->speed_hz;
+
+  return (dev->ioctl(dev->fd, SPI_IOC_MESSAGE(2), xfer) < 0) ? -1 : 0;
+}
+
+/**
+  * @brief  Open a spidev device in mode 3.
+  *
+  * @param  dev      Bus definitions.(ptr)
+  * @param  path     Device, e.g. "/dev/spidev0.0".(ptr)
+  * @param  speed_hz Clock frequency, up to 10 MHz
+  * @retval          0 -> opened, -1 -> error
+  *
+  */
+int32_t ism330dhcx_spidev_open(ism330dhcx_spidev_t *dev, const char *path,
+                               uint32_t speed_hz)
+{
+  uint8_t mode = SPI_MODE_3;
+  uint8_t bits = 8;
+  int32_t ret = 0;
+
+  dev->fd = open(path, O_RDWR);
+  dev->speed_hz = speed_hz;
+  dev->ioctl = ism330dhcx_spidev_ioctl;
+
+  if (dev->fd < 0)
+  {
+    ret = -1;
+  }
+
+  if ((ret == 0) && ((dev->ioctl(dev->fd, SPI_IOC_WR_MODE, &mode) < 0) ||
+                     (dev->ioctl(dev->fd, SPI_IOC_WR_BITS_PER_WORD,
+                                 &bits) < 0) ||
+                     (dev->ioctl(dev->fd, SPI_IOC_WR_MAX_SPEED_HZ,
+                                 &speed_hz) < 0)))
+  {
+    ism330dhcx_spidev_close(dev);
+    ret = -1;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Close the device.
+  *
+  * @param  dev    Bus definitions.(ptr)
+  *
+  */
+void ism330dhcx_spidev_close(ism330dhcx_spidev_t *dev)
+{
+  if (dev->fd >= 0)
+  {
+    (void)close(dev->fd);
+    dev->fd = -1;
+  }
+}
+
+/**
+  * @brief  Read consecutive registers.
+  *
+  * @param  handle Bus definitions, ism330dhcx_spidev_t.(ptr)
+  * @param  reg    First register to read
+  * @param  data   Buffer that stores the data read.(ptr)
+  * @param  len    Number of consecutive registers to read
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_spidev_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                   uint16_t len)
+{
+  uint8_t cmd = reg | ISM330DHCX_SPIDEV_READ;
+
+  return ism330dhcx_spidev_xfer((const ism330dhcx_spidev_t *)handle, cmd,
+                                data, NULL, len);
+}
+
+/**
+  * @brief  Write consecutive registers.
+  *
+  * @param  handle Bus definitions, ism330dhcx_spidev_t.(ptr)
+  * @param  reg    First register to write
+  * @param  data   Data to write.(ptr)
+  * @param  len    Number of consecutive registers to write
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t ism330dhcx_spidev_write_reg(void *handle, uint8_t reg,
+                                    const uint8_t *data, uint16_t len)
+{
+  uint8_t cmd = reg & (uint8_t)~ISM330DHCX_SPIDEV_READ;
+
+  return ism330dhcx_spidev_xfer((const ism330dhcx_spidev_t *)handle, cmd,
+                                NULL, data, len);
+}
+
+/**
+  * @brief  Plug the device in a device context.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  dev    Bus definitions, opened.(ptr)
+  *
+  */
+void ism330dhcx_spidev_ctx_init(stmdev_ctx_t *ctx, ism330dhcx_spidev_t *dev)
+{
+  ctx->write_reg = ism330dhcx_spidev_write_reg;
+  ctx->read_reg = ism330dhcx_spidev_read_reg;
+  ctx->handle = dev;
+}
@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    ism330dhcx_spidev.h
+  * @brief   Linux spidev bus functions for the ism330dhcx driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISM330DHCX_SPIDEV_H
+#define ISM330DHCX_SPIDEV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ism330dhcx_reg.h"
+
+/*
+ * Register access through /dev/spidevB.C in mode 3: every access is one
+ * SPI_IOC_MESSAGE of two transfers under the same chip select, the
+ * address byte then the data. Bit 7 of the address byte selects a read;
+ * the device has no multiple-byte bit, multi-byte accesses rely on
+ * CTRL3_C.IF_INC (enabled by default).
+ * Set stmdev_ctx_t.handle to the ism330dhcx_spidev_t.
+ */
+#define ISM330DHCX_SPIDEV_READ                  0x80U
+
+typedef int (*ism330dhcx_spidev_ioctl_ptr)(int, unsigned long, void *);
+
+typedef struct
+{
+  int fd;
+  uint32_t speed_hz;
+  /** Bus call, ioctl() by default, replaceable for testing **/
+  ism330dhcx_spidev_ioctl_ptr ioctl;
+} ism330dhcx_spidev_t;
+
+int32_t ism330dhcx_spidev_open(ism330dhcx_spidev_t *dev, const char *path,
+                               uint32_t speed_hz);
+void ism330dhcx_spidev_close(ism330dhcx_spidev_t *dev);
+int32_t ism330dhcx_spidev_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                   uint16_t len);
+int32_t ism330dhcx_spidev_write_reg(void *handle, uint8_t reg,
+                                    const uint8_t *data, uint16_t len);
+void ism330dhcx_spidev_ctx_init(stmdev_ctx_t *ctx, ism330dhcx_spidev_t *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ISM330DHCX_SPIDEV_H */
@@ -0,0 +1,96 @@
+/*
+ * Unit conversion of 1M raw accelerometer samples: per-sample functions
+ * selected by a full-scale switch in the loop, as callers do, against
+ * the float and fixed-point array conversions.
+ */
+#include <stdlib.h>
+
+#include "test.h"
+
+#define SAMPLES                                 1000000U
+#define LOOPS                                   20
+
+static int16_t lsb[SAMPLES];
+static float_t val[SAMPLES];
+static int32_t fix[SAMPLES];
+
+static void per_sample(ism330dhcx_fs_xl_t fs)
+{
+  uint32_t i;
+
+  for (i = 0; i < SAMPLES; i++)
+  {
+    switch (fs)
+    {
+      case ISM330DHCX_2g:
+        val[i] = ism330dhcx_from_fs2g_to_mg(lsb[i]);
+        break;
+
+      case ISM330DHCX_4g:
+        val[i] = ism330dhcx_from_fs4g_to_mg(lsb[i]);
+        break;
+
+      case ISM330DHCX_8g:
+        val[i] = ism330dhcx_from_fs8g_to_mg(lsb[i]);
+        break;
+
+      default:
+        val[i] = ism330dhcx_from_fs16g_to_mg(lsb[i]);
+        break;
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  /* full scale unknown at compile time */
+  volatile ism330dhcx_fs_xl_t fs = ISM330DHCX_4g;
+  uint64_t t0;
+  double ns;
+  double sum = 0.0;
+  uint32_t i;
+  int n;
+
+  (void)argv;
+  srand((unsigned)argc);
+
+  for (i = 0; i < SAMPLES; i++)
+  {
+    lsb[i] = (int16_t)(rand() & 0xFFFF);
+  }
+
+  t0 = test_now_ns();
+
+  for (n = 0; n < LOOPS; n++)
+  {
+    per_sample(fs);
+    sum += (double)val[n];
+  }
+
+  ns = (double)(test_now_ns() - t0) / ((double)SAMPLES * LOOPS);
+  printf("per sample   %8.3f ns/sample\n", ns);
+
+  t0 = test_now_ns();
+
+  for (n = 0; n < LOOPS; n++)
+  {
+    ism330dhcx_from_fs_xl_to_mg_array(fs, lsb, val, SAMPLES);
+    sum += (double)val[n];
+  }
+
+  ns = (double)(test_now_ns() - t0) / ((double)SAMPLES * LOOPS);
+  printf("array        %8.3f ns/sample\n", ns);
+
+  t0 = test_now_ns();
+
+  for (n = 0; n < LOOPS; n++)
+  {
+    ism330dhcx_from_fs_xl_to_g_q16_array(fs, lsb, fix, SAMPLES);
+    sum += (double)fix[n];
+  }
+
+  ns = (double)(test_now_ns() - t0) / ((double)SAMPLES * LOOPS);
+  printf("array q16    %8.3f ns/sample (%g)\n", ns, sum);
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * FIFO word decoding over millions of words: former tag switch plus a
+ * dispatch switch, against the table-driven decoder (which also checks
+ * the parity and extracts the tag counter).
+ */
+#include "test.h"
+#include "fifo_ref.h"
+
+#define WORDS                                   4096
+#define ROUNDS                                  1000
+
+static uint8_t buff[WORDS * ISM330DHCX_FIFO_WORD_LEN];
+static volatile uint32_t sum;
+
+static void on_word(void *arg, const ism330dhcx_fifo_word_t *w)
+{
+  (void)arg;
+  sum += (uint32_t)w->data[0] + w->cnt;
+}
+
+static void switch_path(void)
+{
+  ism330dhcx_fifo_word_t w;
+  int i;
+
+  for (i = 0; i < WORDS; i++)
+  {
+    w.tag = ref_tag_switch((uint8_t)(buff[i * ISM330DHCX_FIFO_WORD_LEN] >> 3));
+    w.cnt = 0;
+    w.data = &buff[(i * ISM330DHCX_FIFO_WORD_LEN) + 1];
+
+    switch (w.tag)
+    {
+      case ISM330DHCX_XL_NC_TAG:
+      case ISM330DHCX_GYRO_NC_TAG:
+      case ISM330DHCX_TIMESTAMP_TAG:
+      case ISM330DHCX_TEMPERATURE_TAG:
+        on_word(NULL, &w);
+        break;
+
+      default:
+        break;
+    }
+  }
+}
+
+int main(void)
+{
+  static const uint8_t tags[8] =
+  {
+    ISM330DHCX_TIMESTAMP_TAG, ISM330DHCX_GYRO_NC_TAG, ISM330DHCX_XL_NC_TAG,
+    ISM330DHCX_GYRO_NC_TAG, ISM330DHCX_XL_NC_TAG, ISM330DHCX_TEMPERATURE_TAG,
+    ISM330DHCX_GYRO_NC_TAG, ISM330DHCX_XL_NC_TAG,
+  };
+  ism330dhcx_fifo_decoder_t dec;
+  uint64_t t0;
+  double ns_switch;
+  double ns_table;
+  int i;
+
+  for (i = 0; i < WORDS; i++)
+  {
+    ref_word(&buff[i * ISM330DHCX_FIFO_WORD_LEN], tags[i % 8], (uint8_t)(i / 3),
+             (int16_t)i, (int16_t)-i, 1000);
+  }
+
+  ism330dhcx_fifo_decoder_init(&dec, NULL);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_XL_NC_TAG, on_word);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_GYRO_NC_TAG, on_word);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_TIMESTAMP_TAG, on_word);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_TEMPERATURE_TAG,
+                                      on_word);
+
+  t0 = test_now_ns();
+
+  for (i = 0; i < ROUNDS; i++)
+  {
+    switch_path();
+  }
+
+  ns_switch = (double)(test_now_ns() - t0) / ((double)WORDS * ROUNDS);
+  t0 = test_now_ns();
+
+  for (i = 0; i < ROUNDS; i++)
+  {
+    (void)ism330dhcx_fifo_decode(&dec, buff, WORDS);
+  }
+
+  ns_table = (double)(test_now_ns() - t0) / ((double)WORDS * ROUNDS);
+
+  printf("%d words\n", WORDS * ROUNDS);
+  printf("switch        %6.2f ns/word (no parity check)\n", ns_switch);
+  printf("table         %6.2f ns/word (parity, tag counter)\n", ns_table);
+  printf("parity errors %lu\n", (unsigned long)dec.parity_err);
+
+  return 0;
+}
@@ -0,0 +1,70 @@
+/*
+ * Cost of the interface lock on a read-modify-write call
+ * (ism330dhcx_xl_full_scale_set): without lock, uncontended lock, and
+ * lock contended by a thread running embedded functions bank sessions.
+ */
+#include "test.h"
+#include "lock.h"
+
+#define LOOPS                                   200000
+
+static stmdev_ctx_t ctx;
+static ism330dhcx_emu_t emu;
+static ism330dhcx_priv_t priv;
+static test_lock_t lock;
+static volatile int stop;
+
+static void *emb_thread(void *arg)
+{
+  uint8_t val;
+
+  (void)arg;
+
+  while (stop == 0)
+  {
+    (void)ism330dhcx_emb_session_start(&ctx);
+    (void)ism330dhcx_read_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &val, 1);
+    (void)ism330dhcx_emb_session_stop(&ctx);
+  }
+
+  return NULL;
+}
+
+static double run(void)
+{
+  uint64_t t0;
+  int i;
+
+  t0 = test_now_ns();
+
+  for (i = 0; i < LOOPS; i++)
+  {
+    (void)ism330dhcx_xl_full_scale_set(&ctx, (ism330dhcx_fs_xl_t)(i & 3));
+  }
+
+  return (double)(test_now_ns() - t0) / LOOPS;
+}
+
+int main(void)
+{
+  pthread_t t;
+  unsigned long taken;
+  double ns;
+
+  test_emu_ctx(&ctx, &emu);
+  ctx.priv_data = &priv;
+  printf("no lock      %8.1f ns/call\n", run());
+
+  test_lock_attach(&priv, &lock);
+  taken = lock.taken;
+  ns = run();
+  printf("uncontended  %8.1f ns/call (%lu lock calls/call)\n", ns,
+         (lock.taken - taken) / LOOPS);
+
+  pthread_create(&t, NULL, emb_thread, NULL);
+  printf("contended    %8.1f ns/call\n", run());
+  stop = 1;
+  pthread_join(t, NULL);
+
+  return 0;
+}
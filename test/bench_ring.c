@@ -0,0 +1,104 @@
+/*
+ * Sample ring handoff between a producer and a consumer thread:
+ * throughput of a full-speed stream, and push-to-pop latency of single
+ * samples passed through an empty ring.
+ */
+#include <pthread.h>
+#include <sched.h>
+
+#include "test.h"
+
+#define RING_LEN                                256U
+#define SAMPLES                                 4000000U
+#define PINGS                                   200000U
+
+static ism330dhcx_ring_t ring;
+static ism330dhcx_ring_t back;
+static ism330dhcx_fifo_sample_t buf[RING_LEN];
+static ism330dhcx_fifo_sample_t back_buf[RING_LEN];
+
+static void *stream(void *arg)
+{
+  ism330dhcx_fifo_sample_t s = { ISM330DHCX_XL_NC_TAG, 0, { 1, 2, 3 } };
+  uint32_t n;
+
+  (void)arg;
+
+  for (n = 0; n < SAMPLES; n++)
+  {
+    s.val[0] = (int16_t)n;
+
+    while (ism330dhcx_ring_push(&ring, &s) != 0)
+    {
+      (void)sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+static void *echo(void *arg)
+{
+  ism330dhcx_fifo_sample_t s;
+  uint32_t n;
+
+  (void)arg;
+
+  for (n = 0; n < PINGS; n++)
+  {
+    while (ism330dhcx_ring_pop(&ring, &s) != 0)
+    {
+      (void)sched_yield();
+    }
+
+    (void)ism330dhcx_ring_push(&back, &s);
+  }
+
+  return NULL;
+}
+
+int main(void)
+{
+  ism330dhcx_fifo_sample_t s = { ISM330DHCX_GYRO_NC_TAG, 0, { 0, 0, 0 } };
+  pthread_t t;
+  uint64_t t0;
+  uint32_t n;
+
+  (void)ism330dhcx_ring_init(&ring, buf, RING_LEN);
+  t0 = test_now_ns();
+  (void)pthread_create(&t, NULL, stream, NULL);
+
+  for (n = 0; n < SAMPLES; n++)
+  {
+    while (ism330dhcx_ring_pop(&ring, &s) != 0)
+    {
+      (void)sched_yield();
+    }
+  }
+
+  (void)pthread_join(t, NULL);
+  printf("stream       %8.1f ns/sample (full retries %lu)\n",
+         (double)(test_now_ns() - t0) / SAMPLES,
+         (unsigned long)ring.overflow);
+
+  (void)ism330dhcx_ring_init(&ring, buf, RING_LEN);
+  (void)ism330dhcx_ring_init(&back, back_buf, RING_LEN);
+  (void)pthread_create(&t, NULL, echo, NULL);
+  t0 = test_now_ns();
+
+  for (n = 0; n < PINGS; n++)
+  {
+    (void)ism330dhcx_ring_push(&ring, &s);
+
+    while (ism330dhcx_ring_pop(&back, &s) != 0)
+    {
+      (void)sched_yield();
+    }
+  }
+
+  (void)pthread_join(t, NULL);
+  printf("round trip   %8.1f ns/sample\n",
+         (double)(test_now_ns() - t0) / PINGS);
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * Watermark interrupt rate of the adaptive controller on a simulated
+ * 10 minute stream with a single 40 word burst at t = 120 s: steady
+ * interrupts per second before the burst, over the last minute, and with
+ * a residual excess of 7 words left over by a decay that never reaches 0.
+ */
+#include "test.h"
+
+#define RATE                                    1000U   /* words/s */
+#define DRAIN                                   1000U   /* us      */
+#define BURST_S                                 120U
+#define END_S                                   600U
+#define WINDOW_S                                60U
+
+int main(void)
+{
+  stmdev_ctx_t ctx;
+  ism330dhcx_emu_t emu;
+  ism330dhcx_wtm_ctrl_t ctrl;
+  uint64_t t = 0;
+  uint32_t irq_before = 0;
+  uint32_t irq_after = 0;
+  uint16_t wtm_before = 0;
+  uint16_t level;
+  int burst = 0;
+
+  test_emu_ctx(&ctx, &emu);
+  ism330dhcx_wtm_ctrl_init(&ctrl, RATE, 1000000U, 1U, 438U);
+
+  /* t in us, one watermark interrupt every wtm words */
+  while (t < (uint64_t)END_S * 1000000U)
+  {
+    level = ctrl.wtm;
+
+    if ((burst == 0) && (t >= (uint64_t)BURST_S * 1000000U))
+    {
+      level += 40U;
+      burst = 1;
+    }
+
+    if ((burst == 0) && (t >= (uint64_t)(BURST_S - WINDOW_S) * 1000000U))
+    {
+      irq_before++;
+      wtm_before = ctrl.wtm;
+    }
+
+    if (t >= (uint64_t)(END_S - WINDOW_S) * 1000000U)
+    {
+      irq_after++;
+    }
+
+    t += ((uint64_t)level * 1000000U) / RATE;
+    (void)ism330dhcx_wtm_ctrl_update(&ctx, &ctrl, level, DRAIN);
+  }
+
+  printf("before burst %8.3f irq/s (wtm %u)\n",
+         (double)irq_before / WINDOW_S, (unsigned)wtm_before);
+  printf("last window  %8.3f irq/s (wtm %u)\n",
+         (double)irq_after / WINDOW_S, (unsigned)ctrl.wtm);
+  printf("excess 7     %8.3f irq/s (wtm %u)\n",
+         (double)RATE / (ISM330DHCX_FIFO_WORDS - 2U * (1U + 7U)),
+         (unsigned)(ISM330DHCX_FIFO_WORDS - 2U * (1U + 7U)));
+
+  return 0;
+}
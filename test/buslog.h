@@ -0,0 +1,119 @@
+/*
+ * Bus access log: read_reg / write_reg forwarding to an emulator and
+ * recording every access with the bank selected when it was issued, so
+ * that tests can check the sequence of transfers.
+ */
+#ifndef BUSLOG_H
+#define BUSLOG_H
+
+#include "test.h"
+
+#define BUSLOG_MAX                              64
+#define BUSLOG_DATA                             16
+
+typedef struct
+{
+  uint8_t rd;               /* 1 read, 0 write                      */
+  uint8_t bank;             /* ism330dhcx_reg_access_t at issue     */
+  uint8_t reg;
+  uint16_t len;
+  uint8_t data[BUSLOG_DATA];  /* first bytes transferred            */
+} buslog_acc_t;
+
+typedef struct
+{
+  ism330dhcx_emu_t emu;
+  buslog_acc_t acc[BUSLOG_MAX];
+  int n;                    /* accesses recorded                    */
+  int total;                /* accesses issued, recorded or not     */
+} buslog_t;
+
+static inline void buslog_record(buslog_t *log, uint8_t rd, uint8_t reg,
+                                 const uint8_t *data, uint16_t len)
+{
+  const ism330dhcx_func_cfg_access_t *func_cfg_access =
+    (const ism330dhcx_func_cfg_access_t *)
+    &log->emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS];
+  buslog_acc_t *acc;
+  uint16_t i;
+
+  log->total++;
+
+  if (log->n == BUSLOG_MAX)
+  {
+    return;
+  }
+
+  acc = &log->acc[log->n];
+  acc->rd = rd;
+  acc->bank = func_cfg_access->reg_access;
+  acc->reg = reg;
+  acc->len = len;
+
+  for (i = 0; (i < len) && (i < BUSLOG_DATA); i++)
+  {
+    acc->data[i] = data[i];
+  }
+
+  log->n++;
+}
+
+static inline int32_t buslog_read(void *handle, uint8_t reg, uint8_t *data,
+                                  uint16_t len)
+{
+  buslog_t *log = (buslog_t *)handle;
+  int32_t ret;
+
+  ret = ism330dhcx_emu_read_reg(&log->emu, reg, data, len);
+  buslog_record(log, 1, reg, data, len);
+
+  return ret;
+}
+
+static inline int32_t buslog_write(void *handle, uint8_t reg,
+                                   const uint8_t *data, uint16_t len)
+{
+  buslog_t *log = (buslog_t *)handle;
+
+  buslog_record(log, 0, reg, data, len);
+
+  return ism330dhcx_emu_write_reg(&log->emu, reg, data, len);
+}
+
+/* Device context on a logged emulator */
+static inline void buslog_ctx(stmdev_ctx_t *ctx, buslog_t *log)
+{
+  test_emu_ctx(ctx, &log->emu);
+  ctx->write_reg = buslog_write;
+  ctx->read_reg = buslog_read;
+  ctx->handle = log;
+  log->n = 0;
+  log->total = 0;
+}
+
+static inline void buslog_clear(buslog_t *log)
+{
+  log->n = 0;
+  log->total = 0;
+}
+
+/* Writes of FUNC_CFG_ACCESS recorded */
+static inline int buslog_bank_writes(const buslog_t *log)
+{
+  int n = 0;
+  int i;
+
+  for (i = 0; i < log->n; i++)
+  {
+    if ((log->acc[i].rd == 0U) &&
+        (log->acc[i].reg <= ISM330DHCX_FUNC_CFG_ACCESS) &&
+        ((log->acc[i].reg + log->acc[i].len) > ISM330DHCX_FUNC_CFG_ACCESS))
+    {
+      n++;
+    }
+  }
+
+  return n;
+}
+
+#endif /* BUSLOG_H */
@@ -0,0 +1,81 @@
+/*
+ * FIFO word helpers: word encoder with tag counter and parity, and the
+ * switch-based tag conversion the table-driven decoder replaced, kept as
+ * reference and benchmark baseline.
+ */
+#ifndef FIFO_REF_H
+#define FIFO_REF_H
+
+#include "ism330dhcx_reg.h"
+
+/* Tag byte: tag_sensor [7:3], tag_cnt [2:1], even parity on bit 0 */
+static inline uint8_t ref_tag_byte(uint8_t tag, uint8_t cnt)
+{
+  uint8_t b = (uint8_t)((tag << 3) | ((cnt & 3U) << 1));
+  uint8_t p = b;
+
+  p ^= p >> 4;
+  p ^= p >> 2;
+  p ^= p >> 1;
+
+  return (uint8_t)(b | (p & 1U));
+}
+
+static inline void ref_word(uint8_t *w, uint8_t tag, uint8_t cnt,
+                            int16_t x, int16_t y, int16_t z)
+{
+  w[0] = ref_tag_byte(tag, cnt);
+  w[1] = (uint8_t)((uint16_t)x & 0xFFU);
+  w[2] = (uint8_t)((uint16_t)x >> 8);
+  w[3] = (uint8_t)((uint16_t)y & 0xFFU);
+  w[4] = (uint8_t)((uint16_t)y >> 8);
+  w[5] = (uint8_t)((uint16_t)z & 0xFFU);
+  w[6] = (uint8_t)((uint16_t)z >> 8);
+}
+
+static inline ism330dhcx_fifo_tag_t ref_tag_switch(uint8_t tag_sensor)
+{
+  switch (tag_sensor)
+  {
+    case ISM330DHCX_GYRO_NC_TAG:
+      return ISM330DHCX_GYRO_NC_TAG;
+    case ISM330DHCX_XL_NC_TAG:
+      return ISM330DHCX_XL_NC_TAG;
+    case ISM330DHCX_TEMPERATURE_TAG:
+      return ISM330DHCX_TEMPERATURE_TAG;
+    case ISM330DHCX_TIMESTAMP_TAG:
+      return ISM330DHCX_TIMESTAMP_TAG;
+    case ISM330DHCX_CFG_CHANGE_TAG:
+      return ISM330DHCX_CFG_CHANGE_TAG;
+    case ISM330DHCX_XL_NC_T_2_TAG:
+      return ISM330DHCX_XL_NC_T_2_TAG;
+    case ISM330DHCX_XL_NC_T_1_TAG:
+      return ISM330DHCX_XL_NC_T_1_TAG;
+    case ISM330DHCX_XL_2XC_TAG:
+      return ISM330DHCX_XL_2XC_TAG;
+    case ISM330DHCX_XL_3XC_TAG:
+      return ISM330DHCX_XL_3XC_TAG;
+    case ISM330DHCX_GYRO_NC_T_2_TAG:
+      return ISM330DHCX_GYRO_NC_T_2_TAG;
+    case ISM330DHCX_GYRO_NC_T_1_TAG:
+      return ISM330DHCX_GYRO_NC_T_1_TAG;
+    case ISM330DHCX_GYRO_2XC_TAG:
+      return ISM330DHCX_GYRO_2XC_TAG;
+    case ISM330DHCX_GYRO_3XC_TAG:
+      return ISM330DHCX_GYRO_3XC_TAG;
+    case ISM330DHCX_SENSORHUB_SLAVE0_TAG:
+      return ISM330DHCX_SENSORHUB_SLAVE0_TAG;
+    case ISM330DHCX_SENSORHUB_SLAVE1_TAG:
+      return ISM330DHCX_SENSORHUB_SLAVE1_TAG;
+    case ISM330DHCX_SENSORHUB_SLAVE2_TAG:
+      return ISM330DHCX_SENSORHUB_SLAVE2_TAG;
+    case ISM330DHCX_SENSORHUB_SLAVE3_TAG:
+      return ISM330DHCX_SENSORHUB_SLAVE3_TAG;
+    case ISM330DHCX_STEP_CPUNTER_TAG:
+      return ISM330DHCX_STEP_CPUNTER_TAG;
+    default:
+      return ISM330DHCX_SENSORHUB_NACK_TAG;
+  }
+}
+
+#endif /* FIFO_REF_H */
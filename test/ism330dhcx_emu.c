@@ -0,0 +1,735 @@
+/*
+ * Register model of the ISM330DHCX, see ism330dhcx_emu.h.
+ */
+#include "ism330dhcx_emu.h"
+
+/**
+  * @defgroup   ISM330DHCX_Emulator
+  * @brief      This section groups the functions of the emulator backend,
+  *             a register model of the device for host-side testing.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Period of a data rate code on the emulator time base.
+  *
+  * @param  code   ODR / BDR code, 1 (12.5 Hz) .. 10 (6667 Hz)
+  * @param  slow   Period of code 11 (1.6 Hz / 6.5 Hz), 0 if not allowed
+  * @retval        Period in base periods, 0 -> off
+  *
+  */
+static uint32_t ism330dhcx_emu_period(uint8_t code, uint32_t slow)
+{
+  uint32_t ret = 0;
+
+  if ((code >= 1U) && (code <= 10U))
+  {
+    ret = (uint32_t)1U << (10U - code);
+  }
+
+  else if (code == 11U)
+  {
+    ret = slow;
+  }
+
+  else
+  {
+    /* power-down or reserved */
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Restore the user bank defaults and empty the FIFO.
+  *
+  * @param  emu    Emulator.(ptr)
+  *
+  */
+static void ism330dhcx_emu_reset(ism330dhcx_emu_t *emu)
+{
+  uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  uint8_t i;
+
+  for (i = 0; i < 0x80U; i++)
+  {
+    reg[i] = 0;
+  }
+
+  reg[ISM330DHCX_PIN_CTRL] = 0x3FU;
+  reg[ISM330DHCX_WHO_AM_I] = ISM330DHCX_ID;
+  reg[ISM330DHCX_CTRL3_C] = 0x04U; /* IF_INC */
+
+  for (i = 0; i < 3U; i++)
+  {
+    emu->cfg[i] = 0;
+  }
+
+  emu->head = 0;
+  emu->level = 0;
+  emu->ovr = 0;
+  emu->ovr_latched = 0;
+  emu->cnt = 0;
+}
+
+/**
+  * @brief  Write a word in the emulated FIFO, with the tag counter of
+  *         the current time slot and the tag parity.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  tag    Sensor tag
+  * @param  data   6 data bytes.(ptr)
+  *
+  */
+static void ism330dhcx_emu_push(ism330dhcx_emu_t *emu,
+                                ism330dhcx_fifo_tag_t tag,
+                                const uint8_t *data)
+{
+  const uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  const ism330dhcx_fifo_ctrl2_t *fifo_ctrl2 =
+    (const ism330dhcx_fifo_ctrl2_t *)&reg[ISM330DHCX_FIFO_CTRL2];
+  const ism330dhcx_fifo_ctrl4_t *fifo_ctrl4 =
+    (const ism330dhcx_fifo_ctrl4_t *)&reg[ISM330DHCX_FIFO_CTRL4];
+  uint16_t depth = ISM330DHCX_FIFO_WORDS;
+  uint16_t wtm;
+  uint16_t pos;
+  uint8_t parity;
+  uint8_t i;
+
+  if (fifo_ctrl4->fifo_mode == (uint8_t)ISM330DHCX_BYPASS_MODE)
+  {
+    return;
+  }
+
+  wtm = (uint16_t)fifo_ctrl2->wtm;
+  wtm = (wtm * 256U) + (uint16_t)reg[ISM330DHCX_FIFO_CTRL1];
+
+  if ((fifo_ctrl2->stop_on_wtm == PROPERTY_ENABLE) && (wtm != 0U) &&
+      (wtm < depth))
+  {
+    depth = wtm;
+  }
+
+  if (emu->level >= depth)
+  {
+    if ((fifo_ctrl4->fifo_mode == (uint8_t)ISM330DHCX_FIFO_MODE) ||
+        (fifo_ctrl4->fifo_mode == (uint8_t)ISM330DHCX_BYPASS_TO_FIFO_MODE))
+    {
+      /* FIFO mode: batching stops when the FIFO is full */
+      emu->dropped++;
+
+      return;
+    }
+
+    /* continuous mode: the oldest word is overwritten */
+    emu->head = (uint16_t)((emu->head + 1U) % ISM330DHCX_FIFO_WORDS);
+    emu->level--;
+    emu->ovr = PROPERTY_ENABLE;
+    emu->ovr_latched = PROPERTY_ENABLE;
+    emu->overwritten++;
+  }
+
+  pos = (uint16_t)((emu->head + emu->level) % ISM330DHCX_FIFO_WORDS);
+  emu->fifo[pos][0] = (uint8_t)(((uint8_t)tag << 3) | (emu->cnt << 1));
+  parity = emu->fifo[pos][0];
+  parity ^= parity >> 4;
+  parity ^= parity >> 2;
+  parity ^= parity >> 1;
+  emu->fifo[pos][0] |= parity & 0x01U;
+
+  for (i = 0; i < 6U; i++)
+  {
+    emu->fifo[pos][i + 1U] = data[i];
+  }
+
+  emu->level++;
+  emu->words_in++;
+}
+
+/**
+  * @brief  Value of the timestamp counter (25 us LSB) at a given time.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  ns     Time [ns]
+  * @retval        TIMESTAMP0..3 value
+  *
+  */
+static uint32_t ism330dhcx_emu_timestamp(const ism330dhcx_emu_t *emu,
+                                         uint64_t ns)
+{
+  return (uint32_t)((ns - emu->ts_base) / 25000U);
+}
+
+/**
+  * @brief  Generate a sample: output registers and data-ready flag
+  *         updated, little-endian bytes returned for the FIFO.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  tag    ISM330DHCX_XL_NC_TAG, ISM330DHCX_GYRO_NC_TAG or
+  *                ISM330DHCX_TEMPERATURE_TAG
+  * @param  ns     Sample time [ns]
+  * @param  data   6 data bytes.(ptr)
+  *
+  */
+static void ism330dhcx_emu_sample(ism330dhcx_emu_t *emu,
+                                  ism330dhcx_fifo_tag_t tag, uint64_t ns,
+                                  uint8_t *data)
+{
+  uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  int16_t val[3];
+  uint8_t out;
+  uint8_t num = 3;
+  uint8_t drdy;
+  uint8_t i;
+
+  if (tag == ISM330DHCX_XL_NC_TAG)
+  {
+    out = ISM330DHCX_OUTX_L_A;
+    drdy = 0x01U;
+
+    for (i = 0; i < 3U; i++)
+    {
+      val[i] = emu->xl[i];
+    }
+  }
+
+  else if (tag == ISM330DHCX_GYRO_NC_TAG)
+  {
+    out = ISM330DHCX_OUTX_L_G;
+    drdy = 0x02U;
+
+    for (i = 0; i < 3U; i++)
+    {
+      val[i] = emu->gy[i];
+    }
+  }
+
+  else
+  {
+    out = ISM330DHCX_OUT_TEMP_L;
+    drdy = 0x04U;
+    num = 1;
+    val[0] = emu->temp;
+    val[1] = 0;
+    val[2] = 0;
+  }
+
+  if (emu->sample != NULL)
+  {
+    emu->sample(emu->arg, tag, ns, val);
+  }
+
+  for (i = 0; i < 3U; i++)
+  {
+    data[2U * i] = (uint8_t)((uint16_t)val[i] & 0xFFU);
+    data[(2U * i) + 1U] = (uint8_t)((uint16_t)val[i] >> 8);
+  }
+
+  for (i = 0; i < (2U * num); i++)
+  {
+    reg[out + i] = data[i];
+  }
+
+  reg[ISM330DHCX_STATUS_REG] |= drdy;
+}
+
+/**
+  * @brief  Run one base period: sensors whose data rate divides the
+  *         current period generate a sample, and the batched ones make
+  *         a time slot in the FIFO.
+  *
+  * @param  emu    Emulator.(ptr)
+  *
+  */
+static void ism330dhcx_emu_tick(ism330dhcx_emu_t *emu)
+{
+  const uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  const ism330dhcx_ctrl1_xl_t *ctrl1_xl =
+    (const ism330dhcx_ctrl1_xl_t *)&reg[ISM330DHCX_CTRL1_XL];
+  const ism330dhcx_ctrl2_g_t *ctrl2_g =
+    (const ism330dhcx_ctrl2_g_t *)&reg[ISM330DHCX_CTRL2_G];
+  const ism330dhcx_fifo_ctrl3_t *fifo_ctrl3 =
+    (const ism330dhcx_fifo_ctrl3_t *)&reg[ISM330DHCX_FIFO_CTRL3];
+  const ism330dhcx_fifo_ctrl4_t *fifo_ctrl4 =
+    (const ism330dhcx_fifo_ctrl4_t *)&reg[ISM330DHCX_FIFO_CTRL4];
+  static const uint32_t t_period[4] = { 0U, 4096U, 512U, 128U };
+  static const uint32_t ts_dec[4] = { 0U, 1U, 8U, 32U };
+  uint64_t ns = (uint64_t)emu->tick * ISM330DHCX_EMU_BASE_NS;
+  uint32_t odr_xl = ism330dhcx_emu_period(ctrl1_xl->odr_xl, 4096U);
+  uint32_t odr_gy = ism330dhcx_emu_period(ctrl2_g->odr_g, 0U);
+  uint32_t bdr_xl = ism330dhcx_emu_period(fifo_ctrl3->bdr_xl, 4096U);
+  uint32_t bdr_gy = ism330dhcx_emu_period(fifo_ctrl3->bdr_gy, 1024U);
+  uint32_t bdr_t = t_period[fifo_ctrl4->odr_t_batch];
+  uint32_t dec = ts_dec[fifo_ctrl4->odr_ts_batch];
+  uint8_t data[3][6];
+  uint8_t ts[6] = { 0U, 0U, 0U, 0U, 0U, 0U };
+  uint8_t batch[3] = { 0U, 0U, 0U };
+  uint32_t raw;
+
+  /* batch data rates cannot exceed the output data rates */
+  bdr_xl = ((odr_xl == 0U) || (bdr_xl == 0U)) ? 0U :
+           ((bdr_xl > odr_xl) ? bdr_xl : odr_xl);
+  bdr_gy = ((odr_gy == 0U) || (bdr_gy == 0U)) ? 0U :
+           ((bdr_gy > odr_gy) ? bdr_gy : odr_gy);
+  bdr_t = ((odr_xl == 0U) && (odr_gy == 0U)) ? 0U : bdr_t;
+
+  if ((odr_gy != 0U) && ((emu->tick % odr_gy) == 0U))
+  {
+    ism330dhcx_emu_sample(emu, ISM330DHCX_GYRO_NC_TAG, ns, data[0]);
+    batch[0] = ((bdr_gy != 0U) && ((emu->tick % bdr_gy) == 0U)) ? 1U : 0U;
+  }
+
+  if ((odr_xl != 0U) && ((emu->tick % odr_xl) == 0U))
+  {
+    ism330dhcx_emu_sample(emu, ISM330DHCX_XL_NC_TAG, ns, data[1]);
+    batch[1] = ((bdr_xl != 0U) && ((emu->tick % bdr_xl) == 0U)) ? 1U : 0U;
+  }
+
+  /* temperature output at 52 Hz while a sensor is on */
+  if (((odr_xl != 0U) || (odr_gy != 0U)) &&
+      (((emu->tick % 128U) == 0U) ||
+       ((bdr_t != 0U) && ((emu->tick % bdr_t) == 0U))))
+  {
+    ism330dhcx_emu_sample(emu, ISM330DHCX_TEMPERATURE_TAG, ns, data[2]);
+    batch[2] = ((bdr_t != 0U) && ((emu->tick % bdr_t) == 0U)) ? 1U : 0U;
+  }
+
+  if ((batch[0] | batch[1] | batch[2]) == 0U)
+  {
+    return;
+  }
+
+  if ((dec != 0U) && ((emu->slots % dec) == 0U))
+  {
+    raw = ism330dhcx_emu_timestamp(emu, ns);
+    ts[0] = (uint8_t)(raw & 0xFFU);
+    ts[1] = (uint8_t)((raw >> 8) & 0xFFU);
+    ts[2] = (uint8_t)((raw >> 16) & 0xFFU);
+    ts[3] = (uint8_t)(raw >> 24);
+    ism330dhcx_emu_push(emu, ISM330DHCX_TIMESTAMP_TAG, ts);
+  }
+
+  if (batch[0] == 1U)
+  {
+    ism330dhcx_emu_push(emu, ISM330DHCX_GYRO_NC_TAG, data[0]);
+  }
+
+  if (batch[1] == 1U)
+  {
+    ism330dhcx_emu_push(emu, ISM330DHCX_XL_NC_TAG, data[1]);
+  }
+
+  if (batch[2] == 1U)
+  {
+    ism330dhcx_emu_push(emu, ISM330DHCX_TEMPERATURE_TAG, data[2]);
+  }
+
+  emu->slots++;
+  emu->cnt = (emu->cnt + 1U) & 0x03U;
+}
+
+/**
+  * @brief  Write a CFG_CHANGE word when the data rates or full scales
+  *         change with FIFO_CTRL2.ODRCHG_EN set. Payload: CTRL1_XL,
+  *         CTRL2_G and FIFO_CTRL3 values in data bytes 0 to 2.
+  *
+  * @param  emu    Emulator.(ptr)
+  *
+  */
+static void ism330dhcx_emu_cfg_check(ism330dhcx_emu_t *emu)
+{
+  const uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  const ism330dhcx_fifo_ctrl2_t *fifo_ctrl2 =
+    (const ism330dhcx_fifo_ctrl2_t *)&reg[ISM330DHCX_FIFO_CTRL2];
+  uint8_t data[6] = { 0U, 0U, 0U, 0U, 0U, 0U };
+
+  data[0] = reg[ISM330DHCX_CTRL1_XL];
+  data[1] = reg[ISM330DHCX_CTRL2_G];
+  data[2] = reg[ISM330DHCX_FIFO_CTRL3];
+
+  if ((data[0] == emu->cfg[0]) && (data[1] == emu->cfg[1]) &&
+      (data[2] == emu->cfg[2]))
+  {
+    return;
+  }
+
+  emu->cfg[0] = data[0];
+  emu->cfg[1] = data[1];
+  emu->cfg[2] = data[2];
+
+  if (fifo_ctrl2->odrchg_en == PROPERTY_ENABLE)
+  {
+    ism330dhcx_emu_push(emu, ISM330DHCX_CFG_CHANGE_TAG, data);
+  }
+}
+
+/**
+  * @brief  Next address of a multi-byte access.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  addr   Current address
+  * @retval        Next address
+  *
+  */
+static uint8_t ism330dhcx_emu_next(const ism330dhcx_emu_t *emu, uint8_t addr)
+{
+  const uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  const ism330dhcx_ctrl3_c_t *ctrl3_c =
+    (const ism330dhcx_ctrl3_c_t *)&reg[ISM330DHCX_CTRL3_C];
+  const ism330dhcx_func_cfg_access_t *func_cfg_access =
+    (const ism330dhcx_func_cfg_access_t *)&reg[ISM330DHCX_FUNC_CFG_ACCESS];
+  uint8_t ret = addr;
+
+  if (ctrl3_c->if_inc == PROPERTY_ENABLE)
+  {
+    if ((addr == ISM330DHCX_FIFO_DATA_OUT_Z_H) &&
+        (func_cfg_access->reg_access == (uint8_t)ISM330DHCX_USER_BANK))
+    {
+      ret = ISM330DHCX_FIFO_DATA_OUT_TAG;
+    }
+
+    else
+    {
+      ret = (uint8_t)((addr + 1U) & 0x7FU);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Read one register of the selected bank.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  addr   Register address
+  * @retval        Register value
+  *
+  */
+static uint8_t ism330dhcx_emu_get(ism330dhcx_emu_t *emu, uint8_t addr)
+{
+  uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  uint8_t *emb = emu->reg[ISM330DHCX_EMBEDDED_FUNC_BANK];
+  const ism330dhcx_func_cfg_access_t *func_cfg_access =
+    (const ism330dhcx_func_cfg_access_t *)&reg[ISM330DHCX_FUNC_CFG_ACCESS];
+  const ism330dhcx_page_rw_t *page_rw =
+    (const ism330dhcx_page_rw_t *)&emb[ISM330DHCX_PAGE_RW];
+  const ism330dhcx_page_sel_t *page_sel =
+    (const ism330dhcx_page_sel_t *)&emb[ISM330DHCX_PAGE_SEL];
+  ism330dhcx_fifo_status2_t fifo_status2;
+  uint16_t wtm;
+  uint8_t ret;
+
+  if ((addr == ISM330DHCX_FUNC_CFG_ACCESS) ||
+      (func_cfg_access->reg_access == (uint8_t)ISM330DHCX_USER_BANK))
+  {
+    /* user bank, below */
+  }
+
+  else if (func_cfg_access->reg_access ==
+           (uint8_t)ISM330DHCX_EMBEDDED_FUNC_BANK)
+  {
+    ret = emb[addr];
+
+    if ((addr == ISM330DHCX_PAGE_VALUE) && ((page_rw->page_rw & 0x01U) != 0U))
+    {
+      ret = emu->page[page_sel->page_sel][emb[ISM330DHCX_PAGE_ADDRESS]];
+      emb[ISM330DHCX_PAGE_ADDRESS]++;
+    }
+
+    return ret;
+  }
+
+  else
+  {
+    return emu->reg[ISM330DHCX_SENSOR_HUB_BANK][addr];
+  }
+
+  if ((addr >= ISM330DHCX_FIFO_DATA_OUT_TAG) &&
+      (addr <= ISM330DHCX_FIFO_DATA_OUT_Z_H))
+  {
+    ret = 0;
+
+    if (emu->level > 0U)
+    {
+      ret = emu->fifo[emu->head][addr - ISM330DHCX_FIFO_DATA_OUT_TAG];
+
+      if (addr == ISM330DHCX_FIFO_DATA_OUT_Z_H)
+      {
+        /* word popped with its last byte */
+        emu->head = (uint16_t)((emu->head + 1U) % ISM330DHCX_FIFO_WORDS);
+        emu->level--;
+        emu->ovr = PROPERTY_DISABLE;
+        emu->words_out++;
+      }
+    }
+  }
+
+  else if (addr == ISM330DHCX_FIFO_STATUS1)
+  {
+    ret = (uint8_t)(emu->level & 0xFFU);
+  }
+
+  else if (addr == ISM330DHCX_FIFO_STATUS2)
+  {
+    wtm = (uint16_t)reg[ISM330DHCX_FIFO_CTRL2] & 0x01U;
+    wtm = (wtm * 256U) + (uint16_t)reg[ISM330DHCX_FIFO_CTRL1];
+    fifo_status2.diff_fifo = (uint8_t)((emu->level >> 8) & 0x03U);
+    fifo_status2.not_used_01 = 0;
+    fifo_status2.over_run_latched = emu->ovr_latched;
+    fifo_status2.counter_bdr_ia = 0;
+    fifo_status2.fifo_full_ia =
+      (emu->level >= ISM330DHCX_FIFO_WORDS) ? 1U : 0U;
+    fifo_status2.fifo_ovr_ia = emu->ovr;
+    fifo_status2.fifo_wtm_ia = ((wtm != 0U) && (emu->level >= wtm)) ? 1U : 0U;
+    ret = *(uint8_t *)&fifo_status2;
+    /* the latched overrun flag is cleared by reading FIFO_STATUS2 */
+    emu->ovr_latched = PROPERTY_DISABLE;
+  }
+
+  else if ((addr >= ISM330DHCX_TIMESTAMP0) && (addr <= ISM330DHCX_TIMESTAMP3))
+  {
+    ret = (uint8_t)((ism330dhcx_emu_timestamp(emu, emu->ns) >>
+                     (8U * (addr - ISM330DHCX_TIMESTAMP0))) & 0xFFU);
+  }
+
+  else
+  {
+    ret = reg[addr];
+
+    if ((addr >= ISM330DHCX_OUT_TEMP_L) && (addr <= ISM330DHCX_OUTZ_H_A))
+    {
+      /* data-ready flags cleared by reading the outputs */
+      reg[ISM330DHCX_STATUS_REG] &= (addr >= ISM330DHCX_OUTX_L_A) ? 0xFEU :
+                                    ((addr >= ISM330DHCX_OUTX_L_G) ?
+                                     0xFDU : 0xFBU);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Write one register of the selected bank. Read-only user
+  *         registers are left unchanged.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  addr   Register address
+  * @param  val    Value to write
+  *
+  */
+static void ism330dhcx_emu_set(ism330dhcx_emu_t *emu, uint8_t addr,
+                               uint8_t val)
+{
+  uint8_t *reg = emu->reg[ISM330DHCX_USER_BANK];
+  uint8_t *emb = emu->reg[ISM330DHCX_EMBEDDED_FUNC_BANK];
+  const ism330dhcx_func_cfg_access_t *func_cfg_access =
+    (const ism330dhcx_func_cfg_access_t *)&reg[ISM330DHCX_FUNC_CFG_ACCESS];
+  const ism330dhcx_page_rw_t *page_rw =
+    (const ism330dhcx_page_rw_t *)&emb[ISM330DHCX_PAGE_RW];
+  const ism330dhcx_page_sel_t *page_sel =
+    (const ism330dhcx_page_sel_t *)&emb[ISM330DHCX_PAGE_SEL];
+  const ism330dhcx_fifo_ctrl4_t *fifo_ctrl4 =
+    (const ism330dhcx_fifo_ctrl4_t *)&reg[ISM330DHCX_FIFO_CTRL4];
+  ism330dhcx_ctrl3_c_t ctrl3_c;
+
+  if ((addr == ISM330DHCX_FUNC_CFG_ACCESS) ||
+      (func_cfg_access->reg_access == (uint8_t)ISM330DHCX_USER_BANK))
+  {
+    /* user bank, below */
+  }
+
+  else if (func_cfg_access->reg_access ==
+           (uint8_t)ISM330DHCX_EMBEDDED_FUNC_BANK)
+  {
+    if ((addr == ISM330DHCX_PAGE_VALUE) && ((page_rw->page_rw & 0x02U) != 0U))
+    {
+      emu->page[page_sel->page_sel][emb[ISM330DHCX_PAGE_ADDRESS]] = val;
+      emb[ISM330DHCX_PAGE_ADDRESS]++;
+    }
+
+    emb[addr] = val;
+
+    return;
+  }
+
+  else
+  {
+    emu->reg[ISM330DHCX_SENSOR_HUB_BANK][addr] = val;
+
+    return;
+  }
+
+  if ((addr == ISM330DHCX_WHO_AM_I) ||
+      ((addr >= ISM330DHCX_ALL_INT_SRC) && (addr <= ISM330DHCX_OUTZ_H_A)) ||
+      ((addr >= ISM330DHCX_EMB_FUNC_STATUS_MAINPAGE) &&
+       (addr <= ISM330DHCX_FIFO_STATUS2)) ||
+      ((addr >= ISM330DHCX_TIMESTAMP0) && (addr <= ISM330DHCX_TIMESTAMP3)) ||
+      (addr >= ISM330DHCX_FIFO_DATA_OUT_TAG))
+  {
+    if ((addr == ISM330DHCX_TIMESTAMP2) && (val == 0xAAU))
+    {
+      emu->ts_base = emu->ns;
+    }
+
+    return;
+  }
+
+  if (addr == ISM330DHCX_CTRL3_C)
+  {
+    ctrl3_c = *(ism330dhcx_ctrl3_c_t *)&val;
+
+    if (ctrl3_c.sw_reset == PROPERTY_ENABLE)
+    {
+      ism330dhcx_emu_reset(emu);
+
+      return;
+    }
+
+    /* boot: trimming reloaded, nothing else to model */
+    ctrl3_c.boot = PROPERTY_DISABLE;
+    val = *(uint8_t *)&ctrl3_c;
+  }
+
+  reg[addr] = val;
+
+  if ((addr == ISM330DHCX_FIFO_CTRL4) &&
+      (fifo_ctrl4->fifo_mode == (uint8_t)ISM330DHCX_BYPASS_MODE))
+  {
+    /* bypass mode empties the FIFO */
+    emu->head = 0;
+    emu->level = 0;
+    emu->ovr = PROPERTY_DISABLE;
+    emu->ovr_latched = PROPERTY_DISABLE;
+  }
+
+  if ((addr == ISM330DHCX_CTRL1_XL) || (addr == ISM330DHCX_CTRL2_G) ||
+      (addr == ISM330DHCX_FIFO_CTRL3))
+  {
+    ism330dhcx_emu_cfg_check(emu);
+  }
+}
+
+/**
+  * @brief  Initialize an emulator: registers at their power-on values,
+  *         FIFO empty, time 0, sensor data 0.
+  *
+  * @param  emu    Emulator.(ptr)
+  *
+  */
+void ism330dhcx_emu_init(ism330dhcx_emu_t *emu)
+{
+  uint16_t i;
+  uint16_t j;
+
+  for (i = 0; i < 0x80U; i++)
+  {
+    emu->reg[ISM330DHCX_SENSOR_HUB_BANK][i] = 0;
+    emu->reg[ISM330DHCX_EMBEDDED_FUNC_BANK][i] = 0;
+  }
+
+  for (i = 0; i < ISM330DHCX_EMU_PAGES; i++)
+  {
+    for (j = 0; j < 256U; j++)
+    {
+      emu->page[i][j] = 0;
+    }
+  }
+
+  emu->reg[ISM330DHCX_EMBEDDED_FUNC_BANK][ISM330DHCX_PAGE_SEL] = 0x01U;
+  ism330dhcx_emu_reset(emu);
+
+  for (i = 0; i < 3U; i++)
+  {
+    emu->xl[i] = 0;
+    emu->gy[i] = 0;
+  }
+
+  emu->temp = 0;
+  emu->sample = NULL;
+  emu->arg = NULL;
+  emu->ns = 0;
+  emu->ts_base = 0;
+  emu->tick = 0;
+  emu->slots = 0;
+  emu->words_in = 0;
+  emu->words_out = 0;
+  emu->overwritten = 0;
+  emu->dropped = 0;
+}
+
+/**
+  * @brief  Advance the emulated time: samples are generated and batched
+  *         at every base period elapsed.
+  *
+  * @param  emu    Emulator.(ptr)
+  * @param  us     Time to run [us]
+  *
+  */
+void ism330dhcx_emu_run(ism330dhcx_emu_t *emu, uint32_t us)
+{
+  emu->ns += (uint64_t)us * 1000U;
+
+  while ((((uint64_t)emu->tick + 1U) * ISM330DHCX_EMU_BASE_NS) <= emu->ns)
+  {
+    emu->tick++;
+    ism330dhcx_emu_tick(emu);
+  }
+}
+
+/**
+  * @brief  Emulator read routine (stmdev_ctx_t.read_reg).
+  *
+  * @param  handle  Emulator.(ptr)
+  * @param  reg     First register address
+  * @param  data    Buffer that stores data read.(ptr)
+  * @param  len     Number of consecutive registers to read
+  * @retval         0 -> no Error
+  *
+  */
+int32_t ism330dhcx_emu_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                uint16_t len)
+{
+  ism330dhcx_emu_t *emu = (ism330dhcx_emu_t *)handle;
+  uint8_t addr = reg & 0x7FU;
+  uint16_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    data[i] = ism330dhcx_emu_get(emu, addr);
+    addr = ism330dhcx_emu_next(emu, addr);
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Emulator write routine (stmdev_ctx_t.write_reg).
+  *
+  * @param  handle  Emulator.(ptr)
+  * @param  reg     First register address
+  * @param  data    Data to write.(ptr)
+  * @param  len     Number of consecutive registers to write
+  * @retval         0 -> no Error
+  *
+  */
+int32_t ism330dhcx_emu_write_reg(void *handle, uint8_t reg,
+                                 const uint8_t *data, uint16_t len)
+{
+  ism330dhcx_emu_t *emu = (ism330dhcx_emu_t *)handle;
+  uint8_t addr = reg & 0x7FU;
+  uint16_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    ism330dhcx_emu_set(emu, addr, data[i]);
+    addr = ism330dhcx_emu_next(emu, addr);
+  }
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
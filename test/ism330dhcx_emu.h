@@ -0,0 +1,85 @@
+/*
+ * Register model of the ISM330DHCX for host-side tests and benchmarks.
+ * Not part of the driver: linked only into the programs of this
+ * directory.
+ */
+#ifndef ISM330DHCX_EMU_H
+#define ISM330DHCX_EMU_H
+
+#include "ism330dhcx_reg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Emulator backend: read_reg / write_reg modelling the device registers,
+ * so that the driver runs on a host without a board. Set
+ * stmdev_ctx_t.handle to the ism330dhcx_emu_t. Modelled:
+ *   - user, sensor hub and embedded functions banks, selected by
+ *     FUNC_CFG_ACCESS (mapped in every bank);
+ *   - multi-byte accesses with CTRL3_C.IF_INC (address roll-back from
+ *     FIFO_DATA_OUT_Z_H to FIFO_DATA_OUT_TAG) and without it;
+ *   - advanced embedded function pages through PAGE_RW, PAGE_SEL,
+ *     PAGE_ADDRESS and PAGE_VALUE;
+ *   - self-clearing CTRL3_C.SW_RESET / BOOT and TIMESTAMP2 reset;
+ *   - data generation at the configured ODR on a 6667 Hz time base, and
+ *     a FIFO batching the accelerometer, gyroscope, temperature,
+ *     timestamp and CFG_CHANGE words with tag counter and parity, in
+ *     bypass, FIFO (stop when full) and continuous modes, with
+ *     watermark, full and overrun flags.
+ * Time only advances with ism330dhcx_emu_run(). Compression, sensor hub
+ * and embedded function engines are not modelled: their registers only
+ * hold the values written.
+ */
+#define ISM330DHCX_EMU_BASE_NS                  150000U /* 6667 Hz */
+#define ISM330DHCX_EMU_PAGES                    16U
+
+typedef void (*ism330dhcx_emu_sample_ptr)(void *, ism330dhcx_fifo_tag_t,
+                                          uint64_t, int16_t *);
+
+typedef struct
+{
+  /** Sensor data, filled by the application **/
+  int16_t xl[3];
+  int16_t gy[3];
+  int16_t temp;
+  /** Optional source overriding xl / gy / temp: called with
+    * ISM330DHCX_XL_NC_TAG, ISM330DHCX_GYRO_NC_TAG or
+    * ISM330DHCX_TEMPERATURE_TAG, the sample time [ns] and 3 values
+    * (1 for the temperature) to fill
+    */
+  ism330dhcx_emu_sample_ptr sample;
+  void *arg;
+  /** Emulator private fields **/
+  uint8_t reg[3][0x80];     /* indexed by ism330dhcx_reg_access_t   */
+  uint8_t page[ISM330DHCX_EMU_PAGES][256];
+  uint8_t fifo[ISM330DHCX_FIFO_WORDS][ISM330DHCX_FIFO_WORD_LEN];
+  uint16_t head;            /* oldest word                          */
+  uint16_t level;
+  uint8_t ovr;              /* fifo_ovr_ia                          */
+  uint8_t ovr_latched;      /* over_run_latched                     */
+  uint8_t cnt;              /* tag counter of the next time slot    */
+  uint8_t cfg[3];           /* CTRL1_XL, CTRL2_G, FIFO_CTRL3 seen   */
+  uint64_t ns;              /* time elapsed                         */
+  uint64_t ts_base;         /* time of the timestamp counter reset  */
+  uint32_t tick;            /* base periods elapsed                 */
+  uint32_t slots;           /* time slots batched                   */
+  uint32_t words_in;
+  uint32_t words_out;
+  uint32_t overwritten;
+  uint32_t dropped;
+} ism330dhcx_emu_t;
+
+void ism330dhcx_emu_init(ism330dhcx_emu_t *emu);
+void ism330dhcx_emu_run(ism330dhcx_emu_t *emu, uint32_t us);
+int32_t ism330dhcx_emu_read_reg(void *handle, uint8_t reg, uint8_t *data,
+                                uint16_t len);
+int32_t ism330dhcx_emu_write_reg(void *handle, uint8_t reg,
+                                 const uint8_t *data, uint16_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ISM330DHCX_EMU_H */
@@ -0,0 +1,54 @@
+/*
+ * Recursive pthread lock for ism330dhcx_priv_t, counting the levels
+ * taken so that tests can check every lock is released.
+ */
+#ifndef LOCK_H
+#define LOCK_H
+
+#include <pthread.h>
+
+typedef struct
+{
+  pthread_mutex_t mutex;
+  int depth;                /* levels taken, protected by mutex */
+  unsigned long taken;      /* lock() calls, protected by mutex */
+} test_lock_t;
+
+static inline void test_lock_init(test_lock_t *l)
+{
+  pthread_mutexattr_t attr;
+
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&l->mutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+  l->depth = 0;
+  l->taken = 0;
+}
+
+static inline void test_lock(void *handle)
+{
+  test_lock_t *l = (test_lock_t *)handle;
+
+  pthread_mutex_lock(&l->mutex);
+  l->depth++;
+  l->taken++;
+}
+
+static inline void test_unlock(void *handle)
+{
+  test_lock_t *l = (test_lock_t *)handle;
+
+  l->depth--;
+  pthread_mutex_unlock(&l->mutex);
+}
+
+static inline void test_lock_attach(ism330dhcx_priv_t *priv, test_lock_t *l)
+{
+  test_lock_init(l);
+  priv->lock = test_lock;
+  priv->unlock = test_unlock;
+  priv->lock_handle = l;
+}
+
+#endif /* LOCK_H */
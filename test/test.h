@@ -0,0 +1,56 @@
+/*
+ * Minimal test helpers: CHECK() records failures and TEST_END() turns
+ * them into the exit status.
+ */
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "ism330dhcx_reg.h"
+#include "ism330dhcx_emu.h"
+
+static inline int *test_failures(void)
+{
+  static int failures;
+
+  return &failures;
+}
+
+#define CHECK(cond)                                                      \
+  do {                                                                   \
+    if (!(cond)) {                                                       \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);   \
+      (*test_failures())++;                                              \
+    }                                                                    \
+  } while (0)
+
+#define TEST_END()                                                       \
+  do {                                                                   \
+    printf("%s\n", (*test_failures() == 0) ? "PASS" : "FAIL");          \
+    return (*test_failures() == 0) ? 0 : 1;                              \
+  } while (0)
+
+/* Device context on an emulator */
+static inline void test_emu_ctx(stmdev_ctx_t *ctx, ism330dhcx_emu_t *emu)
+{
+  ism330dhcx_emu_init(emu);
+  ctx->write_reg = ism330dhcx_emu_write_reg;
+  ctx->read_reg = ism330dhcx_emu_read_reg;
+  ctx->mdelay = NULL;
+  ctx->handle = emu;
+  ctx->priv_data = NULL;
+}
+
+/* Monotonic time [ns] for the benchmarks */
+static inline uint64_t test_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* TEST_H */
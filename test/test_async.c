@@ -0,0 +1,183 @@
+/*
+ * Asynchronous interface on a deferred-completion bus: submit only
+ * queues the request, bus_pump() transfers it on the emulator and
+ * completes it later, in submission order. Checks callback ordering,
+ * error propagation and reuse of a completed request.
+ */
+#include "test.h"
+
+#define PENDING_MAX                             8
+
+typedef struct
+{
+  ism330dhcx_emu_t emu;
+  ism330dhcx_async_req_t *pending[PENDING_MAX];
+  int n;
+  int32_t submit_ret;       /* returned by the next submits         */
+  int32_t fail;             /* status of the next completion        */
+} bus_t;
+
+static bus_t bus;
+static int order[16];
+static int done;
+
+static int32_t bus_submit(void *handle, ism330dhcx_async_req_t *req)
+{
+  bus_t *b = (bus_t *)handle;
+
+  if (b->submit_ret != 0)
+  {
+    return b->submit_ret;
+  }
+
+  if (b->n == PENDING_MAX)
+  {
+    return -1;
+  }
+
+  b->pending[b->n] = req;
+  b->n++;
+
+  return 0;
+}
+
+/* transfer and complete the pending requests, oldest first */
+static int bus_pump(bus_t *b)
+{
+  ism330dhcx_async_req_t *req;
+  int32_t status;
+  int n = b->n;
+  int i;
+
+  for (i = 0; i < n; i++)
+  {
+    req = b->pending[i];
+
+    if (req->dir == ISM330DHCX_ASYNC_READ)
+    {
+      status = ism330dhcx_emu_read_reg(&b->emu, req->reg, req->data,
+                                       req->len);
+    }
+
+    else
+    {
+      status = ism330dhcx_emu_write_reg(&b->emu, req->reg, req->data,
+                                        req->len);
+    }
+
+    if (b->fail != 0)
+    {
+      status = b->fail;
+      b->fail = 0;
+    }
+
+    ism330dhcx_async_complete(req, status);
+  }
+
+  b->n = 0;
+
+  return n;
+}
+
+static void on_complete(ism330dhcx_async_req_t *req)
+{
+  order[done] = *(const int *)req->arg;
+  done++;
+}
+
+int main(void)
+{
+  static const int id[4] = { 0, 1, 2, 3 };
+  ism330dhcx_async_ctx_t actx;
+  ism330dhcx_async_req_t req[3];
+  stmdev_ctx_t ctx;
+  ism330dhcx_status_reg_t status;
+  int16_t xl[3] = { 0, 0, 0 };
+  int16_t temp = 0;
+  uint8_t wr[2] = { 0x44, 0x00 };
+  uint8_t rd[2] = { 0, 0 };
+  uint16_t level;
+  int i;
+
+  test_emu_ctx(&ctx, &bus.emu);
+  actx.submit = bus_submit;
+  actx.handle = &bus;
+
+  for (i = 0; i < 3; i++)
+  {
+    req[i].complete = on_complete;
+    req[i].arg = (void *)&id[i];
+  }
+
+  bus.emu.xl[0] = 100;
+  bus.emu.xl[1] = -200;
+  bus.emu.xl[2] = 16393;
+  bus.emu.temp = 0x0123;
+  CHECK(ism330dhcx_xl_data_rate_set(&ctx, ISM330DHCX_XL_ODR_104Hz) == 0);
+  ism330dhcx_emu_run(&bus.emu, 20000U);
+
+  /* nothing completes before the bus does, then in submission order */
+  CHECK(ism330dhcx_async_write_reg(&actx, &req[0], ISM330DHCX_CTRL2_G, wr,
+                                   1) == 0);
+  CHECK(ism330dhcx_acceleration_raw_get_async(&actx, &req[1], xl) == 0);
+  CHECK(ism330dhcx_status_reg_get_async(&actx, &req[2], &status) == 0);
+  CHECK((bus.n == 3) && (done == 0));
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL2_G] == 0x00U);
+  CHECK(xl[0] == 0);
+  CHECK(bus_pump(&bus) == 3);
+  CHECK(done == 3);
+  CHECK((order[0] == 0) && (order[1] == 1) && (order[2] == 2));
+  CHECK((req[0].status == 0) && (req[1].status == 0) &&
+        (req[2].status == 0));
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL2_G] == 0x44U);
+  CHECK((xl[0] == 100) && (xl[1] == -200) && (xl[2] == 16393));
+  /* OUTZ_H_A read by req[1] cleared XLDA before req[2] ran */
+  CHECK(status.xlda == 0U);
+
+  /* raw read into the caller buffer */
+  CHECK(ism330dhcx_async_read_reg(&actx, &req[0], ISM330DHCX_CTRL1_XL, rd,
+                                  2) == 0);
+  CHECK((req[0].data == rd) && (req[0].len == 2U));
+  CHECK(bus_pump(&bus) == 1);
+  CHECK((rd[0] == bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL]) &&
+        (rd[1] == 0x44U));
+
+  /* a failed transfer is reported to the callback, without decoding */
+  done = 0;
+  bus.fail = -5;
+  ism330dhcx_emu_run(&bus.emu, 20000U);
+  xl[0] = 0;
+  CHECK(ism330dhcx_acceleration_raw_get_async(&actx, &req[1], xl) == 0);
+  CHECK(ism330dhcx_temperature_raw_get_async(&actx, &req[2], &temp) == 0);
+  CHECK(bus_pump(&bus) == 2);
+  CHECK((done == 2) && (order[0] == 1) && (order[1] == 2));
+  CHECK(req[1].status == -5);
+  CHECK(xl[0] == 0);
+  CHECK(req[2].status == 0);
+  CHECK(temp == 0x0123);
+
+  /* a submit refused by the bus never completes */
+  done = 0;
+  bus.submit_ret = -3;
+  CHECK(ism330dhcx_fifo_data_level_get_async(&actx, &req[0], &level) == -3);
+  CHECK((bus.n == 0) && (done == 0));
+  bus.submit_ret = 0;
+  CHECK(ism330dhcx_fifo_out_multi_raw_get_async(&actx, &req[0], rd, 0) == -1);
+  CHECK(ism330dhcx_async_read_reg(NULL, &req[0], 0, rd, 1) == -1);
+  CHECK(bus.n == 0);
+
+  /* the failed request is reused: status and decode step start afresh */
+  bus.emu.temp = -42;
+  ism330dhcx_emu_run(&bus.emu, 20000U);
+  temp = 0;
+  req[1].arg = (void *)&id[3];
+  CHECK(ism330dhcx_temperature_raw_get_async(&actx, &req[1], &temp) == 0);
+  CHECK(req[1].status == 0);
+  CHECK(bus_pump(&bus) == 1);
+  CHECK((done == 1) && (order[0] == 3));
+  CHECK(req[1].status == 0);
+  CHECK(temp == -42);
+  CHECK(req[1].reg == ISM330DHCX_OUT_TEMP_L);
+
+  TEST_END();
+}
@@ -0,0 +1,111 @@
+/*
+ * Batch pool: capacity and empty accounting, then batches circulating
+ * between a drain thread (batch_get) and a consumer thread (batch_put)
+ * without being lost or handed out twice.
+ */
+#include <pthread.h>
+#include <sched.h>
+
+#include "test.h"
+
+#define BATCHES                                 8U
+#define ROUNDS                                  500000U
+
+static ism330dhcx_batch_t batch[ISM330DHCX_BATCH_POOL_LEN + 2U];
+static ism330dhcx_batch_pool_t pool;   /* consumer -> drain */
+static ism330dhcx_batch_pool_t ready;  /* drain -> consumer */
+static volatile uint8_t owned[BATCHES];
+static volatile uint32_t twice;
+
+/* drain side: get empty batches, hand them over full */
+static void *drain(void *arg)
+{
+  ism330dhcx_batch_t *b;
+  uint32_t n = 0;
+  uint32_t i;
+
+  (void)arg;
+
+  while (n < ROUNDS)
+  {
+    b = ism330dhcx_batch_get(&pool);
+
+    if (b == NULL)
+    {
+      (void)sched_yield();
+      continue;
+    }
+
+    i = (uint32_t)(b - batch);
+
+    if (owned[i] != 0U)
+    {
+      twice++;
+    }
+
+    owned[i] = 1;
+    b->len = ISM330DHCX_BATCH_LEN;
+    b->x[0] = (int16_t)n;
+    ism330dhcx_batch_put(&ready, b);
+    n++;
+  }
+
+  return NULL;
+}
+
+int main(void)
+{
+  ism330dhcx_batch_t *b;
+  pthread_t t;
+  uint32_t n = 0;
+  uint32_t order = 0;
+
+  /* capacity, empty pool, batches beyond capacity */
+  ism330dhcx_batch_pool_init(&pool, batch, ISM330DHCX_BATCH_POOL_LEN + 2U);
+
+  for (n = 0; n < ISM330DHCX_BATCH_POOL_LEN; n++)
+  {
+    b = ism330dhcx_batch_get(&pool);
+    CHECK(b == &batch[n]);
+    CHECK((b != NULL) && (b->len == 0U));
+  }
+
+  CHECK(ism330dhcx_batch_get(&pool) == NULL);
+  CHECK(pool.empty == 1U);
+  ism330dhcx_batch_put(&pool, &batch[3]);
+  CHECK(ism330dhcx_batch_get(&pool) == &batch[3]);
+
+  /* two threads, full batches come back in order */
+  ism330dhcx_batch_pool_init(&pool, batch, BATCHES);
+  ism330dhcx_batch_pool_init(&ready, batch, 0);
+  CHECK(pthread_create(&t, NULL, drain, NULL) == 0);
+
+  for (n = 0; n < ROUNDS; n++)
+  {
+    while ((b = ism330dhcx_batch_get(&ready)) == NULL)
+    {
+      (void)sched_yield();
+    }
+
+    if (b->x[0] != (int16_t)n)
+    {
+      order++;
+    }
+
+    if (owned[b - batch] != 1U)
+    {
+      twice++;
+    }
+
+    owned[b - batch] = 0;
+    ism330dhcx_batch_put(&pool, b);
+  }
+
+  (void)pthread_join(t, NULL);
+  CHECK(twice == 0U);
+  CHECK(order == 0U);
+  CHECK((pool.head - pool.tail) == BATCHES);
+  CHECK(ready.head == ready.tail);
+
+  TEST_END();
+}
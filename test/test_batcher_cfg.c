@@ -0,0 +1,113 @@
+/*
+ * Batcher stream tracking: the settings carried by the CFG_CHANGE words
+ * of the stream split the batches and are applied to them; overruns are
+ * counted from the latched flag too.
+ */
+#include "test.h"
+
+#define BURST                                   32U
+
+typedef struct
+{
+  ism330dhcx_batch_pool_t *pool;
+  uint32_t xl_2g;
+  uint32_t xl_8g;
+  uint32_t mixed;
+  ism330dhcx_fifo_cfg_t last;
+} sink_t;
+
+static void on_batch(void *arg, ism330dhcx_batch_t *batch)
+{
+  sink_t *s = (sink_t *)arg;
+
+  if (batch->ch == ISM330DHCX_BATCH_XL)
+  {
+    if ((batch->cfg.xl_fs == ISM330DHCX_2g) &&
+        (batch->cfg.xl_odr == ISM330DHCX_XL_ODR_104Hz))
+    {
+      s->xl_2g += batch->len;
+    }
+
+    else if ((batch->cfg.xl_fs == ISM330DHCX_8g) &&
+             (batch->cfg.xl_odr == ISM330DHCX_XL_ODR_208Hz) &&
+             (batch->cfg.xl_bdr == ISM330DHCX_XL_BATCHED_AT_208Hz))
+    {
+      s->xl_8g += batch->len;
+    }
+
+    else
+    {
+      s->mixed += batch->len;
+    }
+
+    s->last = batch->cfg;
+  }
+
+  ism330dhcx_batch_put(s->pool, batch);
+}
+
+int main(void)
+{
+  static uint8_t buff[BURST * ISM330DHCX_FIFO_WORD_LEN];
+  static ism330dhcx_batch_t batch[4];
+  ism330dhcx_batch_pool_t pool;
+  ism330dhcx_fifo_decoder_t dec;
+  ism330dhcx_fifo_state_t state;
+  ism330dhcx_batcher_t bt;
+  ism330dhcx_fifo_cfg_t cfg;
+  ism330dhcx_emu_t emu;
+  stmdev_ctx_t ctx;
+  sink_t sink = { NULL, 0, 0, 0, { ISM330DHCX_XL_ODR_OFF } };
+  uint8_t t;
+
+  test_emu_ctx(&ctx, &emu);
+  ism330dhcx_batch_pool_init(&pool, batch, 4);
+  sink.pool = &pool;
+  ism330dhcx_batcher_init(&bt, &pool, NULL, on_batch, &sink);
+  ism330dhcx_fifo_decoder_init(&dec, &bt);
+
+  for (t = 1; t <= (uint8_t)ISM330DHCX_CFG_CHANGE_TAG; t++)
+  {
+    ism330dhcx_fifo_decoder_handler_set(&dec, (ism330dhcx_fifo_tag_t)t,
+                                        ism330dhcx_batcher_word);
+  }
+
+  CHECK(ism330dhcx_xl_full_scale_set(&ctx, ISM330DHCX_2g) == 0);
+  CHECK(ism330dhcx_fifo_xl_batch_set(&ctx, ISM330DHCX_XL_BATCHED_AT_104Hz) == 0);
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_STREAM_MODE) == 0);
+  CHECK(ism330dhcx_xl_data_rate_set(&ctx, ISM330DHCX_XL_ODR_104Hz) == 0);
+  CHECK(ism330dhcx_fifo_cfg_get(&ctx, &cfg) == 0);
+  ism330dhcx_batcher_cfg_set(&bt, &cfg);
+
+  /* 20 samples, reconfiguration, 40 samples */
+  ism330dhcx_emu_run(&emu, 20U * 9615U);
+  CHECK(ism330dhcx_fifo_virtual_sens_odr_chg_set(&ctx, PROPERTY_ENABLE) == 0);
+  CHECK(ism330dhcx_xl_full_scale_set(&ctx, ISM330DHCX_8g) == 0);
+  CHECK(ism330dhcx_xl_data_rate_set(&ctx, ISM330DHCX_XL_ODR_208Hz) == 0);
+  CHECK(ism330dhcx_fifo_xl_batch_set(&ctx, ISM330DHCX_XL_BATCHED_AT_208Hz) == 0);
+  ism330dhcx_emu_run(&emu, 40U * 4808U);
+
+  CHECK(ism330dhcx_fifo_drain(&ctx, &dec, &bt, buff, BURST, &state) == 0);
+  ism330dhcx_batcher_flush(&bt);
+
+  /* one CFG_CHANGE word per register write */
+  CHECK(bt.cfg_changes == 3U);
+  CHECK(sink.xl_2g == 20U);
+  CHECK(sink.xl_8g == 40U);
+  CHECK(sink.mixed == 0U);
+  CHECK(ism330dhcx_fifo_cfg_get(&ctx, &cfg) == 0);
+  CHECK((bt.cfg.xl_odr == cfg.xl_odr) && (bt.cfg.xl_fs == cfg.xl_fs) &&
+        (bt.cfg.xl_bdr == cfg.xl_bdr) && (bt.cfg.gy_odr == cfg.gy_odr) &&
+        (bt.cfg.gy_fs == cfg.gy_fs) && (bt.cfg.gy_bdr == cfg.gy_bdr));
+  CHECK(sink.last.xl_fs == ISM330DHCX_8g);
+
+  /* FIFO_OVR_IA cleared by a FIFO read before the drain */
+  CHECK(bt.overruns == 0U);
+  ism330dhcx_emu_run(&emu, 5000000U);
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, 1) == 0);
+  CHECK(ism330dhcx_fifo_drain(&ctx, &dec, &bt, buff, BURST, &state) == 0);
+  CHECK((state.ovr == 0U) && (state.ovr_latched == 1U));
+  CHECK(bt.overruns == 1U);
+
+  TEST_END();
+}
@@ -0,0 +1,177 @@
+/*
+ * Calibration: six-position estimate of a known sensitivity /
+ * misalignment matrix and bias, degenerate positions, calib_apply
+ * against m * (v - b) by hand, bias estimate, and the bias moved into
+ * the user offset registers (weight, clamp, USR_OFF_ON_OUT, residual).
+ */
+#include <math.h>
+#include <string.h>
+
+#include "test.h"
+
+static ism330dhcx_emu_t emu;
+static stmdev_ctx_t ctx;
+
+static int near(float_t a, float_t b, float_t tol)
+{
+  return fabsf(a - b) <= tol;
+}
+
+/* six static positions seen through sensitivity s [LSB/LSB] and bias b */
+static void positions(const float_t s[3][3], const float_t b[3],
+                      float_t avg[6][3])
+{
+  uint8_t p;
+  uint8_t i;
+  float_t g;
+
+  for (p = 0; p < 6U; p++)
+  {
+    g = ((p % 2U) == 0U) ? 1000.0f : -1000.0f;
+
+    for (i = 0; i < 3U; i++)
+    {
+      avg[p][i] = (s[i][p / 2U] * g) + b[i];
+    }
+  }
+}
+
+static uint8_t reg(uint8_t addr)
+{
+  return emu.reg[ISM330DHCX_USER_BANK][addr];
+}
+
+static int offset_write(float_t bx, float_t by, float_t bz,
+                        ism330dhcx_calib_t *calib)
+{
+  ism330dhcx_calib_init(calib);
+  calib->b[0] = bx;
+  calib->b[1] = by;
+  calib->b[2] = bz;
+
+  return (int)ism330dhcx_calib_xl_offset_write(&ctx, calib);
+}
+
+int main(void)
+{
+  static const float_t s[3][3] =
+  {
+    { 1.02f, 0.01f, -0.02f },
+    { 0.015f, 0.97f, 0.005f },
+    { -0.01f, 0.03f, 1.05f },
+  };
+  static const float_t bias[3] = { 25.0f, -40.0f, 12.5f };
+  ism330dhcx_calib_t calib;
+  ism330dhcx_calib_t keep;
+  float_t avg[6][3];
+  /* const view: C99 does not convert float_t (*)[3] implicitly */
+  const float_t (*six)[3] = (const float_t (*)[3])avg;
+  float_t x[2] = { 100.0f, -1000.0f };
+  float_t y[2] = { 200.0f, 0.0f };
+  float_t z[2] = { -300.0f, 1000.0f };
+  float_t sum;
+  uint8_t i;
+  uint8_t j;
+  uint8_t k;
+
+  /* six positions: m is the inverse of s, b the bias */
+  positions(s, bias, avg);
+  CHECK(ism330dhcx_calib_six_pos_estimate(six, &calib) == 0);
+
+  for (i = 0; i < 3U; i++)
+  {
+    CHECK(near(calib.b[i], bias[i], 1.0e-3f));
+
+    for (j = 0; j < 3U; j++)
+    {
+      sum = 0.0f;
+
+      for (k = 0; k < 3U; k++)
+      {
+        sum += calib.m[i][k] * s[k][j];
+      }
+
+      CHECK(near(sum, (i == j) ? 1.0f : 0.0f, 1.0e-5f));
+    }
+  }
+
+  /* degenerate: an axis that never sees gravity, calib untouched */
+  for (i = 0; i < 3U; i++)
+  {
+    avg[ISM330DHCX_CALIB_POS_ZP][i] = bias[i];
+    avg[ISM330DHCX_CALIB_POS_ZN][i] = bias[i];
+  }
+
+  keep = calib;
+  CHECK(ism330dhcx_calib_six_pos_estimate(six, &calib) == -1);
+  CHECK(memcmp(&keep, &calib, sizeof(calib)) == 0);
+
+  /* m * (v - b) by hand */
+  ism330dhcx_calib_init(&calib);
+  calib.m[0][0] = 2.0f;
+  calib.m[0][1] = 0.5f;
+  calib.m[1][1] = -1.0f;
+  calib.m[1][2] = 0.25f;
+  calib.m[2][0] = 0.1f;
+  calib.m[2][2] = 3.0f;
+  calib.b[0] = 10.0f;
+  calib.b[1] = -20.0f;
+  calib.b[2] = 4.0f;
+  ism330dhcx_calib_apply(&calib, x, y, z, 2);
+  /* v - b = (90, 220, -304) and (-1010, 20, 996) */
+  CHECK(near(x[0], 290.0f, 1.0e-3f));
+  CHECK(near(y[0], -296.0f, 1.0e-3f));
+  CHECK(near(z[0], -903.0f, 1.0e-3f));
+  CHECK(near(x[1], -2010.0f, 1.0e-3f));
+  CHECK(near(y[1], 229.0f, 1.0e-3f));
+  CHECK(near(z[1], 2887.0f, 1.0e-3f));
+
+  /* bias at rest: mean only, m kept; an empty capture is refused */
+  keep = calib;
+  CHECK(ism330dhcx_calib_bias_estimate(x, y, z, 0, &calib) == -1);
+  CHECK(memcmp(&keep, &calib, sizeof(calib)) == 0);
+  x[0] = 1.0f;
+  x[1] = 3.0f;
+  y[0] = -2.0f;
+  y[1] = -4.0f;
+  z[0] = 0.5f;
+  z[1] = 0.5f;
+  CHECK(ism330dhcx_calib_bias_estimate(x, y, z, 2, &calib) == 0);
+  CHECK(near(calib.b[0], 2.0f, 1.0e-6f) && near(calib.b[1], -3.0f, 1.0e-6f) &&
+        near(calib.b[2], 0.5f, 1.0e-6f));
+  CHECK(memcmp(keep.m, calib.m, sizeof(calib.m)) == 0);
+
+  /* small bias: 2^-10 g weight, rounded to nearest, residual kept */
+  test_emu_ctx(&ctx, &emu);
+  CHECK(offset_write(100.0f, -50.0f, 3.0f, &calib) == 0);
+  CHECK((reg(ISM330DHCX_CTRL6_C) & 0x08U) == 0U);
+  CHECK((reg(ISM330DHCX_CTRL7_G) & 0x02U) != 0U);
+  CHECK(reg(ISM330DHCX_X_OFS_USR) == 102U);
+  CHECK(reg(ISM330DHCX_Y_OFS_USR) == (uint8_t)(int8_t)-51);
+  CHECK(reg(ISM330DHCX_Z_OFS_USR) == 3U);
+  CHECK(near(calib.b[0], 100.0f - (102.0f * 1000.0f / 1024.0f), 1.0e-4f));
+  CHECK(near(calib.b[1], -50.0f + (51.0f * 1000.0f / 1024.0f), 1.0e-4f));
+  CHECK(near(calib.b[2], 3.0f - (3.0f * 1000.0f / 1024.0f), 1.0e-4f));
+
+  /* the switch at 127.5 LSB of 2^-10 g (124.51 mg) */
+  CHECK(offset_write(0.0f, 124.5f, 0.0f, &calib) == 0);
+  CHECK((reg(ISM330DHCX_CTRL6_C) & 0x08U) == 0U);
+  CHECK(reg(ISM330DHCX_Y_OFS_USR) == 127U);
+  CHECK(offset_write(0.0f, -124.6f, 0.0f, &calib) == 0);
+  CHECK((reg(ISM330DHCX_CTRL6_C) & 0x08U) != 0U);
+  CHECK(reg(ISM330DHCX_Y_OFS_USR) == (uint8_t)(int8_t)-8);
+  CHECK(near(calib.b[1], -124.6f + 125.0f, 1.0e-4f));
+
+  /* beyond 127 LSB of 2^-6 g: clamped, the rest left to software */
+  CHECK(offset_write(-3000.0f, 2500.0f, 1000.0f, &calib) == 0);
+  CHECK((reg(ISM330DHCX_CTRL6_C) & 0x08U) != 0U);
+  CHECK((reg(ISM330DHCX_CTRL7_G) & 0x02U) != 0U);
+  CHECK(reg(ISM330DHCX_X_OFS_USR) == (uint8_t)(int8_t)-127);
+  CHECK(reg(ISM330DHCX_Y_OFS_USR) == 127U);
+  CHECK(reg(ISM330DHCX_Z_OFS_USR) == 64U);
+  CHECK(near(calib.b[0], -3000.0f + (127.0f * 15.625f), 1.0e-3f));
+  CHECK(near(calib.b[1], 2500.0f - (127.0f * 15.625f), 1.0e-3f));
+  CHECK(near(calib.b[2], 0.0f, 1.0e-3f));
+
+  TEST_END();
+}
@@ -0,0 +1,282 @@
+/*
+ * Capture round trip: emulator FIFO words recorded through a small
+ * chunk buffer (records packed in chunks, records larger than a chunk
+ * written on their own), closed with the INDEX and END records, then
+ * replayed from the start and from every index offset. Truncated and
+ * malformed captures are rejected.
+ */
+#include <string.h>
+
+#include "test.h"
+
+#define CHUNK                                   64U
+#define INDEX_MAX                               256U
+#define FILE_MAX                                65536U
+#define WORDS_MAX                               4096U
+
+typedef struct
+{
+  uint8_t buf[FILE_MAX];
+  uint32_t len;
+  uint32_t calls;
+  int fail;
+} file_t;
+
+typedef struct
+{
+  uint8_t word[WORDS_MAX][ISM330DHCX_FIFO_WORD_LEN];
+  uint32_t n;
+} words_t;
+
+static ism330dhcx_emu_t emu;
+static stmdev_ctx_t ctx;
+static file_t file;
+static words_t truth;
+static words_t got;
+static uint8_t copy[FILE_MAX];
+static uint8_t cfg_seen[ISM330DHCX_CAP_CFG_LEN];
+static int cfg_calls;
+
+static int32_t sink(void *handle, const uint8_t *data, uint32_t len)
+{
+  file_t *f = (file_t *)handle;
+
+  f->calls++;
+
+  if ((f->fail != 0) || ((f->len + len) > FILE_MAX))
+  {
+    return -1;
+  }
+
+  memcpy(&f->buf[f->len], data, len);
+  f->len += len;
+
+  return 0;
+}
+
+/* ramps, so that every word differs from its neighbours */
+static void source(void *arg, ism330dhcx_fifo_tag_t tag, uint64_t ns,
+                   int16_t *val)
+{
+  uint32_t t = (uint32_t)(ns / 1000U);
+
+  (void)arg;
+  val[0] = (int16_t)(t & 0x7FFFU);
+
+  if (tag != ISM330DHCX_TEMPERATURE_TAG)
+  {
+    val[1] = (int16_t)((uint16_t)tag * 1000U);
+    val[2] = (int16_t)((t * 7U) & 0x7FFFU);
+  }
+}
+
+static void on_word(void *arg, const ism330dhcx_fifo_word_t *w)
+{
+  words_t *out = (words_t *)arg;
+
+  if (out->n < WORDS_MAX)
+  {
+    out->word[out->n][0] = (uint8_t)w->tag;
+    memcpy(&out->word[out->n][1], w->data, ISM330DHCX_FIFO_WORD_LEN - 1U);
+    out->n++;
+  }
+}
+
+static void on_cfg(void *arg, uint8_t dev, const uint8_t *cfg)
+{
+  (void)arg;
+  (void)dev;
+  memcpy(cfg_seen, cfg, ISM330DHCX_CAP_CFG_LEN);
+  cfg_calls++;
+}
+
+static int32_t replay(const uint8_t *buff, uint32_t len, uint8_t dev)
+{
+  ism330dhcx_fifo_decoder_t dec;
+  uint32_t tag;
+
+  ism330dhcx_fifo_decoder_init(&dec, &got);
+
+  for (tag = 0; tag < 32U; tag++)
+  {
+    ism330dhcx_fifo_decoder_handler_set(&dec, (ism330dhcx_fifo_tag_t)tag,
+                                        on_word);
+  }
+
+  got.n = 0;
+  cfg_calls = 0;
+
+  return ism330dhcx_cap_replay(buff, len, dev, &dec, on_cfg, NULL);
+}
+
+/* got[] is the tail of truth[] (tag and data, the tag counter aside) */
+static int got_is_tail(void)
+{
+  uint32_t from = truth.n - got.n;
+  uint32_t i;
+
+  for (i = 0; i < got.n; i++)
+  {
+    if (((truth.word[from + i][0] >> 3) != got.word[i][0]) ||
+        (memcmp(&truth.word[from + i][1], &got.word[i][1],
+                ISM330DHCX_FIFO_WORD_LEN - 1U) != 0))
+    {
+      return 0;
+    }
+  }
+
+  return got.n <= truth.n;
+}
+
+static uint32_t rd32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+/* offset is the start of a record when walking from the beginning */
+static int is_record(uint32_t offset)
+{
+  uint32_t pos = 0;
+
+  while (pos < offset)
+  {
+    pos += ISM330DHCX_CAP_REC_LEN + (uint32_t)file.buf[pos + 2U] +
+           ((uint32_t)file.buf[pos + 3U] << 8);
+  }
+
+  return pos == offset;
+}
+
+int main(void)
+{
+  static const uint16_t split[6] = { 1, 3, 8, 9, 20, 2 };
+  uint8_t chunk[CHUNK];
+  uint32_t index[INDEX_MAX];
+  uint8_t raw[64 * ISM330DHCX_FIFO_WORD_LEN];
+  ism330dhcx_cap_t cap;
+  uint32_t big = 0;
+  uint32_t at;
+  uint32_t prev;
+  uint32_t end;
+  uint32_t i;
+  uint16_t level;
+  uint16_t n;
+  uint16_t k = 0;
+
+  test_emu_ctx(&ctx, &emu);
+  emu.sample = source;
+  CHECK(ism330dhcx_fifo_xl_batch_set(&ctx, ISM330DHCX_XL_BATCHED_AT_833Hz)
+        == 0);
+  CHECK(ism330dhcx_fifo_gy_batch_set(&ctx, ISM330DHCX_GY_BATCHED_AT_833Hz)
+        == 0);
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_STREAM_MODE) == 0);
+  CHECK(ism330dhcx_xl_data_rate_set(&ctx, ISM330DHCX_XL_ODR_833Hz) == 0);
+  CHECK(ism330dhcx_gy_data_rate_set(&ctx, ISM330DHCX_GY_ODR_833Hz) == 0);
+
+  CHECK(ism330dhcx_cap_init(&cap, sink, &file, chunk, 11, index,
+                            INDEX_MAX) == -1);
+  CHECK(ism330dhcx_cap_init(&cap, sink, &file, chunk, CHUNK, index,
+                            INDEX_MAX) == 0);
+  CHECK(ism330dhcx_cap_config(&ctx, &cap, 0) == 0);
+
+  /* drain every 10 ms, recording in pieces of 1 to 20 words */
+  for (i = 0; i < 40U; i++)
+  {
+    ism330dhcx_emu_run(&emu, 10000U);
+    CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+
+    while (level > 0U)
+    {
+      n = (split[k % 6U] < level) ? split[k % 6U] : level;
+      k++;
+      CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, raw, n) == 0);
+      CHECK(truth.n + n <= WORDS_MAX);
+      memcpy(truth.word[truth.n], raw, (uint32_t)n * ISM330DHCX_FIFO_WORD_LEN);
+      truth.n += n;
+      CHECK(ism330dhcx_cap_words(&cap, 0, raw, n) == 0);
+      big += ((ISM330DHCX_CAP_REC_LEN + (n * ISM330DHCX_FIFO_WORD_LEN)) >
+              CHUNK) ? 1U : 0U;
+
+      /* another device on the same capture */
+      if ((k % 5U) == 0U)
+      {
+        CHECK(ism330dhcx_cap_words(&cap, 1, raw, 1) == 0);
+      }
+
+      level -= n;
+    }
+  }
+
+  CHECK(truth.n > 500U);
+  CHECK(big > 0U);
+  CHECK(ism330dhcx_cap_close(&cap) == 0);
+  CHECK(cap.errors == 0U);
+  CHECK(file.len == cap.offset);
+  CHECK(cap.index_len > big);
+
+  /* END points to INDEX, which lists the chunk offsets */
+  end = file.len - (ISM330DHCX_CAP_REC_LEN + 4U);
+  CHECK((file.buf[end] == ISM330DHCX_CAP_END) && (file.buf[end + 2U] == 4U));
+  at = rd32(&file.buf[end + ISM330DHCX_CAP_REC_LEN]);
+  CHECK(file.buf[at] == ISM330DHCX_CAP_INDEX);
+  CHECK((file.buf[at + 2U] + (file.buf[at + 3U] * 256U)) ==
+        cap.index_len * 4U);
+  CHECK(at + ISM330DHCX_CAP_REC_LEN + (cap.index_len * 4U) == end);
+  CHECK(index[0] == 0U);
+
+  for (i = 0; i < cap.index_len; i++)
+  {
+    CHECK(rd32(&file.buf[at + ISM330DHCX_CAP_REC_LEN + (i * 4U)]) ==
+          index[i]);
+    CHECK((i == 0U) || (index[i] > index[i - 1U]));
+    CHECK(is_record(index[i]));
+  }
+
+  /* from the start: every word, and the configuration */
+  CHECK(replay(file.buf, file.len, 0) == 0);
+  CHECK(got.n == truth.n);
+  CHECK(got_is_tail());
+  CHECK(cfg_calls == 1);
+  CHECK(cfg_seen[ISM330DHCX_CTRL1_XL - ISM330DHCX_FUNC_CFG_ACCESS] ==
+        emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL]);
+  CHECK(cfg_seen[ISM330DHCX_FIFO_CTRL4 - ISM330DHCX_FUNC_CFG_ACCESS] ==
+        emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FIFO_CTRL4]);
+  CHECK(replay(file.buf, file.len, 1) == 0);
+  CHECK(got.n == (uint32_t)(k / 5U));
+
+  /* from every index offset: a shorter and shorter tail */
+  prev = truth.n + 1U;
+
+  for (i = 0; i < cap.index_len; i++)
+  {
+    CHECK(replay(&file.buf[index[i]], file.len - index[i], 0) == 0);
+    CHECK(got_is_tail());
+    CHECK(got.n <= prev);
+    /* HEADER + CONFIG overflow the first chunk: CONFIG opens the second */
+    CHECK(cfg_calls ==
+          ((index[i] <= (ISM330DHCX_CAP_REC_LEN + 5U)) ? 1 : 0));
+    prev = got.n;
+  }
+
+  /* truncated: inside a record, inside the END record, before a header */
+  CHECK(replay(file.buf, index[cap.index_len / 2U] + 5U, 0) == -1);
+  CHECK(replay(file.buf, file.len - 1U, 0) == -1);
+  CHECK(replay(file.buf, 3, 0) == -1);
+
+  /* malformed: a record length running past the end of the capture */
+  memcpy(copy, file.buf, file.len);
+  copy[index[1] + 2U] = 0xFF;
+  copy[index[1] + 3U] = 0xFF;
+  CHECK(replay(copy, file.len, 0) == -1);
+
+  /* sink failures are reported and counted */
+  file.len = 0;
+  file.fail = 1;
+  CHECK(ism330dhcx_cap_init(&cap, sink, &file, chunk, CHUNK, NULL, 0) == 0);
+  CHECK(ism330dhcx_cap_words(&cap, 0, raw, 20) != 0);
+  CHECK(cap.errors > 0U);
+  CHECK(ism330dhcx_cap_close(&cap) != 0);
+
+  TEST_END();
+}
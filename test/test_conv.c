@@ -0,0 +1,166 @@
+/*
+ * Unit conversions: the array conversions match the per-sample
+ * functions bit for bit over the whole raw range of every full scale,
+ * and the fixed-point conversions match a double reference rounded half
+ * away from zero, bit for bit as well.
+ */
+#include <math.h>
+
+#include "test.h"
+
+#define RAW                                     65536U
+
+typedef float_t (*conv_ptr)(int16_t);
+
+static int16_t lsb[RAW];
+static float_t val[RAW];
+static int32_t fix[RAW];
+
+static uint32_t diff(conv_ptr fn)
+{
+  uint32_t n = 0;
+  uint32_t i;
+
+  for (i = 0; i < RAW; i++)
+  {
+    if (val[i] != fn(lsb[i]))
+    {
+      n++;
+    }
+  }
+
+  return n;
+}
+
+/* raw values whose fix[] differs from round(lsb * sens * 2^16 / 10^6) */
+static uint32_t q16_diff(uint32_t sens)
+{
+  uint32_t n = 0;
+  uint32_t i;
+
+  for (i = 0; i < RAW; i++)
+  {
+    if ((double)fix[i] !=
+        round(((double)lsb[i] * (double)sens * 65536.0) / 1e6))
+    {
+      n++;
+    }
+  }
+
+  return n;
+}
+
+int main(void)
+{
+  static const ism330dhcx_fs_xl_t xl_fs[4] =
+  {
+    ISM330DHCX_2g, ISM330DHCX_4g, ISM330DHCX_8g, ISM330DHCX_16g,
+  };
+  static const conv_ptr xl_fn[4] =
+  {
+    ism330dhcx_from_fs2g_to_mg, ism330dhcx_from_fs4g_to_mg,
+    ism330dhcx_from_fs8g_to_mg, ism330dhcx_from_fs16g_to_mg,
+  };
+  static const ism330dhcx_fs_g_t gy_fs[6] =
+  {
+    ISM330DHCX_125dps, ISM330DHCX_250dps, ISM330DHCX_500dps,
+    ISM330DHCX_1000dps, ISM330DHCX_2000dps, ISM330DHCX_4000dps,
+  };
+  static const conv_ptr gy_fn[6] =
+  {
+    ism330dhcx_from_fs125dps_to_mdps, ism330dhcx_from_fs250dps_to_mdps,
+    ism330dhcx_from_fs500dps_to_mdps, ism330dhcx_from_fs1000dps_to_mdps,
+    ism330dhcx_from_fs2000dps_to_mdps, ism330dhcx_from_fs4000dps_to_mdps,
+  };
+  static ism330dhcx_batch_t batch;
+  static float_t x[ISM330DHCX_BATCH_LEN];
+  static float_t y[ISM330DHCX_BATCH_LEN];
+  static float_t z[ISM330DHCX_BATCH_LEN];
+  uint32_t i;
+
+  for (i = 0; i < RAW; i++)
+  {
+    lsb[i] = (int16_t)(i - 32768U);
+  }
+
+  for (i = 0; i < 4U; i++)
+  {
+    ism330dhcx_from_fs_xl_to_mg_array(xl_fs[i], lsb, val, RAW);
+    CHECK(diff(xl_fn[i]) == 0U);
+  }
+
+  for (i = 0; i < 6U; i++)
+  {
+    ism330dhcx_from_fs_g_to_mdps_array(gy_fs[i], lsb, val, RAW);
+    CHECK(diff(gy_fn[i]) == 0U);
+  }
+
+  ism330dhcx_from_lsb_to_celsius_array(lsb, val, RAW);
+  CHECK(diff(ism330dhcx_from_lsb_to_celsius) == 0U);
+
+  /* fixed point against the double reference, array against single value */
+  for (i = 0; i < 4U; i++)
+  {
+    ism330dhcx_from_fs_xl_to_g_q16_array(xl_fs[i], lsb, fix, RAW);
+    CHECK(q16_diff(ISM330DHCX_XL_SENS_UG(xl_fs[i])) == 0U);
+    CHECK(fix[0] == ism330dhcx_from_fs_xl_to_g_q16(xl_fs[i], -32768));
+    CHECK(fix[RAW - 1U] == ism330dhcx_from_fs_xl_to_g_q16(xl_fs[i], 32767));
+    CHECK(fix[RAW - 1U] == -fix[1]);
+  }
+
+  for (i = 0; i < 6U; i++)
+  {
+    ism330dhcx_from_fs_g_to_dps_q16_array(gy_fs[i], lsb, fix, RAW);
+    CHECK(q16_diff(ISM330DHCX_GY_SENS_UDPS(gy_fs[i])) == 0U);
+    CHECK(fix[RAW - 1U] == ism330dhcx_from_fs_g_to_dps_q16(gy_fs[i], 32767));
+    CHECK(fix[RAW - 1U] == -fix[1]);
+  }
+
+  /* 2 g: 61 ug/LSB, 1000 LSB = 0.061 g = 3997.696 in Q16.16 */
+  CHECK(ism330dhcx_from_fs_xl_to_g_q16(ISM330DHCX_2g, 1000) == 3998);
+  CHECK(ism330dhcx_from_fs_xl_to_g_q16(ISM330DHCX_2g, -1000) == -3998);
+  /* 4000 dps: 140 mdps/LSB, 32767 LSB = 4587.38 dps = 300638535.68 */
+  CHECK(ism330dhcx_from_fs_g_to_dps_q16(ISM330DHCX_4000dps, 32767) ==
+        300638536);
+  /* 2 g: -32335 LSB = -129265.50016; 125 dps: -32759 LSB = -9392660.48 */
+  CHECK(ism330dhcx_from_fs_xl_to_g_q16(ISM330DHCX_2g, -32335) == -129266);
+  CHECK(ism330dhcx_from_fs_g_to_dps_q16(ISM330DHCX_125dps, -32759) ==
+        -9392660);
+
+  ism330dhcx_from_lsb_to_cdegc_array(lsb, fix, RAW);
+
+  for (i = 0; i < RAW; i++)
+  {
+    if ((double)fix[i] != (round(((double)lsb[i] * 100.0) / 256.0) + 2500.0))
+    {
+      break;
+    }
+  }
+
+  CHECK(i == RAW);
+  CHECK(ism330dhcx_from_lsb_to_cdegc(128) == 2550);
+  CHECK(ism330dhcx_from_lsb_to_cdegc(-128) == 2450);
+
+  /* a batch converted with the full scale stamped on it */
+  batch.ch = ISM330DHCX_BATCH_GY;
+  batch.cfg.gy_fs = ISM330DHCX_2000dps;
+  batch.len = ISM330DHCX_BATCH_LEN;
+
+  for (i = 0; i < ISM330DHCX_BATCH_LEN; i++)
+  {
+    batch.x[i] = (int16_t)(i * 511U);
+    batch.y[i] = (int16_t)-(int16_t)i;
+    batch.z[i] = (int16_t)(32767U - i);
+  }
+
+  ism330dhcx_batch_to_unit(&batch, x, y, z);
+
+  for (i = 0; i < ISM330DHCX_BATCH_LEN; i++)
+  {
+    CHECK(x[i] == ism330dhcx_from_fs2000dps_to_mdps(batch.x[i]));
+    CHECK(y[i] == ism330dhcx_from_fs2000dps_to_mdps(batch.y[i]));
+    CHECK(z[i] == ism330dhcx_from_fs2000dps_to_mdps(batch.z[i]));
+  }
+
+  TEST_END();
+}
@@ -0,0 +1,87 @@
+/*
+ * C++ conversions: compile-time sensitivities, and the specialized and
+ * dispatched converters against the C per-sample functions.
+ */
+#include "test.h"
+
+static_assert(ism330dhcx::xl<ISM330DHCX_4g>::sens == 0.122f, "4 g");
+static_assert(ism330dhcx::gy<ISM330DHCX_125dps>::sens == 4.375f, "125 dps");
+static_assert(ism330dhcx::xl<ISM330DHCX_16g>::to_mg(-2) == -0.976f, "16 g");
+
+typedef float_t (*c_conv_ptr)(int16_t);
+
+static int16_t lsb[65536];
+static float_t val[65536];
+
+static uint32_t diff(const ism330dhcx::converter &conv, int gyro,
+                     c_conv_ptr fn)
+{
+  uint32_t n = 0;
+
+  for (uint32_t i = 0; i < 65536U; i++)
+  {
+    float_t one = (gyro != 0) ? conv.gy_mdps(lsb[i]) : conv.xl_mg(lsb[i]);
+
+    if ((one != fn(lsb[i])) || (val[i] != one))
+    {
+      n++;
+    }
+  }
+
+  return n;
+}
+
+int main(void)
+{
+  static const ism330dhcx_fs_xl_t xl_fs[4] =
+  {
+    ISM330DHCX_2g, ISM330DHCX_4g, ISM330DHCX_8g, ISM330DHCX_16g,
+  };
+  static const c_conv_ptr xl_fn[4] =
+  {
+    ism330dhcx_from_fs2g_to_mg, ism330dhcx_from_fs4g_to_mg,
+    ism330dhcx_from_fs8g_to_mg, ism330dhcx_from_fs16g_to_mg,
+  };
+  static const ism330dhcx_fs_g_t gy_fs[6] =
+  {
+    ISM330DHCX_125dps, ISM330DHCX_250dps, ISM330DHCX_500dps,
+    ISM330DHCX_1000dps, ISM330DHCX_2000dps, ISM330DHCX_4000dps,
+  };
+  static const c_conv_ptr gy_fn[6] =
+  {
+    ism330dhcx_from_fs125dps_to_mdps, ism330dhcx_from_fs250dps_to_mdps,
+    ism330dhcx_from_fs500dps_to_mdps, ism330dhcx_from_fs1000dps_to_mdps,
+    ism330dhcx_from_fs2000dps_to_mdps, ism330dhcx_from_fs4000dps_to_mdps,
+  };
+  ism330dhcx::converter conv;
+
+  for (uint32_t i = 0; i < 65536U; i++)
+  {
+    lsb[i] = (int16_t)(i - 32768U);
+  }
+
+  /* specialized converters */
+  ism330dhcx::xl<ISM330DHCX_8g>::to_mg_array(lsb, val, 65536U);
+  CHECK(val[0] == ism330dhcx_from_fs8g_to_mg(-32768));
+  CHECK(ism330dhcx::gy<ISM330DHCX_4000dps>::to_mdps(32767) ==
+        ism330dhcx_from_fs4000dps_to_mdps(32767));
+
+  /* dispatch table, every pair of full scales */
+  for (uint32_t x = 0; x < 4U; x++)
+  {
+    for (uint32_t g = 0; g < 6U; g++)
+    {
+      conv.set(xl_fs[x], gy_fs[g]);
+      conv.xl_mg(lsb, val, 65536U);
+      CHECK(diff(conv, 0, xl_fn[x]) == 0U);
+      conv.gy_mdps(lsb, val, 65536U);
+      CHECK(diff(conv, 1, gy_fn[g]) == 0U);
+    }
+  }
+
+  /* reserved gyroscope code */
+  conv.set(ISM330DHCX_2g, (ism330dhcx_fs_g_t)3);
+  CHECK(conv.gy_mdps(1000) == 0.0f);
+
+  TEST_END();
+}
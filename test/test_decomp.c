@@ -0,0 +1,177 @@
+/*
+ * FIFO decompressor, bit exact: 8-bit (2xC) and 5-bit (3xC) differences
+ * with the sign extension of every field, 16-bit wrap-around, NC_T_1 /
+ * NC_T_2 lag and separate accelerometer / gyroscope references.
+ */
+#include "test.h"
+#include "fifo_ref.h"
+
+#define OUT_MAX                                 128
+
+static ism330dhcx_fifo_sample_t out[OUT_MAX];
+static int nout;
+
+static void on_sample(void *arg, const ism330dhcx_fifo_sample_t *s)
+{
+  (void)arg;
+
+  if (nout < OUT_MAX)
+  {
+    out[nout] = *s;
+    nout++;
+  }
+}
+
+static void feed(ism330dhcx_fifo_decomp_t *dc, const uint8_t *raw)
+{
+  ism330dhcx_fifo_word_t w;
+
+  CHECK(ism330dhcx_fifo_word_decode(raw, &w) == 0);
+  (void)ism330dhcx_fifo_decompress(dc, &w);
+}
+
+/* 16-bit wrap-around as done by the device */
+static int16_t wrap(int32_t v)
+{
+  return (int16_t)(uint16_t)((uint32_t)v & 0xFFFFU);
+}
+
+static int same(const ism330dhcx_fifo_sample_t *s, ism330dhcx_fifo_tag_t tag,
+                uint8_t cnt, int32_t x, int32_t y, int32_t z)
+{
+  return (s->tag == tag) && (s->cnt == cnt) && (s->val[0] == wrap(x)) &&
+         (s->val[1] == wrap(y)) && (s->val[2] == wrap(z));
+}
+
+static void test_2xc(void)
+{
+  ism330dhcx_fifo_decomp_t dc;
+  uint8_t w[ISM330DHCX_FIFO_WORD_LEN];
+
+  ism330dhcx_fifo_decomp_init(&dc, on_sample, NULL);
+  nout = 0;
+
+  /* compressed words before any reference are dropped */
+  w[0] = ref_tag_byte(ISM330DHCX_XL_2XC_TAG, 2);
+  feed(&dc, w);
+  CHECK((nout == 0) && (dc.dropped == 2U));
+
+  ref_word(w, ISM330DHCX_XL_NC_TAG, 0, 1000, -1000, 32767);
+  feed(&dc, w);
+
+  /* t-2: (+127, -128, +1), t-1: (-1, +1, -128) */
+  w[0] = ref_tag_byte(ISM330DHCX_XL_2XC_TAG, 3);
+  w[1] = 0x7F;
+  w[2] = 0x80;
+  w[3] = 0x01;
+  w[4] = 0xFF;
+  w[5] = 0x01;
+  w[6] = 0x80;
+  feed(&dc, w);
+
+  CHECK(nout == 3);
+  CHECK(same(&out[0], ISM330DHCX_XL_NC_TAG, 0, 1000, -1000, 32767));
+  CHECK(same(&out[1], ISM330DHCX_XL_NC_TAG, 1, 1127, -1128, 32768));
+  CHECK(same(&out[2], ISM330DHCX_XL_NC_TAG, 2, 1126, -1127, 32640));
+
+  /* the gyroscope has its own reference */
+  w[0] = ref_tag_byte(ISM330DHCX_GYRO_2XC_TAG, 3);
+  feed(&dc, w);
+  CHECK((nout == 3) && (dc.dropped == 4U));
+}
+
+static void test_3xc(void)
+{
+  ism330dhcx_fifo_decomp_t dc;
+  uint8_t w[ISM330DHCX_FIFO_WORD_LEN];
+  int32_t ref[3] = { -5, 7, 0 };
+  int32_t diff;
+  uint16_t packed;
+  int field;
+  int v;
+  int j;
+  int k;
+
+  ism330dhcx_fifo_decomp_init(&dc, on_sample, NULL);
+  nout = 0;
+  ref_word(w, ISM330DHCX_GYRO_NC_TAG, 1, (int16_t)ref[0], (int16_t)ref[1],
+           (int16_t)ref[2]);
+  feed(&dc, w);
+
+  /* every value of every 5-bit field, 3 samples per word */
+  k = 0;
+
+  for (field = 0; field < 3; field++)
+  {
+    for (v = 0; v < 32; v += 3)
+    {
+      w[0] = ref_tag_byte(ISM330DHCX_GYRO_3XC_TAG, 0);
+
+      for (j = 0; j < 3; j++)
+      {
+        /* bit 15 is not part of the fields */
+        packed = (uint16_t)((((v + j) & 0x1F) << (5 * field)) | 0x8000U);
+        w[1 + (2 * j)] = (uint8_t)(packed & 0xFFU);
+        w[2 + (2 * j)] = (uint8_t)(packed >> 8);
+      }
+
+      nout = 0;
+      feed(&dc, w);
+      CHECK(nout == 3);
+
+      for (j = 0; j < 3; j++)
+      {
+        diff = (v + j) & 0x1F;
+        diff = (diff >= 16) ? (diff - 32) : diff;
+        ref[field] += diff;
+        CHECK(same(&out[j], ISM330DHCX_GYRO_NC_TAG, (uint8_t)((j + 2) & 3),
+                   ref[0], ref[1], ref[2]));
+      }
+
+      k++;
+    }
+  }
+
+  CHECK(k == 33);
+}
+
+static void test_lag(void)
+{
+  ism330dhcx_fifo_decomp_t dc;
+  uint8_t w[ISM330DHCX_FIFO_WORD_LEN];
+
+  ism330dhcx_fifo_decomp_init(&dc, on_sample, NULL);
+  nout = 0;
+
+  /* slot 1 carries sample t-2 (cnt 3), then sample t-1 (cnt 0) */
+  ref_word(w, ISM330DHCX_XL_NC_T_2_TAG, 1, 10, 20, 30);
+  feed(&dc, w);
+  ref_word(w, ISM330DHCX_XL_NC_T_1_TAG, 1, 11, 21, 31);
+  feed(&dc, w);
+
+  /* slot 3: samples 1, 2, 3 as differences from the NC_T_1 sample */
+  w[0] = ref_tag_byte(ISM330DHCX_XL_3XC_TAG, 3);
+  w[1] = 0x21;                  /* x +1, y +1, z 0 */
+  w[2] = 0x00;
+  w[3] = 0x1F;                  /* x -1 */
+  w[4] = 0x00;
+  w[5] = 0x00;                  /* z -16 */
+  w[6] = 0x40;
+  feed(&dc, w);
+
+  CHECK(nout == 5);
+  CHECK(same(&out[0], ISM330DHCX_XL_NC_TAG, 3, 10, 20, 30));
+  CHECK(same(&out[1], ISM330DHCX_XL_NC_TAG, 0, 11, 21, 31));
+  CHECK(same(&out[2], ISM330DHCX_XL_NC_TAG, 1, 12, 22, 31));
+  CHECK(same(&out[3], ISM330DHCX_XL_NC_TAG, 2, 11, 22, 31));
+  CHECK(same(&out[4], ISM330DHCX_XL_NC_TAG, 3, 11, 22, 15));
+  CHECK(dc.samples == 5U);
+}
+
+int main(void)
+{
+  test_2xc();
+  test_3xc();
+  test_lag();
+  TEST_END();
+}
@@ -0,0 +1,141 @@
+/*
+ * Embedded functions outputs: ism330dhcx_emb_outputs_get() and the
+ * *_emb_get functions inside a session read every field from the
+ * embedded functions bank, switching bank exactly once in and once out,
+ * and leave the user bank selected.
+ */
+#include <string.h>
+
+#include "buslog.h"
+
+static buslog_t bus;
+static stmdev_ctx_t ctx;
+
+static void fill(void)
+{
+  uint8_t *emb = bus.emu.reg[ISM330DHCX_EMBEDDED_FUNC_BANK];
+  uint8_t i;
+
+  emb[ISM330DHCX_EMB_FUNC_STATUS] = 0x38;
+  emb[ISM330DHCX_FSM_STATUS_A] = 0xA5;
+  emb[ISM330DHCX_FSM_STATUS_B] = 0x5A;
+  emb[ISM330DHCX_MLC_STATUS] = 0xC3;
+
+  for (i = 0; i < 16U; i++)
+  {
+    emb[ISM330DHCX_FSM_OUTS1 + i] = (uint8_t)(0x20U + i);
+  }
+
+  emb[ISM330DHCX_STEP_COUNTER_L] = 0x34;
+  emb[ISM330DHCX_STEP_COUNTER_H] = 0x12;
+
+  for (i = 0; i < 8U; i++)
+  {
+    emb[ISM330DHCX_MLC0_SRC + i] = (uint8_t)(0x40U + i);
+  }
+}
+
+/* accesses after the bank switch in, up to the switch out */
+static int in_emb_bank(void)
+{
+  int in = 0;
+  int ok = 1;
+  int i;
+
+  for (i = 0; i < bus.n; i++)
+  {
+    if ((bus.acc[i].rd == 0U) &&
+        (bus.acc[i].reg == ISM330DHCX_FUNC_CFG_ACCESS))
+    {
+      in = !in;
+    }
+
+    else if (in != 0)
+    {
+      ok &= (bus.acc[i].bank == ISM330DHCX_EMBEDDED_FUNC_BANK) ? 1 : 0;
+    }
+  }
+
+  return ok && (in == 0);
+}
+
+static int fsm_out_ok(const ism330dhcx_fsm_out_t *out)
+{
+  const uint8_t *b = (const uint8_t *)out;
+  uint8_t i;
+
+  for (i = 0; i < 16U; i++)
+  {
+    if (b[i] != (0x20U + i))
+    {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+int main(void)
+{
+  static const uint8_t mlc[8] =
+  {
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+  };
+  ism330dhcx_emb_outputs_t val;
+  ism330dhcx_fsm_out_t fsm_out;
+  uint8_t mlc_src[8];
+  uint16_t steps;
+  uint8_t id;
+
+  buslog_ctx(&ctx, &bus);
+  fill();
+
+  /* every field in one call */
+  memset(&val, 0, sizeof(val));
+  CHECK(ism330dhcx_emb_outputs_get(&ctx, &val) == 0);
+  CHECK(*(uint8_t *)&val.emb_func_status == 0x38U);
+  CHECK(*(uint8_t *)&val.fsm_status_a == 0xA5U);
+  CHECK(*(uint8_t *)&val.fsm_status_b == 0x5AU);
+  CHECK(*(uint8_t *)&val.mlc_status == 0xC3U);
+  CHECK(fsm_out_ok(&val.fsm_out));
+  CHECK(val.step_counter == 0x1234U);
+  CHECK(memcmp(val.mlc_src, mlc, 8) == 0);
+
+  /* FUNC_CFG_ACCESS written exactly twice: enter, then leave */
+  CHECK(buslog_bank_writes(&bus) == 2);
+  CHECK(in_emb_bank());
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS] ==
+        0x00U);
+  buslog_clear(&bus);
+  CHECK(ism330dhcx_device_id_get(&ctx, &id) == 0);
+  CHECK(id == ISM330DHCX_ID);
+  CHECK(bus.acc[0].bank == ISM330DHCX_USER_BANK);
+
+  /* the single readers grouped in one session */
+  buslog_clear(&bus);
+  memset(&fsm_out, 0, sizeof(fsm_out));
+  memset(mlc_src, 0, sizeof(mlc_src));
+  steps = 0;
+  CHECK(ism330dhcx_emb_session_start(&ctx) == 0);
+  CHECK(ism330dhcx_fsm_out_emb_get(&ctx, &fsm_out) == 0);
+  CHECK(ism330dhcx_mlc_out_emb_get(&ctx, mlc_src) == 0);
+  CHECK(ism330dhcx_number_of_steps_emb_get(&ctx, &steps) == 0);
+  CHECK(ism330dhcx_emb_session_stop(&ctx) == 0);
+  CHECK(fsm_out_ok(&fsm_out));
+  CHECK(memcmp(mlc_src, mlc, 8) == 0);
+  CHECK(steps == 0x1234U);
+  CHECK(buslog_bank_writes(&bus) == 2);
+  CHECK(in_emb_bank());
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS] ==
+        0x00U);
+
+  /* the standalone getters switch bank on their own */
+  buslog_clear(&bus);
+  steps = 0;
+  CHECK(ism330dhcx_number_of_steps_get(&ctx, &steps) == 0);
+  CHECK(steps == 0x1234U);
+  CHECK(buslog_bank_writes(&bus) == 2);
+  CHECK(in_emb_bank());
+
+  TEST_END();
+}
@@ -0,0 +1,222 @@
+/*
+ * Emulator backend: register banks, address auto-increment, page
+ * access, FIFO batching at ODR with tags, overrun and software reset.
+ */
+#include "test.h"
+
+typedef struct
+{
+  uint32_t tag[32];
+  uint8_t cnt;
+  uint32_t cnt_err;
+  uint32_t slots;
+  uint32_t ts[16];
+  int16_t xl[3];
+  uint8_t cfg[3];
+} fifo_log_t;
+
+static void on_word(void *arg, const ism330dhcx_fifo_word_t *w)
+{
+  fifo_log_t *log = (fifo_log_t *)arg;
+
+  log->tag[w->tag]++;
+
+  if (w->tag == ISM330DHCX_TIMESTAMP_TAG)
+  {
+    if (log->slots < 16U)
+    {
+      log->ts[log->slots] = (uint32_t)w->data[0] |
+                            ((uint32_t)w->data[1] << 8) |
+                            ((uint32_t)w->data[2] << 16) |
+                            ((uint32_t)w->data[3] << 24);
+    }
+
+    /* one time slot per timestamp word with DEC_1 */
+    if ((log->slots > 0U) && (w->cnt != ((log->cnt + 1U) & 3U)))
+    {
+      log->cnt_err++;
+    }
+
+    log->cnt = w->cnt;
+    log->slots++;
+  }
+
+  else if (w->tag == ISM330DHCX_CFG_CHANGE_TAG)
+  {
+    log->cfg[0] = w->data[0];
+    log->cfg[1] = w->data[1];
+    log->cfg[2] = w->data[2];
+  }
+
+  else
+  {
+    if (w->cnt != log->cnt)
+    {
+      log->cnt_err++;
+    }
+
+    if (w->tag == ISM330DHCX_XL_NC_TAG)
+    {
+      log->xl[0] = (int16_t)((uint16_t)w->data[0] | ((uint16_t)w->data[1] << 8));
+      log->xl[1] = (int16_t)((uint16_t)w->data[2] | ((uint16_t)w->data[3] << 8));
+      log->xl[2] = (int16_t)((uint16_t)w->data[4] | ((uint16_t)w->data[5] << 8));
+    }
+  }
+}
+
+static void decoder_setup(ism330dhcx_fifo_decoder_t *dec, fifo_log_t *log)
+{
+  uint8_t t;
+
+  ism330dhcx_fifo_decoder_init(dec, log);
+
+  for (t = 1; t <= (uint8_t)ISM330DHCX_CFG_CHANGE_TAG; t++)
+  {
+    ism330dhcx_fifo_decoder_handler_set(dec, (ism330dhcx_fifo_tag_t)t, on_word);
+  }
+}
+
+static void test_banks(void)
+{
+  ism330dhcx_emu_t emu;
+  stmdev_ctx_t ctx;
+  uint8_t buf[4] = { 0x11, 0x22, 0x33, 0x44 };
+  uint8_t id = 0;
+  uint8_t val = 0;
+
+  test_emu_ctx(&ctx, &emu);
+
+  CHECK(ism330dhcx_device_id_get(&ctx, &id) == 0);
+  CHECK(id == ISM330DHCX_ID);
+
+  /* the same address in each bank */
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_EMBEDDED_FUNC_BANK) == 0);
+  CHECK(ism330dhcx_write_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &buf[0], 1) == 0);
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_SENSOR_HUB_BANK) == 0);
+  CHECK(ism330dhcx_write_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &buf[1], 1) == 0);
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_USER_BANK) == 0);
+  CHECK(emu.reg[ISM330DHCX_EMBEDDED_FUNC_BANK][ISM330DHCX_EMB_FUNC_EN_A] == 0x11U);
+  CHECK(emu.reg[ISM330DHCX_SENSOR_HUB_BANK][ISM330DHCX_EMB_FUNC_EN_A] == 0x22U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_EMB_FUNC_EN_A] == 0x00U);
+
+  /* auto-increment on (default) and off */
+  CHECK(ism330dhcx_write_reg(&ctx, ISM330DHCX_CTRL1_XL, buf, 2) == 0);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL] == 0x11U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL2_G] == 0x22U);
+  CHECK(ism330dhcx_auto_increment_set(&ctx, PROPERTY_DISABLE) == 0);
+  CHECK(ism330dhcx_write_reg(&ctx, ISM330DHCX_CTRL1_XL, &buf[2], 2) == 0);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL] == 0x44U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL2_G] == 0x22U);
+  CHECK(ism330dhcx_auto_increment_set(&ctx, PROPERTY_ENABLE) == 0);
+
+  /* advanced embedded function pages */
+  val = 0xA5;
+  CHECK(ism330dhcx_ln_pg_write_byte(&ctx, 0x0123U, &val) == 0);
+  val = 0;
+  CHECK(ism330dhcx_ln_pg_read_byte(&ctx, 0x0123U, &val) == 0);
+  CHECK(val == 0xA5U);
+  CHECK(emu.page[1][0x23] == 0xA5U);
+  CHECK(emu.page[0][0x23] == 0x00U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS] == 0x00U);
+
+  /* software reset self-clears and restores the defaults */
+  CHECK(ism330dhcx_reset_set(&ctx, PROPERTY_ENABLE) == 0);
+  CHECK(ism330dhcx_reset_get(&ctx, &val) == 0);
+  CHECK(val == 0U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL] == 0x00U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL3_C] == 0x04U);
+}
+
+static void test_fifo(void)
+{
+  static uint8_t buff[ISM330DHCX_FIFO_WORDS * ISM330DHCX_FIFO_WORD_LEN];
+  ism330dhcx_fifo_decoder_t dec;
+  ism330dhcx_fifo_state_t state;
+  ism330dhcx_emu_t emu;
+  stmdev_ctx_t ctx;
+  fifo_log_t log = { { 0 }, 0, 0, 0, { 0 }, { 0 }, { 0 } };
+  uint16_t level = 0;
+
+  test_emu_ctx(&ctx, &emu);
+  decoder_setup(&dec, &log);
+  emu.xl[0] = 100;
+  emu.xl[1] = -200;
+  emu.xl[2] = 16393;
+
+  CHECK(ism330dhcx_fifo_xl_batch_set(&ctx, ISM330DHCX_XL_BATCHED_AT_104Hz) == 0);
+  CHECK(ism330dhcx_fifo_gy_batch_set(&ctx, ISM330DHCX_GY_BATCHED_AT_104Hz) == 0);
+  CHECK(ism330dhcx_fifo_timestamp_decimation_set(&ctx, ISM330DHCX_DEC_1) == 0);
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_STREAM_MODE) == 0);
+  CHECK(ism330dhcx_timestamp_set(&ctx, PROPERTY_ENABLE) == 0);
+  CHECK(ism330dhcx_xl_data_rate_set(&ctx, ISM330DHCX_XL_ODR_104Hz) == 0);
+  CHECK(ism330dhcx_gy_data_rate_set(&ctx, ISM330DHCX_GY_ODR_104Hz) == 0);
+
+  /* 100 ms at 104 Hz: 10 time slots of timestamp + gyro + accelerometer */
+  ism330dhcx_emu_run(&emu, 100000U);
+  CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+  CHECK(level == 30U);
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, level) == 0);
+  CHECK(ism330dhcx_fifo_decode(&dec, buff, level) == level);
+  CHECK(dec.parity_err == 0U);
+  CHECK(dec.unknown == 0U);
+  CHECK(log.tag[ISM330DHCX_TIMESTAMP_TAG] == 10U);
+  CHECK(log.tag[ISM330DHCX_XL_NC_TAG] == 10U);
+  CHECK(log.tag[ISM330DHCX_GYRO_NC_TAG] == 10U);
+  CHECK(log.cnt_err == 0U);
+  /* slots every 9.6 ms = 384 timestamp LSB */
+  CHECK(log.ts[0] == 384U);
+  CHECK(log.ts[9] == 3840U);
+  CHECK((log.xl[0] == 100) && (log.xl[1] == -200) && (log.xl[2] == 16393));
+  CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+  CHECK(level == 0U);
+
+  /* configuration change word with the new settings */
+  CHECK(ism330dhcx_fifo_virtual_sens_odr_chg_set(&ctx, PROPERTY_ENABLE) == 0);
+  CHECK(ism330dhcx_xl_data_rate_set(&ctx, ISM330DHCX_XL_ODR_52Hz) == 0);
+  CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+  CHECK(level == 1U);
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, level) == 0);
+  (void)ism330dhcx_fifo_decode(&dec, buff, level);
+  CHECK(log.tag[ISM330DHCX_CFG_CHANGE_TAG] == 1U);
+  CHECK(log.cfg[0] == emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL]);
+  CHECK(log.cfg[2] == emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FIFO_CTRL3]);
+
+  /* continuous mode: oldest words overwritten, overrun flags */
+  ism330dhcx_emu_run(&emu, 5000000U);
+  CHECK(emu.overwritten > 0U);
+  CHECK(ism330dhcx_fifo_state_get(&ctx, &state) == 0);
+  CHECK(state.level == ISM330DHCX_FIFO_WORDS);
+  CHECK(state.full == 1U);
+  CHECK((state.ovr == 1U) && (state.ovr_latched == 1U));
+  CHECK(ism330dhcx_fifo_state_get(&ctx, &state) == 0);
+  CHECK((state.ovr == 1U) && (state.ovr_latched == 0U));
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, 1) == 0);
+  CHECK(ism330dhcx_fifo_state_get(&ctx, &state) == 0);
+  CHECK((state.ovr == 0U) && (state.level == ISM330DHCX_FIFO_WORDS - 1U));
+
+  /* FIFO mode: batching stops when full */
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_BYPASS_MODE) == 0);
+  CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+  CHECK(level == 0U);
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_FIFO_MODE) == 0);
+  ism330dhcx_emu_run(&emu, 5000000U);
+  CHECK(emu.dropped > 0U);
+  CHECK(ism330dhcx_fifo_state_get(&ctx, &state) == 0);
+  CHECK((state.level == ISM330DHCX_FIFO_WORDS) && (state.ovr == 0U));
+
+  /* stop on watermark */
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_BYPASS_MODE) == 0);
+  CHECK(ism330dhcx_fifo_watermark_set(&ctx, 20U) == 0);
+  CHECK(ism330dhcx_fifo_stop_on_wtm_set(&ctx, PROPERTY_ENABLE) == 0);
+  CHECK(ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_FIFO_MODE) == 0);
+  ism330dhcx_emu_run(&emu, 1000000U);
+  CHECK(ism330dhcx_fifo_state_get(&ctx, &state) == 0);
+  CHECK((state.level == 20U) && (state.wtm == 1U));
+}
+
+int main(void)
+{
+  test_banks();
+  test_fifo();
+  TEST_END();
+}
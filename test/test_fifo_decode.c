@@ -0,0 +1,85 @@
+/*
+ * Table-driven FIFO word decoder: tag classification against the former
+ * switch, tag counter, parity check and per-tag dispatch.
+ */
+#include "test.h"
+#include "fifo_ref.h"
+
+static uint32_t calls[32];
+static uint8_t last_cnt;
+
+static void on_word(void *arg, const ism330dhcx_fifo_word_t *w)
+{
+  (void)arg;
+  calls[w->tag]++;
+  last_cnt = w->cnt;
+}
+
+static void test_classify(void)
+{
+  ism330dhcx_fifo_word_t w;
+  ism330dhcx_fifo_tag_t tag;
+  uint8_t word[ISM330DHCX_FIFO_WORD_LEN] = { 0 };
+  uint8_t p;
+  int b;
+  int ret;
+  int known;
+
+  for (b = 0; b < 256; b++)
+  {
+    word[0] = (uint8_t)b;
+    p = (uint8_t)b;
+    p ^= p >> 4;
+    p ^= p >> 2;
+    p ^= p >> 1;
+    known = (ref_tag_switch((uint8_t)(b >> 3)) !=
+             ISM330DHCX_SENSORHUB_NACK_TAG) || ((b >> 3) == 0x19);
+
+    ism330dhcx_fifo_word_tag_get(word, &tag);
+    CHECK(tag == ref_tag_switch((uint8_t)(b >> 3)));
+
+    ret = ism330dhcx_fifo_word_decode(word, &w);
+    CHECK(ret == ((((p & 1U) == 0U) && known) ? 0 : -1));
+    CHECK(w.cnt == ((b >> 1) & 3));
+    CHECK(w.data == &word[1]);
+
+    if (known)
+    {
+      CHECK(w.tag == ref_tag_switch((uint8_t)(b >> 3)));
+    }
+  }
+}
+
+static void test_dispatch(void)
+{
+  ism330dhcx_fifo_decoder_t dec;
+  uint8_t buff[6 * ISM330DHCX_FIFO_WORD_LEN];
+
+  ism330dhcx_fifo_decoder_init(&dec, NULL);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_XL_NC_TAG, on_word);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_GYRO_NC_TAG, on_word);
+
+  ref_word(&buff[0], ISM330DHCX_GYRO_NC_TAG, 1, 1, 2, 3);
+  ref_word(&buff[7], ISM330DHCX_XL_NC_TAG, 1, 4, 5, 6);
+  ref_word(&buff[14], ISM330DHCX_TIMESTAMP_TAG, 2, 0, 0, 0); /* no handler */
+  ref_word(&buff[21], ISM330DHCX_XL_NC_TAG, 2, 4, 5, 6);
+  buff[21] ^= 0x01U;                                       /* parity */
+  ref_word(&buff[28], 0x1F, 2, 0, 0, 0);                   /* unknown */
+  ref_word(&buff[35], ISM330DHCX_XL_NC_TAG, 3, 7, 8, 9);
+
+  CHECK(ism330dhcx_fifo_decode(&dec, buff, 6) == 3); /* dispatched */
+  CHECK(dec.words == 6U);
+  CHECK(dec.parity_err == 1U);
+  CHECK(dec.unknown == 1U);
+  CHECK(calls[ISM330DHCX_GYRO_NC_TAG] == 1U);
+  CHECK(calls[ISM330DHCX_XL_NC_TAG] == 2U);
+  CHECK(calls[ISM330DHCX_TIMESTAMP_TAG] == 0U);
+  CHECK(last_cnt == 3U);
+}
+
+int main(void)
+{
+  test_classify();
+  test_dispatch();
+  TEST_END();
+}
@@ -0,0 +1,133 @@
+/*
+ * FIFO timestamp reconstruction at 12.5 Hz and 104 Hz: nominal slot
+ * period, measured slot period (76.8 ms does not fit 32 bits of ps) and
+ * per-sample times against the emulator sample times.
+ */
+#include "test.h"
+
+#define SAMPLES_MAX                             2048
+
+typedef struct
+{
+  ism330dhcx_fifo_ts_t ts;
+  uint64_t ns[SAMPLES_MAX];   /* emulator sample times */
+  uint32_t produced;
+  uint32_t checked;
+  uint64_t err_max;
+} ts_check_t;
+
+static void on_emu_sample(void *arg, ism330dhcx_fifo_tag_t tag, uint64_t ns,
+                          int16_t *val)
+{
+  ts_check_t *c = (ts_check_t *)arg;
+
+  (void)val;
+
+  if ((tag == ISM330DHCX_XL_NC_TAG) && (c->produced < SAMPLES_MAX))
+  {
+    c->ns[c->produced] = ns;
+    c->produced++;
+  }
+}
+
+static void on_word(void *arg, const ism330dhcx_fifo_word_t *w)
+{
+  ts_check_t *c = (ts_check_t *)arg;
+  uint64_t ns;
+  uint64_t err;
+
+  ism330dhcx_fifo_ts_word(&c->ts, w);
+
+  if (w->tag != ISM330DHCX_XL_NC_TAG)
+  {
+    return;
+  }
+
+  CHECK(ism330dhcx_fifo_ts_get(&c->ts, w->cnt, &ns) == 0);
+
+  /* from the second TIMESTAMP word on, the measured period is used */
+  if (c->checked >= 8U)
+  {
+    err = (ns > c->ns[c->checked]) ? (ns - c->ns[c->checked]) :
+          (c->ns[c->checked] - ns);
+    c->err_max = (err > c->err_max) ? err : c->err_max;
+  }
+
+  c->checked++;
+}
+
+static void run(ism330dhcx_odr_xl_t odr, ism330dhcx_bdr_xl_t bdr,
+                float_t hz, uint64_t slot_ps, uint32_t us)
+{
+  static uint8_t buff[ISM330DHCX_FIFO_WORDS * ISM330DHCX_FIFO_WORD_LEN];
+  static ts_check_t c;
+  ism330dhcx_fifo_decoder_t dec;
+  ism330dhcx_emu_t emu;
+  stmdev_ctx_t ctx;
+  uint16_t level;
+  uint32_t t;
+
+  test_emu_ctx(&ctx, &emu);
+  emu.sample = on_emu_sample;
+  emu.arg = &c;
+  c.produced = 0;
+  c.checked = 0;
+  c.err_max = 0;
+
+  ism330dhcx_fifo_ts_init(&c.ts, hz, ISM330DHCX_DEC_8, 0);
+  CHECK(c.ts.slot_ps == slot_ps);
+
+  ism330dhcx_fifo_decoder_init(&dec, &c);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_XL_NC_TAG, on_word);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_TIMESTAMP_TAG, on_word);
+
+  (void)ism330dhcx_fifo_xl_batch_set(&ctx, bdr);
+  (void)ism330dhcx_fifo_timestamp_decimation_set(&ctx, ISM330DHCX_DEC_8);
+  (void)ism330dhcx_fifo_mode_set(&ctx, ISM330DHCX_STREAM_MODE);
+  (void)ism330dhcx_timestamp_set(&ctx, PROPERTY_ENABLE);
+  (void)ism330dhcx_xl_data_rate_set(&ctx, odr);
+
+  for (t = 0; t < us; t += 500000U)
+  {
+    ism330dhcx_emu_run(&emu, 500000U);
+    CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+    CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, level) == 0);
+    (void)ism330dhcx_fifo_decode(&dec, buff, level);
+  }
+
+  /* emulator periods: 512 and 64 base periods of 150 us */
+  CHECK(c.ts.slot_ps == ((odr == ISM330DHCX_XL_ODR_12Hz5) ? 76800000000ULL :
+                         9600000000ULL));
+  CHECK(c.checked == c.produced);
+  CHECK(c.checked > 100U);
+  CHECK(c.err_max <= 1U);
+}
+
+int main(void)
+{
+  ism330dhcx_fifo_ts_t ts;
+
+  /* nominal periods, trimmed: 1 / odr * tick_ps / 25 us */
+  ism330dhcx_fifo_ts_init(&ts, 12.5f, ISM330DHCX_DEC_1, 0);
+  CHECK(ts.slot_ps == 80000000000ULL);
+  ism330dhcx_fifo_ts_init(&ts, 104.0f, ISM330DHCX_DEC_1, 0);
+  CHECK(ts.slot_ps == 9615384615ULL);
+  ism330dhcx_fifo_ts_init(&ts, 1.6f, ISM330DHCX_DEC_1, 10);
+  CHECK(ts.tick_ps == 24630542U);     /* 25 us / 1.015 */
+  CHECK(ts.slot_ps == 615763550000ULL);
+
+  /* out of range rates: unknown until measured */
+  ism330dhcx_fifo_ts_rate_set(&ts, 0.0f);
+  CHECK(ts.slot_ps == 0U);
+  ism330dhcx_fifo_ts_rate_set(&ts, 1.0e30f);
+  CHECK(ts.slot_ps == 0U);
+  ism330dhcx_fifo_ts_rate_set(&ts, -5.0f);
+  CHECK(ts.slot_ps == 0U);
+
+  run(ISM330DHCX_XL_ODR_12Hz5, ISM330DHCX_XL_BATCHED_AT_12Hz5, 12.5f,
+      80000000000ULL, 120000000U);
+  run(ISM330DHCX_XL_ODR_104Hz, ISM330DHCX_XL_BATCHED_AT_104Hz, 104.0f,
+      9615384615ULL, 15000000U);
+
+  TEST_END();
+}
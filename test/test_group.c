@@ -0,0 +1,108 @@
+/*
+ * Device group: round-robin rotation among the devices of one bus,
+ * overrun accounting and deadline ordering.
+ */
+#include "test.h"
+
+#define DEVS                                    3
+
+static ism330dhcx_emu_t emu[DEVS];
+static stmdev_ctx_t ctx[DEVS];
+static int served[16];
+static int nserved;
+
+static void sink(void *arg, ism330dhcx_fifo_tag_t tag, const uint8_t *data)
+{
+  int id = *(const int *)arg;
+
+  (void)tag;
+  (void)data;
+
+  /* record the device order, once per device */
+  if ((nserved == 0) || (served[nserved - 1] != id))
+  {
+    served[nserved] = id;
+    nserved++;
+  }
+}
+
+static void setup(int i, ism330dhcx_bdr_xl_t bdr)
+{
+  test_emu_ctx(&ctx[i], &emu[i]);
+  (void)ism330dhcx_fifo_xl_batch_set(&ctx[i], bdr);
+  (void)ism330dhcx_fifo_mode_set(&ctx[i], ISM330DHCX_STREAM_MODE);
+  (void)ism330dhcx_xl_data_rate_set(&ctx[i], ISM330DHCX_XL_ODR_833Hz);
+}
+
+static void run(uint32_t us)
+{
+  int i;
+
+  for (i = 0; i < DEVS; i++)
+  {
+    ism330dhcx_emu_run(&emu[i], us);
+  }
+}
+
+int main(void)
+{
+  static const int id[DEVS] = { 0, 1, 2 };
+  ism330dhcx_group_t group;
+  int first[4];
+  int i;
+
+  setup(0, ISM330DHCX_XL_BATCHED_AT_104Hz);
+  setup(1, ISM330DHCX_XL_BATCHED_AT_104Hz);
+  setup(2, ISM330DHCX_XL_BATCHED_AT_833Hz);
+
+  /* bus 0: devices 0 and 2, bus 1: device 1 */
+  ism330dhcx_group_init(&group, ISM330DHCX_GROUP_ROUND_ROBIN);
+  CHECK(ism330dhcx_group_add(&group, &ctx[0], 0, sink, (void *)&id[0]) == 0);
+  CHECK(ism330dhcx_group_add(&group, &ctx[1], 1, sink, (void *)&id[1]) == 0);
+  CHECK(ism330dhcx_group_add(&group, &ctx[2], 0, sink, (void *)&id[2]) == 0);
+
+  /* the first device served alternates between the 2 devices of bus 0 */
+  for (i = 0; i < 4; i++)
+  {
+    run(50000U);
+    nserved = 0;
+    CHECK(ism330dhcx_group_poll(&group, 0, 0) == 0);
+    CHECK(nserved == 2);
+    first[i] = served[0];
+  }
+
+  CHECK((first[0] == 0) && (first[1] == 2) && (first[2] == 0) &&
+        (first[3] == 2));
+  CHECK(group.dev[1].words == 0U);
+  CHECK(ism330dhcx_group_poll(&group, 1, 0) == 0);
+  CHECK(group.dev[1].words > 0U);
+
+  /* overrun whose FIFO_OVR_IA was cleared by an earlier FIFO read */
+  ism330dhcx_emu_run(&emu[1], 5000000U);
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx[1], (uint8_t *)first, 1) == 0);
+  CHECK((emu[1].ovr == 0U) && (emu[1].ovr_latched == 1U));
+  CHECK(ism330dhcx_group_poll(&group, 1, 0) == 0);
+  CHECK(group.dev[1].overruns == 1U);
+
+  /* deadline: device 0 holds more words but device 2 fills 8x faster */
+  ism330dhcx_group_init(&group, ISM330DHCX_GROUP_DEADLINE_FIRST);
+  CHECK(ism330dhcx_group_add(&group, &ctx[0], 0, sink, (void *)&id[0]) == 0);
+  CHECK(ism330dhcx_group_add(&group, &ctx[2], 0, sink, (void *)&id[2]) == 0);
+  CHECK(ism330dhcx_group_rate_set(&group, &ctx[0], 104U) == 0);
+  CHECK(ism330dhcx_group_rate_set(&group, &ctx[2], 833U) == 0);
+  CHECK(ism330dhcx_group_rate_set(&group, &ctx[1], 833U) == -1);
+
+  for (i = 0; i < 2; i++)
+  {
+    run(2000000U);
+    (void)ism330dhcx_fifo_mode_set(&ctx[2], ISM330DHCX_BYPASS_MODE);
+    (void)ism330dhcx_fifo_mode_set(&ctx[2], ISM330DHCX_STREAM_MODE);
+    run(100000U);
+    CHECK((emu[0].level > 2U * emu[2].level) && (emu[0].level < ISM330DHCX_FIFO_WORDS));
+    nserved = 0;
+    CHECK(ism330dhcx_group_poll(&group, 0, 0) == 0);
+    CHECK((nserved == 2) && (served[0] == 2));
+  }
+
+  TEST_END();
+}
@@ -0,0 +1,152 @@
+/*
+ * Linux bus backends with the ioctl replaced: SPI address byte with the
+ * read bit (0x80) and two-transfer framing of single and multi-byte
+ * accesses, I2C combined messages. Built on Linux only.
+ */
+#include <string.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <linux/spi/spidev.h>
+
+#include "ism330dhcx_i2cdev.h"
+#include "ism330dhcx_spidev.h"
+#include "test.h"
+
+/* last bus call, copied while its arguments are alive */
+static unsigned long req;
+static int calls;
+static int ret_val;
+static struct spi_ioc_transfer spi[2];
+static uint8_t cmd;
+static struct i2c_msg msg[2];
+static uint32_t nmsgs;
+static uint8_t i2c_buf[2][64];
+
+static int fake_spi(int fd, unsigned long r, void *arg)
+{
+  struct spi_ioc_transfer *xfer = (struct spi_ioc_transfer *)arg;
+  uint8_t *rx;
+  uint32_t i;
+
+  (void)fd;
+  req = r;
+  calls++;
+  memcpy(spi, xfer, sizeof(spi));
+  cmd = *(const uint8_t *)(uintptr_t)xfer[0].tx_buf;
+  rx = (uint8_t *)(uintptr_t)xfer[1].rx_buf;
+
+  for (i = 0; (rx != NULL) && (i < xfer[1].len); i++)
+  {
+    rx[i] = (uint8_t)(0x6BU + i);
+  }
+
+  return ret_val;
+}
+
+static int fake_i2c(int fd, unsigned long r, void *arg)
+{
+  struct i2c_rdwr_ioctl_data *xfer = (struct i2c_rdwr_ioctl_data *)arg;
+  uint32_t i;
+  uint32_t j;
+
+  (void)fd;
+  req = r;
+  calls++;
+  nmsgs = xfer->nmsgs;
+
+  for (i = 0; i < xfer->nmsgs; i++)
+  {
+    msg[i] = xfer->msgs[i];
+
+    for (j = 0; j < xfer->msgs[i].len; j++)
+    {
+      if ((xfer->msgs[i].flags & I2C_M_RD) != 0U)
+      {
+        xfer->msgs[i].buf[j] = (uint8_t)(0x6BU + j);
+      }
+
+      i2c_buf[i][j] = xfer->msgs[i].buf[j];
+    }
+  }
+
+  return (ret_val < 0) ? ret_val : (int)xfer->nmsgs;
+}
+
+int main(void)
+{
+  static const uint8_t wr[3] = { 0xA1, 0xA2, 0xA3 };
+  static uint8_t big[ISM330DHCX_I2CDEV_WRITE_MAX + 1U];
+  ism330dhcx_spidev_t spidev;
+  ism330dhcx_i2cdev_t i2cdev;
+  stmdev_ctx_t ctx;
+  uint8_t rd[3 * ISM330DHCX_FIFO_WORD_LEN];
+  uint8_t id;
+
+  memset(&ctx, 0, sizeof(ctx));
+
+  /* SPI: read bit set, address then data under one message */
+  spidev.fd = 3;
+  spidev.speed_hz = 8000000U;
+  spidev.ioctl = fake_spi;
+  ism330dhcx_spidev_ctx_init(&ctx, &spidev);
+  CHECK(ism330dhcx_device_id_get(&ctx, &id) == 0);
+  CHECK(calls == 1);
+  CHECK(req == SPI_IOC_MESSAGE(2));
+  CHECK(cmd == (0x80U | ISM330DHCX_WHO_AM_I));
+  CHECK((spi[0].len == 1U) && (spi[0].rx_buf == 0U));
+  CHECK((spi[1].len == 1U) && (spi[1].tx_buf == 0U));
+  CHECK((spi[0].speed_hz == 8000000U) && (spi[1].speed_hz == 8000000U));
+  CHECK(id == ISM330DHCX_ID);
+
+  /* multi-byte read: one address byte, len data bytes, no extra bit */
+  calls = 0;
+  CHECK(ism330dhcx_spidev_read_reg(&spidev, ISM330DHCX_FIFO_DATA_OUT_TAG, rd,
+                                   sizeof(rd)) == 0);
+  CHECK(calls == 1);
+  CHECK(cmd == (0x80U | ISM330DHCX_FIFO_DATA_OUT_TAG));
+  CHECK(spi[1].len == sizeof(rd));
+  CHECK(spi[1].rx_buf == (uintptr_t)rd);
+  CHECK((rd[0] == 0x6BU) && (rd[sizeof(rd) - 1U] == 0x6BU + sizeof(rd) - 1U));
+
+  /* multi-byte write: read bit cleared, data sent as is */
+  CHECK(ism330dhcx_spidev_write_reg(&spidev, 0x80U | ISM330DHCX_CTRL1_XL, wr,
+                                    3) == 0);
+  CHECK(cmd == ISM330DHCX_CTRL1_XL);
+  CHECK((spi[1].len == 3U) && (spi[1].tx_buf == (uintptr_t)wr) &&
+        (spi[1].rx_buf == 0U));
+
+  ret_val = -1;
+  CHECK(ism330dhcx_spidev_read_reg(&spidev, ISM330DHCX_WHO_AM_I, rd, 1) == -1);
+  CHECK(ism330dhcx_spidev_write_reg(&spidev, ISM330DHCX_CTRL1_XL, wr, 1) ==
+        -1);
+  ret_val = 0;
+
+  /* I2C: write + repeated start + read, address from the 8-bit form */
+  i2cdev.fd = 3;
+  i2cdev.addr = ISM330DHCX_I2C_ADD_L >> 1;
+  i2cdev.ioctl = fake_i2c;
+  ism330dhcx_i2cdev_ctx_init(&ctx, &i2cdev);
+  calls = 0;
+  CHECK(ism330dhcx_device_id_get(&ctx, &id) == 0);
+  CHECK((calls == 1) && (req == I2C_RDWR) && (nmsgs == 2U));
+  CHECK((msg[0].addr == 0x6AU) && (msg[0].flags == 0U) &&
+        (msg[0].len == 1U) && (i2c_buf[0][0] == ISM330DHCX_WHO_AM_I));
+  CHECK((msg[1].addr == 0x6AU) && (msg[1].flags == I2C_M_RD) &&
+        (msg[1].len == 1U));
+  CHECK(id == ISM330DHCX_ID);
+
+  CHECK(ism330dhcx_i2cdev_write_reg(&i2cdev, ISM330DHCX_CTRL1_XL, wr, 3) ==
+        0);
+  CHECK((nmsgs == 1U) && (msg[0].len == 4U) && (msg[0].flags == 0U));
+  CHECK((i2c_buf[0][0] == ISM330DHCX_CTRL1_XL) && (i2c_buf[0][1] == 0xA1U) &&
+        (i2c_buf[0][3] == 0xA3U));
+
+  calls = 0;
+  CHECK(ism330dhcx_i2cdev_write_reg(&i2cdev, ISM330DHCX_CTRL1_XL, big,
+                                    sizeof(big)) == -1);
+  CHECK(calls == 0);
+  ret_val = -1;
+  CHECK(ism330dhcx_i2cdev_read_reg(&i2cdev, ISM330DHCX_WHO_AM_I, rd, 1) == -1);
+
+  TEST_END();
+}
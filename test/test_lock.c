@@ -0,0 +1,113 @@
+/*
+ * Interface lock: an embedded functions bank session in one thread and
+ * user bank read-modify-write calls in another never interleave, and
+ * only the lock owner releases the level held for a bank sequence.
+ */
+#include "test.h"
+#include "lock.h"
+
+#define LOOPS                                   20000
+
+static stmdev_ctx_t ctx;
+static ism330dhcx_emu_t emu;
+static ism330dhcx_priv_t priv;
+static test_lock_t lock;
+static int emb_err;
+static int user_err;
+
+static void *emb_thread(void *arg)
+{
+  uint8_t val;
+  int i;
+
+  (void)arg;
+
+  for (i = 0; i < LOOPS; i++)
+  {
+    val = 0;
+
+    if ((ism330dhcx_emb_session_start(&ctx) != 0) ||
+        (ism330dhcx_read_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &val, 1) != 0) ||
+        (val != 0x5AU) ||
+        (ism330dhcx_emb_session_stop(&ctx) != 0))
+    {
+      emb_err++;
+    }
+  }
+
+  return NULL;
+}
+
+static void *user_thread(void *arg)
+{
+  ism330dhcx_fs_xl_t fs;
+  int i;
+
+  (void)arg;
+
+  for (i = 0; i < LOOPS; i++)
+  {
+    /* read-modify-write of CTRL1_XL, in the user bank */
+    if ((ism330dhcx_xl_full_scale_set(&ctx, (ism330dhcx_fs_xl_t)(i & 3)) != 0) ||
+        (ism330dhcx_xl_full_scale_get(&ctx, &fs) != 0) ||
+        ((int)fs != (i & 3)))
+    {
+      user_err++;
+    }
+  }
+
+  return NULL;
+}
+
+static void test_owner(void)
+{
+  ism330dhcx_shadow_t shadow;
+
+  /* stop without start must not release a level of the caller */
+  ism330dhcx_lock(&ctx);
+  CHECK(lock.depth == 1);
+  CHECK(ism330dhcx_emb_session_stop(&ctx) == 0);
+  CHECK(lock.depth == 1);
+  CHECK(ism330dhcx_emb_session_start(&ctx) == 0);
+  CHECK(lock.depth == 2);
+  CHECK(ism330dhcx_emb_session_stop(&ctx) == 0);
+  CHECK(lock.depth == 1);
+
+  CHECK(ism330dhcx_shadow_set(&ctx, &shadow) == 0);
+  CHECK(ism330dhcx_shadow_sync(&ctx) == 0);
+  CHECK(lock.depth == 1);
+  CHECK(ism330dhcx_shadow_set(&ctx, NULL) == 0);
+  ism330dhcx_unlock(&ctx);
+  CHECK(lock.depth == 0);
+}
+
+int main(void)
+{
+  pthread_t t[2];
+  uint8_t val = 0x5A;
+
+  test_emu_ctx(&ctx, &emu);
+  test_lock_attach(&priv, &lock);
+  ctx.priv_data = &priv;
+
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_EMBEDDED_FUNC_BANK) == 0);
+  CHECK(lock.depth == 1);
+  CHECK(ism330dhcx_write_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &val, 1) == 0);
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_USER_BANK) == 0);
+  CHECK(lock.depth == 0);
+
+  test_owner();
+
+  pthread_create(&t[0], NULL, emb_thread, NULL);
+  pthread_create(&t[1], NULL, user_thread, NULL);
+  pthread_join(t[0], NULL);
+  pthread_join(t[1], NULL);
+
+  CHECK(emb_err == 0);
+  CHECK(user_err == 0);
+  CHECK(lock.depth == 0);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_EMB_FUNC_EN_A] == 0U);
+  CHECK(emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS] == 0U);
+
+  TEST_END();
+}
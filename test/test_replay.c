@@ -0,0 +1,86 @@
+/*
+ * Replay backend: records loaded by a FIFO_STATUS2-only read, and the
+ * register image kept per bank.
+ */
+#include "test.h"
+
+static uint8_t cap[64];
+
+static uint32_t rec_words(uint32_t pos, uint8_t n, uint8_t first)
+{
+  uint8_t i;
+  uint8_t j;
+
+  cap[pos] = (uint8_t)ISM330DHCX_CAP_WORDS;
+  cap[pos + 1U] = 0;
+  cap[pos + 2U] = (uint8_t)(n * ISM330DHCX_FIFO_WORD_LEN);
+  cap[pos + 3U] = 0;
+  pos += ISM330DHCX_CAP_REC_LEN;
+
+  for (i = 0; i < n; i++)
+  {
+    cap[pos] = (uint8_t)ISM330DHCX_XL_NC_TAG << 3;
+
+    for (j = 1; j < ISM330DHCX_FIFO_WORD_LEN; j++)
+    {
+      cap[pos + j] = (uint8_t)(first + i);
+    }
+
+    pos += ISM330DHCX_FIFO_WORD_LEN;
+  }
+
+  return pos;
+}
+
+int main(void)
+{
+  ism330dhcx_fifo_status2_t status2;
+  ism330dhcx_replay_t rp;
+  stmdev_ctx_t ctx;
+  uint8_t buff[3 * ISM330DHCX_FIFO_WORD_LEN];
+  uint8_t val = 0x11;
+  uint16_t level = 0;
+  uint32_t len;
+
+  len = rec_words(0, 2, 10);
+  len = rec_words(len, 3, 20);
+  CHECK(len <= sizeof(cap));
+  CHECK(ism330dhcx_replay_init(&rp, cap, len, 0, NULL, 0) == 0);
+  ctx.read_reg = ism330dhcx_replay_read_reg;
+  ctx.write_reg = ism330dhcx_replay_write_reg;
+  ctx.mdelay = NULL;
+  ctx.handle = &rp;
+  ctx.priv_data = NULL;
+
+  /* first record, drained */
+  CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+  CHECK(level == 2U);
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, 2) == 0);
+  CHECK((buff[1] == 10U) && (buff[ISM330DHCX_FIFO_WORD_LEN + 1U] == 11U));
+
+  /* FIFO_STATUS2 alone brings the next record in */
+  CHECK(ism330dhcx_read_reg(&ctx, ISM330DHCX_FIFO_STATUS2,
+                            (uint8_t *)&status2, 1) == 0);
+  CHECK(status2.fifo_wtm_ia == 1U);
+  CHECK(ism330dhcx_fifo_data_level_get(&ctx, &level) == 0);
+  CHECK(level == 3U);
+  CHECK(ism330dhcx_fifo_out_multi_raw_get(&ctx, buff, 3) == 0);
+  CHECK(buff[(2U * ISM330DHCX_FIFO_WORD_LEN) + 1U] == 22U);
+  CHECK(ism330dhcx_replay_done(&rp) == 1U);
+
+  /* the same address in the user and embedded functions banks */
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_EMBEDDED_FUNC_BANK) == 0);
+  CHECK(ism330dhcx_write_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &val, 1) == 0);
+  val = 0;
+  CHECK(ism330dhcx_read_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &val, 1) == 0);
+  CHECK(val == 0x11U);
+  CHECK(ism330dhcx_mem_bank_set(&ctx, ISM330DHCX_USER_BANK) == 0);
+  CHECK(rp.reg[ISM330DHCX_EMBEDDED_FUNC_BANK][ISM330DHCX_EMB_FUNC_EN_A] ==
+        0x11U);
+  CHECK(rp.reg[ISM330DHCX_USER_BANK][ISM330DHCX_EMB_FUNC_EN_A] == 0U);
+  CHECK(rp.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FUNC_CFG_ACCESS] == 0U);
+  CHECK(ism330dhcx_read_reg(&ctx, ISM330DHCX_EMB_FUNC_EN_A, &val, 1) == 0);
+  CHECK(val == 0U);
+
+  TEST_END();
+}
@@ -0,0 +1,189 @@
+/*
+ * Replay loop: ism330dhcx_replay_run() on a fake time base releases one
+ * record every period ticks (mdelay advancing the replay clock while
+ * the next one is not due), decodes every word and reports per-stage
+ * latency percentiles through the bus statistics.
+ */
+#include <string.h>
+
+#include "test.h"
+
+#define PERIOD                                  10U
+#define RECORDS                                 4U
+
+static const uint8_t words[RECORDS] = { 2, 3, 1, 4 };
+static uint8_t cap[128];
+static ism330dhcx_replay_t rp;
+static uint32_t now;        /* replay clock, moved by mdelay           */
+static uint32_t bus_ticks;  /* statistics clock, one tick per byte read */
+static uint32_t delays;
+static uint32_t seen;
+static uint32_t seen_at[16];
+static uint8_t seen_val[16];
+
+static uint32_t now_get(void)
+{
+  return now;
+}
+
+static uint32_t bus_ticks_get(void)
+{
+  return bus_ticks;
+}
+
+static void fake_delay(uint32_t ms)
+{
+  now += ms;
+  delays++;
+}
+
+static int32_t timed_read(void *handle, uint8_t reg, uint8_t *data,
+                          uint16_t len)
+{
+  bus_ticks += len;
+
+  return ism330dhcx_replay_read_reg(handle, reg, data, len);
+}
+
+static void on_word(void *arg, const ism330dhcx_fifo_word_t *w)
+{
+  (void)arg;
+
+  if (seen < 16U)
+  {
+    seen_at[seen] = now;
+    seen_val[seen] = w->data[0];
+  }
+
+  seen++;
+}
+
+/* record r holds words[r] accelerometer words valued 10 * r + i */
+static uint32_t build(void)
+{
+  uint32_t pos = 0;
+  uint8_t r;
+  uint8_t i;
+
+  for (r = 0; r < RECORDS; r++)
+  {
+    cap[pos] = (uint8_t)ISM330DHCX_CAP_WORDS;
+    cap[pos + 1U] = 0;
+    cap[pos + 2U] = (uint8_t)(words[r] * ISM330DHCX_FIFO_WORD_LEN);
+    cap[pos + 3U] = 0;
+    pos += ISM330DHCX_CAP_REC_LEN;
+
+    for (i = 0; i < words[r]; i++)
+    {
+      /* XL_NC tag, tag_cnt 0, parity bit set */
+      memset(&cap[pos], 0, ISM330DHCX_FIFO_WORD_LEN);
+      cap[pos] = (uint8_t)(((uint8_t)ISM330DHCX_XL_NC_TAG << 3) | 0x01U);
+      cap[pos + 1U] = (uint8_t)((10U * r) + i);
+      pos += ISM330DHCX_FIFO_WORD_LEN;
+    }
+  }
+
+  return pos;
+}
+
+static const ism330dhcx_stats_entry_t *find(const ism330dhcx_stats_t *s,
+                                            const char *name)
+{
+  uint8_t i;
+
+  for (i = 0; i < s->len; i++)
+  {
+    if (strcmp(s->entry[i].name, name) == 0)
+    {
+      return &s->entry[i];
+    }
+  }
+
+  return NULL;
+}
+
+int main(void)
+{
+  ism330dhcx_fifo_decoder_t dec;
+  ism330dhcx_stats_t stats;
+  ism330dhcx_priv_t priv;
+  stmdev_ctx_t ctx;
+  const ism330dhcx_stats_entry_t *e;
+  uint8_t buff[2 * ISM330DHCX_FIFO_WORD_LEN];
+  uint32_t len;
+  uint32_t i;
+  uint32_t r;
+  uint32_t k = 0;
+
+  len = build();
+  CHECK(len <= sizeof(cap));
+
+  now = 100;
+  CHECK(ism330dhcx_replay_init(&rp, cap, len, 0, now_get, PERIOD) == 0);
+  CHECK((rp.release == 100U) && (rp.period == PERIOD));
+  memset(&priv, 0, sizeof(priv));
+  ctx.read_reg = timed_read;
+  ctx.write_reg = ism330dhcx_replay_write_reg;
+  ctx.mdelay = fake_delay;
+  ctx.handle = &rp;
+  ctx.priv_data = &priv;
+  stats.tick_get = bus_ticks_get;
+  CHECK(ism330dhcx_stats_set(&ctx, &stats) == 0);
+
+  ism330dhcx_fifo_decoder_init(&dec, NULL);
+  ism330dhcx_fifo_decoder_handler_set(&dec, ISM330DHCX_XL_NC_TAG, on_word);
+
+  CHECK(ism330dhcx_replay_run(&ctx, &dec, buff, 0) == -1);
+  CHECK(ism330dhcx_replay_run(&ctx, &dec, buff, 2) == 0);
+  CHECK(ism330dhcx_replay_done(&rp) == 1U);
+
+  /* the first record at once, then one every PERIOD ticks */
+  CHECK(seen == 10U);
+  CHECK((dec.parity_err == 0U) && (dec.unknown == 0U));
+
+  for (r = 0; r < RECORDS; r++)
+  {
+    for (i = 0; i < words[r]; i++)
+    {
+      CHECK(seen_val[k] == (10U * r) + i);
+      CHECK(seen_at[k] == 100U + (r * PERIOD));
+      k++;
+    }
+  }
+
+  CHECK(rp.release == 100U + ((RECORDS - 1U) * PERIOD));
+  CHECK(delays == (RECORDS - 1U) * PERIOD);
+  CHECK(now == 100U + ((RECORDS - 1U) * PERIOD));
+
+  /* bursts of at most 2 words: 2 | 2 1 | 1 | 2 2 */
+  e = find(&stats, "fifo_out_multi_raw_get");
+  CHECK((e != NULL) && (e->calls == 6U) && (e->rd_count == 6U));
+  CHECK(e->rd_bytes == 10U * ISM330DHCX_FIFO_WORD_LEN);
+  CHECK((e->hist[3] == 2U) && (e->hist[4] == 4U));
+  CHECK(ism330dhcx_stats_percentile_get(e, 33) == 8U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 34) == 16U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 100) == 16U);
+
+  /* one 2-byte status read per loop, waiting ones included */
+  e = find(&stats, "fifo_state_get");
+  CHECK((e != NULL) && (e->calls == RECORDS + delays));
+  CHECK(e->rd_bytes == 2U * e->calls);
+  CHECK(e->hist[2] == e->calls);
+  CHECK(ism330dhcx_stats_percentile_get(e, 50) == 4U);
+
+  /* decoding costs no bus access */
+  e = find(&stats, "fifo_decode");
+  CHECK((e != NULL) && (e->calls == 6U) && (e->rd_count == 0U));
+  CHECK(e->hist[0] == 6U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 99) == 1U);
+
+  /* at maximum speed (no time base) nothing waits */
+  delays = 0;
+  seen = 0;
+  CHECK(ism330dhcx_replay_init(&rp, cap, len, 0, NULL, PERIOD) == 0);
+  CHECK(rp.period == 0U);
+  CHECK(ism330dhcx_replay_run(&ctx, &dec, buff, 4) == 0);
+  CHECK((seen == 10U) && (delays == 0U));
+
+  TEST_END();
+}
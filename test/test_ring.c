@@ -0,0 +1,152 @@
+/*
+ * Sample ring: layout, wrap-around and overflow accounting, the ring as
+ * decompressor output through ism330dhcx_ring_sample_handler(), then a
+ * producer and a consumer thread checking that every sample arrives once
+ * and in order.
+ */
+#include <stddef.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "test.h"
+#include "fifo_ref.h"
+
+#define RING_LEN                                64U
+#define SAMPLES                                 2000000U
+
+static ism330dhcx_ring_t ring;
+static ism330dhcx_fifo_sample_t buf[RING_LEN];
+
+static void set(ism330dhcx_fifo_sample_t *s, uint32_t n)
+{
+  s->tag = ISM330DHCX_XL_NC_TAG;
+  s->cnt = (uint8_t)(n & 3U);
+  s->val[0] = (int16_t)(n & 0x7FFFU);
+  s->val[1] = (int16_t)((n >> 15) & 0x7FFFU);
+  s->val[2] = (int16_t)(~n & 0x7FFFU);
+}
+
+static int same(const ism330dhcx_fifo_sample_t *s, uint32_t n)
+{
+  ism330dhcx_fifo_sample_t ref;
+
+  set(&ref, n);
+  return (s->tag == ref.tag) && (s->cnt == ref.cnt) &&
+         (s->val[0] == ref.val[0]) && (s->val[1] == ref.val[1]) &&
+         (s->val[2] == ref.val[2]);
+}
+
+static void *producer(void *arg)
+{
+  ism330dhcx_fifo_sample_t s;
+  uint32_t n;
+
+  (void)arg;
+
+  for (n = 0; n < SAMPLES; n++)
+  {
+    set(&s, n);
+
+    while (ism330dhcx_ring_push(&ring, &s) != 0)
+    {
+      (void)sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+int main(void)
+{
+  ism330dhcx_fifo_decomp_t dc;
+  ism330dhcx_fifo_word_t w;
+  uint8_t raw[ISM330DHCX_FIFO_WORD_LEN];
+  ism330dhcx_fifo_sample_t s;
+  pthread_t t;
+  uint32_t n;
+  uint32_t bad = 0;
+
+  /* storage descriptor, producer and consumer fields on separate lines */
+  CHECK(offsetof(ism330dhcx_ring_t, head) -
+        offsetof(ism330dhcx_ring_t, buf) >= ISM330DHCX_RING_CACHE_LINE);
+  CHECK(offsetof(ism330dhcx_ring_t, head) -
+        offsetof(ism330dhcx_ring_t, mask) >= ISM330DHCX_RING_CACHE_LINE - 8U);
+  CHECK(offsetof(ism330dhcx_ring_t, tail) -
+        offsetof(ism330dhcx_ring_t, high_water) >=
+        ISM330DHCX_RING_CACHE_LINE - 8U);
+
+  CHECK(ism330dhcx_ring_init(&ring, buf, 48U) == -1);
+  CHECK(ism330dhcx_ring_init(&ring, buf, RING_LEN) == 0);
+
+  /* single thread: fill, overflow, wrap */
+  for (n = 0; n < RING_LEN + 3U; n++)
+  {
+    set(&s, n);
+    CHECK(ism330dhcx_ring_push(&ring, &s) == ((n < RING_LEN) ? 0 : -1));
+  }
+
+  CHECK(ring.overflow == 3U);
+  CHECK(ring.high_water == RING_LEN);
+  CHECK(ism330dhcx_ring_level_get(&ring) == RING_LEN);
+
+  for (n = 0; n < RING_LEN; n++)
+  {
+    CHECK(ism330dhcx_ring_pop(&ring, &s) == 0);
+    CHECK(same(&s, n));
+  }
+
+  CHECK(ism330dhcx_ring_pop(&ring, &s) == -1);
+
+  /* decompressor output handed to the ring, in word order */
+  CHECK(ism330dhcx_ring_init(&ring, buf, RING_LEN) == 0);
+  ism330dhcx_fifo_decomp_init(&dc, ism330dhcx_ring_sample_handler, &ring);
+  ref_word(raw, ISM330DHCX_XL_NC_TAG, 1, 100, -200, 16393);
+  CHECK(ism330dhcx_fifo_word_decode(raw, &w) == 0);
+  CHECK(ism330dhcx_fifo_decompress(&dc, &w) == 1U);
+  ref_word(raw, ISM330DHCX_GYRO_NC_TAG, 1, -5, 6, -7);
+  CHECK(ism330dhcx_fifo_word_decode(raw, &w) == 0);
+  CHECK(ism330dhcx_fifo_decompress(&dc, &w) == 1U);
+  CHECK(ism330dhcx_ring_level_get(&ring) == 2U);
+  CHECK(ism330dhcx_ring_pop(&ring, &s) == 0);
+  CHECK((s.tag == ISM330DHCX_XL_NC_TAG) && (s.cnt == 1U) &&
+        (s.val[0] == 100) && (s.val[1] == -200) && (s.val[2] == 16393));
+  CHECK(ism330dhcx_ring_pop(&ring, &s) == 0);
+  CHECK((s.tag == ISM330DHCX_GYRO_NC_TAG) && (s.val[0] == -5) &&
+        (s.val[1] == 6) && (s.val[2] == -7));
+
+  /* the handler drops on a full ring, counted as overflow */
+  for (n = 0; n < RING_LEN + 2U; n++)
+  {
+    set(&s, n);
+    ism330dhcx_ring_sample_handler(&ring, &s);
+  }
+
+  CHECK(ism330dhcx_ring_level_get(&ring) == RING_LEN);
+  CHECK(ring.overflow == 2U);
+  CHECK(ism330dhcx_ring_pop(&ring, &s) == 0);
+  CHECK(same(&s, 0));
+
+  /* two threads */
+  CHECK(ism330dhcx_ring_init(&ring, buf, RING_LEN) == 0);
+  CHECK(pthread_create(&t, NULL, producer, NULL) == 0);
+
+  for (n = 0; n < SAMPLES; n++)
+  {
+    while (ism330dhcx_ring_pop(&ring, &s) != 0)
+    {
+      (void)sched_yield();
+    }
+
+    if (!same(&s, n))
+    {
+      bad++;
+    }
+  }
+
+  (void)pthread_join(t, NULL);
+  CHECK(bad == 0U);
+  CHECK(ism330dhcx_ring_level_get(&ring) == 0U);
+  CHECK(ring.high_water <= RING_LEN);
+
+  TEST_END();
+}
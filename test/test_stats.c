@@ -0,0 +1,180 @@
+/*
+ * Bus usage statistics: accesses, bytes and errors charged to the call
+ * wrapped by ISM330DHCX_STATS_CALL() (nested calls to the outermost one,
+ * the rest to "other"), log2 latency histogram and percentiles, entry
+ * table overflow and stats_dump.
+ */
+#include <string.h>
+
+#include "test.h"
+
+static ism330dhcx_emu_t emu;
+static stmdev_ctx_t ctx;
+static uint32_t now;
+static int fail;
+static const ism330dhcx_stats_entry_t *dumped[ISM330DHCX_STATS_MAX];
+static int ndumped;
+
+static uint32_t tick_get(void)
+{
+  return now;
+}
+
+static int32_t bus_read(void *handle, uint8_t reg, uint8_t *data,
+                        uint16_t len)
+{
+  int32_t ret = ism330dhcx_emu_read_reg(handle, reg, data, len);
+
+  return (fail != 0) ? -1 : ret;
+}
+
+/* one 1-byte read lasting the given number of ticks */
+static int32_t slow_read(const stmdev_ctx_t *c, uint32_t ticks)
+{
+  uint8_t b;
+
+  now += ticks;
+
+  return ism330dhcx_read_reg(c, ISM330DHCX_WHO_AM_I, &b, 1);
+}
+
+/* a wrapped call wrapping another one */
+static int32_t outer(const stmdev_ctx_t *c)
+{
+  uint8_t b[4];
+  int32_t ret;
+
+  ISM330DHCX_STATS_CALL(c, ret, ism330dhcx_read_reg,
+                        (c, ISM330DHCX_CTRL1_XL, b, 4));
+  ret += ism330dhcx_write_reg(c, ISM330DHCX_CTRL1_XL, b, 1);
+
+  return ret;
+}
+
+static void print(const ism330dhcx_stats_entry_t *e)
+{
+  dumped[ndumped] = e;
+  ndumped++;
+}
+
+static const ism330dhcx_stats_entry_t *find(const ism330dhcx_stats_t *s,
+                                            const char *name)
+{
+  uint8_t i;
+
+  for (i = 0; i < s->len; i++)
+  {
+    if (strcmp(s->entry[i].name, name) == 0)
+    {
+      return &s->entry[i];
+    }
+  }
+
+  return NULL;
+}
+
+int main(void)
+{
+  static char names[ISM330DHCX_STATS_MAX][8];
+  ism330dhcx_priv_t priv;
+  ism330dhcx_stats_t stats;
+  const ism330dhcx_stats_entry_t *e;
+  uint8_t b[3] = { 0, 0, 0 };
+  int32_t ret;
+  uint8_t i;
+
+  test_emu_ctx(&ctx, &emu);
+  ctx.read_reg = bus_read;
+  CHECK(ism330dhcx_stats_set(&ctx, &stats) == -1);
+  memset(&priv, 0, sizeof(priv));
+  ctx.priv_data = &priv;
+  stats.tick_get = tick_get;
+  CHECK(ism330dhcx_stats_set(&ctx, &stats) == 0);
+  CHECK((stats.len == 1U) && (strcmp(stats.entry[0].name, "other") == 0));
+
+  /* reads and writes charged to their call, bytes counted */
+  ISM330DHCX_STATS_CALL(&ctx, ret, ism330dhcx_read_reg,
+                        (&ctx, ISM330DHCX_CTRL1_XL, b, 2));
+  CHECK(ret == 0);
+  ISM330DHCX_STATS_CALL(&ctx, ret, ism330dhcx_write_reg,
+                        (&ctx, ISM330DHCX_CTRL1_XL, b, 3));
+  ISM330DHCX_STATS_CALL(&ctx, ret, ism330dhcx_write_reg,
+                        (&ctx, ISM330DHCX_CTRL4_C, b, 1));
+  CHECK(ret == 0);
+  e = find(&stats, "ism330dhcx_read_reg");
+  CHECK((e != NULL) && (e->calls == 1U) && (e->rd_count == 1U) &&
+        (e->rd_bytes == 2U) && (e->wr_count == 0U) && (e->errors == 0U));
+  e = find(&stats, "ism330dhcx_write_reg");
+  CHECK((e != NULL) && (e->calls == 2U) && (e->wr_count == 2U) &&
+        (e->wr_bytes == 4U) && (e->rd_count == 0U));
+
+  /* accesses outside any wrapped call, failed ones counted as errors */
+  CHECK(ism330dhcx_read_reg(&ctx, ISM330DHCX_WHO_AM_I, b, 1) == 0);
+  fail = 1;
+  CHECK(ism330dhcx_read_reg(&ctx, ISM330DHCX_WHO_AM_I, b, 1) == -1);
+  fail = 0;
+  CHECK((stats.entry[0].calls == 0U) && (stats.entry[0].rd_count == 2U) &&
+        (stats.entry[0].rd_bytes == 2U) && (stats.entry[0].errors == 1U));
+
+  /* nested: everything charged to the outermost call */
+  ISM330DHCX_STATS_CALL(&ctx, ret, outer, (&ctx));
+  CHECK(ret == 0);
+  e = find(&stats, "outer");
+  CHECK((e != NULL) && (e->calls == 1U) && (e->rd_count == 1U) &&
+        (e->rd_bytes == 4U) && (e->wr_count == 1U) && (e->wr_bytes == 1U));
+  e = find(&stats, "ism330dhcx_read_reg");
+  CHECK((e != NULL) && (e->calls == 1U) && (e->rd_count == 1U));
+  CHECK(stats.depth == 0U);
+
+  /* bin n counts the calls lasting less than 2^n ticks */
+  ISM330DHCX_STATS_CALL(&ctx, ret, slow_read, (&ctx, 0));
+  ISM330DHCX_STATS_CALL(&ctx, ret, slow_read, (&ctx, 1));
+  ISM330DHCX_STATS_CALL(&ctx, ret, slow_read, (&ctx, 3));
+  ISM330DHCX_STATS_CALL(&ctx, ret, slow_read, (&ctx, 4));
+  ISM330DHCX_STATS_CALL(&ctx, ret, slow_read, (&ctx, 1000));
+  ISM330DHCX_STATS_CALL(&ctx, ret, slow_read, (&ctx, 70000));
+  e = find(&stats, "slow_read");
+  CHECK((e != NULL) && (e->calls == 6U) && (e->rd_count == 6U));
+  CHECK((e->hist[0] == 1U) && (e->hist[1] == 1U) && (e->hist[2] == 1U) &&
+        (e->hist[3] == 1U) && (e->hist[10] == 1U) &&
+        (e->hist[ISM330DHCX_STATS_HIST_LEN - 1U] == 1U));
+  CHECK(ism330dhcx_stats_percentile_get(e, 1) == 1U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 50) == 4U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 66) == 8U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 80) == 1024U);
+  CHECK(ism330dhcx_stats_percentile_get(e, 100) ==
+        (1U << (ISM330DHCX_STATS_HIST_LEN - 1U)));
+  CHECK(ism330dhcx_stats_percentile_get(&stats.entry[0], 50) == 0U);
+
+  /* dump reports the entries in allocation order */
+  ism330dhcx_stats_dump(&ctx, print);
+  CHECK(ndumped == 5);
+  CHECK((dumped[0] == &stats.entry[0]) &&
+        (strcmp(dumped[1]->name, "ism330dhcx_read_reg") == 0) &&
+        (strcmp(dumped[2]->name, "ism330dhcx_write_reg") == 0) &&
+        (strcmp(dumped[3]->name, "outer") == 0) &&
+        (strcmp(dumped[4]->name, "slow_read") == 0));
+
+  /* a full table charges new names to "other" */
+  for (i = 0; i < ISM330DHCX_STATS_MAX; i++)
+  {
+    snprintf(names[i], sizeof(names[i]), "f%u", (unsigned)i);
+    ism330dhcx_stats_begin(&ctx, names[i]);
+    ism330dhcx_stats_end(&ctx);
+  }
+
+  CHECK(stats.len == ISM330DHCX_STATS_MAX);
+  CHECK(stats.entry[0].calls == 5U);
+  CHECK(find(&stats, names[ISM330DHCX_STATS_MAX - 5U]) == NULL);
+
+  /* unbalanced end and detached statistics are ignored */
+  ism330dhcx_stats_end(&ctx);
+  CHECK(stats.depth == 0U);
+  CHECK(ism330dhcx_stats_set(&ctx, NULL) == 0);
+  ISM330DHCX_STATS_CALL(&ctx, ret, ism330dhcx_read_reg,
+                        (&ctx, ISM330DHCX_CTRL1_XL, b, 2));
+  CHECK(ret == 0);
+  CHECK(find(&stats, "ism330dhcx_read_reg")->calls == 1U);
+
+  TEST_END();
+}
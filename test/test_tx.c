@@ -0,0 +1,114 @@
+/*
+ * Register write transactions: adjacent queued writes merged into
+ * bursts, queue overflow, FUNC_CFG_ACCESS never merged and kept in
+ * order across banks.
+ */
+#include "buslog.h"
+
+static buslog_t bus;
+static stmdev_ctx_t ctx;
+
+static int acc_is(int i, uint8_t bank, uint8_t reg, uint16_t len)
+{
+  return (bus.acc[i].rd == 0U) && (bus.acc[i].bank == bank) &&
+         (bus.acc[i].reg == reg) && (bus.acc[i].len == len);
+}
+
+int main(void)
+{
+  static const uint8_t val[ISM330DHCX_TX_MAX + 1U] = { 0 };
+  ism330dhcx_tx_t tx;
+  uint8_t b[2];
+  uint16_t wtm;
+
+  buslog_ctx(&ctx, &bus);
+
+  /* 0x10, 0x11 then 0x13 + 0x14: two bursts, in queue order */
+  ism330dhcx_tx_init(&tx);
+  b[0] = 0x40;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_CTRL1_XL, &b[0], 1) == 0);
+  b[0] = 0x44;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_CTRL2_G, &b[0], 1) == 0);
+  b[0] = 0x02;
+  b[1] = 0x20;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_CTRL4_C, b, 2) == 0);
+  CHECK(tx.len == 4U);
+  CHECK(ism330dhcx_tx_commit(&ctx, &tx) == 0);
+  CHECK(tx.len == 0U);
+  CHECK(bus.n == 2);
+  CHECK(acc_is(0, ISM330DHCX_USER_BANK, ISM330DHCX_CTRL1_XL, 2));
+  CHECK((bus.acc[0].data[0] == 0x40U) && (bus.acc[0].data[1] == 0x44U));
+  CHECK(acc_is(1, ISM330DHCX_USER_BANK, ISM330DHCX_CTRL4_C, 2));
+  CHECK((bus.acc[1].data[0] == 0x02U) && (bus.acc[1].data[1] == 0x20U));
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL] == 0x40U);
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL2_G] == 0x44U);
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL5_C] == 0x20U);
+
+  /* descending addresses are not merged */
+  buslog_clear(&bus);
+  b[0] = 0x00;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_CTRL2_G, &b[0], 1) == 0);
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_CTRL1_XL, &b[0], 1) == 0);
+  CHECK(ism330dhcx_tx_commit(&ctx, &tx) == 0);
+  CHECK(bus.n == 2);
+  CHECK(acc_is(0, ISM330DHCX_USER_BANK, ISM330DHCX_CTRL2_G, 1));
+  CHECK(acc_is(1, ISM330DHCX_USER_BANK, ISM330DHCX_CTRL1_XL, 1));
+
+  /* overflow: a write that does not fit is refused as a whole */
+  CHECK(ism330dhcx_tx_write(&tx, 0x10, val, ISM330DHCX_TX_MAX + 1U) == -1);
+  CHECK(tx.len == 0U);
+  CHECK(ism330dhcx_tx_write(&tx, 0x10, val, ISM330DHCX_TX_MAX - 1U) == 0);
+  CHECK(ism330dhcx_tx_write(&tx, 0x40, val, 2) == -1);
+  CHECK(tx.len == (ISM330DHCX_TX_MAX - 1U));
+  CHECK(ism330dhcx_tx_write(&tx, 0x1F, val, 1) == 0);
+  CHECK(tx.len == ISM330DHCX_TX_MAX);
+  CHECK(ism330dhcx_tx_write(&tx, 0x20, val, 1) == -1);
+  ism330dhcx_tx_init(&tx);
+  CHECK(tx.len == 0U);
+
+  /*
+   * bank switch in the queue: FUNC_CFG_ACCESS goes alone, before the
+   * adjacent PAGE_SEL, and the embedded bank writes land in that bank
+   */
+  buslog_clear(&bus);
+  b[0] = 0x80;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_FUNC_CFG_ACCESS, &b[0], 1) == 0);
+  b[0] = 0x01;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_PAGE_SEL, &b[0], 1) == 0);
+  b[0] = 0x10;
+  b[1] = 0x01;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_EMB_FUNC_EN_A, b, 2) == 0);
+  b[0] = 0x00;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_FUNC_CFG_ACCESS, &b[0], 1) == 0);
+  b[0] = 0x60;
+  CHECK(ism330dhcx_tx_write(&tx, ISM330DHCX_CTRL1_XL, &b[0], 1) == 0);
+  CHECK(ism330dhcx_tx_commit(&ctx, &tx) == 0);
+  CHECK(bus.n == 5);
+  CHECK(acc_is(0, ISM330DHCX_USER_BANK, ISM330DHCX_FUNC_CFG_ACCESS, 1));
+  CHECK(acc_is(1, ISM330DHCX_EMBEDDED_FUNC_BANK, ISM330DHCX_PAGE_SEL, 1));
+  CHECK(acc_is(2, ISM330DHCX_EMBEDDED_FUNC_BANK, ISM330DHCX_EMB_FUNC_EN_A,
+               2));
+  CHECK(acc_is(3, ISM330DHCX_EMBEDDED_FUNC_BANK, ISM330DHCX_FUNC_CFG_ACCESS,
+               1));
+  CHECK(acc_is(4, ISM330DHCX_USER_BANK, ISM330DHCX_CTRL1_XL, 1));
+  CHECK(buslog_bank_writes(&bus) == 2);
+  CHECK(bus.emu.reg[ISM330DHCX_EMBEDDED_FUNC_BANK]
+        [ISM330DHCX_EMB_FUNC_EN_A] == 0x10U);
+  CHECK(bus.emu.reg[ISM330DHCX_EMBEDDED_FUNC_BANK]
+        [ISM330DHCX_EMB_FUNC_EN_B] == 0x01U);
+  CHECK(bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_CTRL1_XL] == 0x60U);
+
+  /* watermark: read-modify-write of FIFO_CTRL1 + FIFO_CTRL2, one burst */
+  bus.emu.reg[ISM330DHCX_USER_BANK][ISM330DHCX_FIFO_CTRL2] = 0x80;
+  buslog_clear(&bus);
+  CHECK(ism330dhcx_fifo_watermark_set(&ctx, 0x1AB) == 0);
+  CHECK(bus.n == 2);
+  CHECK((bus.acc[0].rd == 1U) && (bus.acc[0].reg == ISM330DHCX_FIFO_CTRL1) &&
+        (bus.acc[0].len == 2U));
+  CHECK(acc_is(1, ISM330DHCX_USER_BANK, ISM330DHCX_FIFO_CTRL1, 2));
+  CHECK((bus.acc[1].data[0] == 0xABU) && (bus.acc[1].data[1] == 0x81U));
+  CHECK(ism330dhcx_fifo_watermark_get(&ctx, &wtm) == 0);
+  CHECK(wtm == 0x1ABU);
+
+  TEST_END();
+}
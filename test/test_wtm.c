@@ -0,0 +1,49 @@
+/*
+ * Adaptive watermark controller: the excess seen in a burst decays back
+ * to 0 and the watermark returns to its pre-burst value.
+ */
+#include "test.h"
+
+#define RATE                                    1000U   /* words/s */
+#define DRAIN                                   1000U   /* us      */
+
+int main(void)
+{
+  stmdev_ctx_t ctx;
+  ism330dhcx_emu_t emu;
+  ism330dhcx_wtm_ctrl_t ctrl;
+  uint16_t steady;
+  uint16_t wtm;
+  int i;
+
+  test_emu_ctx(&ctx, &emu);
+  ism330dhcx_wtm_ctrl_init(&ctrl, RATE, 1000000U, 1U, 438U);
+
+  for (i = 0; i < 40; i++)
+  {
+    CHECK(ism330dhcx_wtm_ctrl_update(&ctx, &ctrl, ctrl.wtm, DRAIN) == 0);
+  }
+
+  /* budget not binding: FIFO size less twice the drain words */
+  steady = ctrl.wtm;
+  CHECK(steady == ISM330DHCX_FIFO_WORDS - 2U);
+  CHECK(ism330dhcx_fifo_watermark_get(&ctx, &wtm) == 0);
+  CHECK(wtm == steady);
+
+  /* burst of 40 words beyond the watermark */
+  CHECK(ism330dhcx_wtm_ctrl_update(&ctx, &ctrl, ctrl.wtm + 40U, DRAIN) == 0);
+  CHECK(ctrl.excess == 40U);
+  CHECK(ctrl.wtm < steady);
+
+  for (i = 0; i < 60; i++)
+  {
+    CHECK(ism330dhcx_wtm_ctrl_update(&ctx, &ctrl, ctrl.wtm, DRAIN) == 0);
+  }
+
+  CHECK(ctrl.excess == 0U);
+  CHECK(ctrl.wtm == steady);
+  CHECK(ism330dhcx_fifo_watermark_get(&ctx, &wtm) == 0);
+  CHECK(wtm == steady);
+
+  TEST_END();
+}